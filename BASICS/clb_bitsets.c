@@ -0,0 +1,253 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_bitsets.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Bit vector sets.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 18:03:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "clb_bitsets.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetAlloc()
+//
+//   Allocate an empty set for the elements 0..size-1.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+BitSet_p BitSetAlloc(long size)
+{
+   BitSet_p handle = BitSetCellAlloc();
+
+   assert(size >= 0);
+
+   handle->size  = size;
+   handle->words = size/BITSET_WORD_BITS+1;
+   handle->bits  = SizeMalloc(handle->words*sizeof(unsigned long));
+   BitSetClearAll(handle);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetFree()
+//
+//   Free a bit set.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void BitSetFree(BitSet_p junk)
+{
+   SizeFree(junk->bits, junk->words*sizeof(unsigned long));
+   BitSetCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetClearAll()
+//
+//   Remove all elements from set.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void BitSetClearAll(BitSet_p set)
+{
+   memset(set->bits, 0, set->words*sizeof(unsigned long));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetOr()
+//
+//   Add all elements of src to dest. Both sets must have the same
+//   size.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes dest
+//
+/----------------------------------------------------------------------*/
+
+void BitSetOr(BitSet_p dest, BitSet_p src)
+{
+   long i;
+
+   assert(dest->words == src->words);
+
+   for(i=0; i<dest->words; i++)
+   {
+      dest->bits[i] |= src->bits[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetAndNot()
+//
+//   Remove all elements of src from dest. Both sets must have the
+//   same size.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes dest
+//
+/----------------------------------------------------------------------*/
+
+void BitSetAndNot(BitSet_p dest, BitSet_p src)
+{
+   long i;
+
+   assert(dest->words == src->words);
+
+   for(i=0; i<dest->words; i++)
+   {
+      dest->bits[i] &= ~src->bits[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetIsEmpty()
+//
+//   Return true if set has no elements.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool BitSetIsEmpty(BitSet_p set)
+{
+   long i;
+
+   for(i=0; i<set->words; i++)
+   {
+      if(set->bits[i])
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetCount()
+//
+//   Return the number of elements in set.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long BitSetCount(BitSet_p set)
+{
+   long i, res = 0;
+
+   for(i=0; i<set->words; i++)
+   {
+      res += __builtin_popcountl(set->bits[i]);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BitSetNextElement()
+//
+//   Return the smallest element of set that is >= start, or -1 if
+//   there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long BitSetNextElement(BitSet_p set, long start)
+{
+   long          i = start/BITSET_WORD_BITS;
+   unsigned long word;
+
+   if(start >= set->size)
+   {
+      return -1;
+   }
+   word = set->bits[i] & (~0UL << (start%BITSET_WORD_BITS));
+   while(!word)
+   {
+      i++;
+      if(i == set->words)
+      {
+         return -1;
+      }
+      word = set->bits[i];
+   }
+   return i*BITSET_WORD_BITS+__builtin_ctzl(word);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
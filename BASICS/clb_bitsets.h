@@ -0,0 +1,80 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_bitsets.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Dense, fixed-size sets of small natural numbers, represented as bit
+  vectors.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 18:03:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_BITSETS
+
+#define CLB_BITSETS
+
+#include <limits.h>
+#include <clb_memory.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define BITSET_WORD_BITS (sizeof(unsigned long)*CHAR_BIT)
+
+typedef struct bitsetcell
+{
+   long          size;  /* Elements are 0..size-1 */
+   long          words;
+   unsigned long *bits;
+}BitSetCell, *BitSet_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define BitSetCellAlloc()    (BitSetCell*)SizeMalloc(sizeof(BitSetCell))
+#define BitSetCellFree(junk) SizeFree(junk, sizeof(BitSetCell))
+
+BitSet_p BitSetAlloc(long size);
+void     BitSetFree(BitSet_p junk);
+void     BitSetClearAll(BitSet_p set);
+void     BitSetOr(BitSet_p dest, BitSet_p src);
+void     BitSetAndNot(BitSet_p dest, BitSet_p src);
+bool     BitSetIsEmpty(BitSet_p set);
+long     BitSetCount(BitSet_p set);
+long     BitSetNextElement(BitSet_p set, long start);
+
+#define BitSetWord(set, i) ((set)->bits[(i)/BITSET_WORD_BITS])
+#define BitSetMask(i)      (1UL<<((i)%BITSET_WORD_BITS))
+
+#define BitSetInsert(set, i) (BitSetWord((set),(i)) |= BitSetMask(i))
+#define BitSetDelete(set, i) (BitSetWord((set),(i)) &= ~BitSetMask(i))
+#define BitSetQuery(set, i)  ((BitSetWord((set),(i)) & BitSetMask(i))!=0)
+
+/* Iterate over all elements of set in ascending order */
+
+#define BitSetForEach(set, i) \
+   for((i)=BitSetNextElement((set),0); (i)!=-1; \
+       (i)=BitSetNextElement((set),(i)+1))
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
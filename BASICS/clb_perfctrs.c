@@ -0,0 +1,545 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_perfctrs.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Registry, calibration and output of the performance counters.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 04:12:38 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "clb_perfctrs.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+bool                  PerfCtrsEnabled       = false;
+volatile sig_atomic_t PerfCtrsDumpRequested = 0;
+PerfCtr_p             PerfCtrCurrent        = NULL;
+
+static PerfCtr_p perf_ctrs      = NULL; /* Registry, in order of */
+static PerfCtr_p perf_ctrs_last = NULL; /* first use             */
+
+static char*     dump_file      = NULL;
+static pid_t     dump_pid       = 0;
+
+/* Reference points for converting ticks into seconds */
+static long long calib_ticks    = 0;
+static long long calib_nsecs    = 0;
+
+#define CALIB_MIN_NSECS 10000000LL
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: get_nsecs()
+//
+//   Return the value of the monotonic clock in nanoseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long long get_nsecs(void)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (long long)now.tv_sec*1000000000LL+now.tv_nsec;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_ctr_type_name()
+//
+//   Return a string describing the type of the counter.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* perf_ctr_type_name(PerfCtr_p ctr)
+{
+   switch(ctr->type)
+   {
+   case PCTimer:
+         return "timer";
+   case PCSample:
+         return "sample";
+   default:
+         return "unused";
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_ctr_parent_name()
+//
+//   Return the name of the timer ctr was (always) entered under,
+//   "*" if it was entered under different timers, or NULL if it was
+//   entered at top level or is no timer.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static const char* perf_ctr_parent_name(PerfCtr_p ctr)
+{
+   if(ctr->mixed)
+   {
+      return "*";
+   }
+   return ctr->parent?ctr->parent->name:NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_ctrs_dump_at_exit()
+//
+//   Dump the counters. Suitable for atexit().
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void perf_ctrs_dump_at_exit(void)
+{
+   PerfCtrsDump();
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsEnable()
+//
+//   Enable the performance counters. If dump_file is given, all
+//   counters will be written to it at exit and whenever SIGUSR1 is
+//   received (as JSON, or as CSV if the name ends in ".csv"). "-"
+//   stands for stderr. Processes forked later write to
+//   <dump_file>.<pid>. dump_file is not copied.
+//
+// Global Variables: PerfCtrsEnabled, dump_file, dump_pid, calib_*
+//
+// Side Effects    : Installs signal handler and exit function.
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsEnable(char* dump_file_name)
+{
+   PerfCtrsEnabled = true;
+   calib_nsecs = get_nsecs();
+   calib_ticks = PerfCtrTicks();
+
+   if(dump_file_name && !dump_file)
+   {
+      dump_file = dump_file_name;
+      dump_pid  = getpid();
+      atexit(perf_ctrs_dump_at_exit);
+      if(signal(SIGUSR1, PerfCtrsSignalHandler) == SIG_ERR)
+      {
+         TmpErrno = errno;
+         SysError("Unable to set up signal handler", SYS_ERROR);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrRegister()
+//
+//   Add ctr to the registry of counters to be printed.
+//
+// Global Variables: perf_ctrs, perf_ctrs_last
+//
+// Side Effects    : Changes ctr and the registry.
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrRegister(PerfCtr_p ctr)
+{
+   if(ctr->registered)
+   {
+      return;
+   }
+   ctr->registered = true;
+   ctr->next = NULL;
+   if(perf_ctrs_last)
+   {
+      perf_ctrs_last->next = ctr;
+   }
+   else
+   {
+      perf_ctrs = ctr;
+   }
+   perf_ctrs_last = ctr;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrReset()
+//
+//   Reset the collected data of the counter (but not its nesting
+//   state).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes ctr.
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrReset(PerfCtr_p ctr)
+{
+   int i;
+
+   ctr->events = 0;
+   ctr->total  = 0;
+   ctr->child  = 0;
+   for(i=0; i<PERF_CTR_HIST_SIZE; i++)
+   {
+      ctr->hist[i] = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsTicksPerSecond()
+//
+//   Return the number of ticks per second, measured against the
+//   monotonic clock since the counters have been enabled. If that is
+//   too short to be precise, wait a bit.
+//
+// Global Variables: calib_ticks, calib_nsecs
+//
+// Side Effects    : May take up to 10ms.
+//
+/----------------------------------------------------------------------*/
+
+double PerfCtrsTicksPerSecond(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+   long long nsecs, ticks;
+
+   if(!calib_nsecs)
+   {
+      calib_nsecs = get_nsecs();
+      calib_ticks = PerfCtrTicks();
+   }
+   do
+   {
+      nsecs = get_nsecs();
+      ticks = PerfCtrTicks();
+   }while(nsecs-calib_nsecs < CALIB_MIN_NSECS);
+
+   return (double)(ticks-calib_ticks)*1.0e9/(double)(nsecs-calib_nsecs);
+#else
+   return 1.0e9;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrPrint()
+//
+//   Print a one-line summary of the counter as a comment: The time
+//   in seconds for timers, the number of events and the sum of values
+//   otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrPrint(FILE* out, PerfCtr_p ctr)
+{
+   char name[64];
+
+   snprintf(name, sizeof(name), "(%s)", ctr->name);
+   if(ctr->type == PCTimer)
+   {
+      fprintf(out, "# PC%-34s : %f\n", name,
+              ctr->total/PerfCtrsTicksPerSecond());
+   }
+   else
+   {
+      fprintf(out, "# PC%-34s : %lld events, sum %lld\n", name,
+              ctr->events, ctr->total);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsPrint()
+//
+//   Print all registered counters with PerfCtrPrint().
+//
+// Global Variables: perf_ctrs
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsPrint(FILE* out)
+{
+   PerfCtr_p ctr;
+
+   for(ctr = perf_ctrs; ctr; ctr = ctr->next)
+   {
+      PerfCtrPrint(out, ctr);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsDumpJSON()
+//
+//   Print all registered counters as a JSON object. Histograms map
+//   the binary logarithm of values (i.e. bucket i holds the values
+//   in [2^i, 2^(i+1))) to the number of events, with empty buckets
+//   omitted.
+//
+// Global Variables: perf_ctrs
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsDumpJSON(FILE* out)
+{
+   PerfCtr_p   ctr;
+   const char* parent;
+   double      tps = PerfCtrsTicksPerSecond();
+   int         i;
+   char*       sep;
+
+   fprintf(out, "{\n  \"pid\": %ld,\n  \"ticks_per_second\": %.0f,\n"
+           "  \"counters\": [",
+           (long)getpid(), tps);
+   for(ctr = perf_ctrs; ctr; ctr = ctr->next)
+   {
+      fprintf(out, "%s\n    {\"name\": \"%s\", \"type\": \"%s\", ",
+              ctr==perf_ctrs?"":",", ctr->name, perf_ctr_type_name(ctr));
+      if(ctr->type == PCTimer)
+      {
+         parent = perf_ctr_parent_name(ctr);
+         if(parent)
+         {
+            fprintf(out, "\"parent\": \"%s\", ", parent);
+         }
+         else
+         {
+            fprintf(out, "\"parent\": null, ");
+         }
+         fprintf(out, "\"events\": %lld, \"ticks\": %lld, "
+                 "\"seconds\": %f, \"self_seconds\": %f, ",
+                 ctr->events, ctr->total, ctr->total/tps,
+                 (ctr->total-ctr->child)/tps);
+      }
+      else
+      {
+         fprintf(out, "\"events\": %lld, \"sum\": %lld, ",
+                 ctr->events, ctr->total);
+      }
+      fprintf(out, "\"histogram\": {");
+      sep = "";
+      for(i=0; i<PERF_CTR_HIST_SIZE; i++)
+      {
+         if(ctr->hist[i])
+         {
+            fprintf(out, "%s\"%d\": %lld", sep, i, ctr->hist[i]);
+            sep = ", ";
+         }
+      }
+      fprintf(out, "}}");
+   }
+   fprintf(out, "\n  ]\n}\n");
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsDumpCSV()
+//
+//   Print all registered counters as CSV, one line per counter. The
+//   histogram is given as a ';'-separated list of bucket:events.
+//
+// Global Variables: perf_ctrs
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsDumpCSV(FILE* out)
+{
+   PerfCtr_p   ctr;
+   const char* parent;
+   double      tps = PerfCtrsTicksPerSecond();
+   int         i;
+   char*       sep;
+
+   fprintf(out, "name,type,parent,events,total,seconds,self_seconds,histogram\n");
+   for(ctr = perf_ctrs; ctr; ctr = ctr->next)
+   {
+      parent = perf_ctr_parent_name(ctr);
+      fprintf(out, "%s,%s,%s,%lld,%lld,", ctr->name,
+              perf_ctr_type_name(ctr), parent?parent:"",
+              ctr->events, ctr->total);
+      if(ctr->type == PCTimer)
+      {
+         fprintf(out, "%f,%f,", ctr->total/tps, (ctr->total-ctr->child)/tps);
+      }
+      else
+      {
+         fprintf(out, ",,");
+      }
+      sep = "";
+      for(i=0; i<PERF_CTR_HIST_SIZE; i++)
+      {
+         if(ctr->hist[i])
+         {
+            fprintf(out, "%s%d:%lld", sep, i, ctr->hist[i]);
+            sep = ";";
+         }
+      }
+      fprintf(out, "\n");
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsDump()
+//
+//   Write all counters to the dump file given to PerfCtrsEnable() (if
+//   any), and clear PerfCtrsDumpRequested. Timers that are running
+//   are included with the completed intervals only.
+//
+// Global Variables: dump_file, dump_pid, PerfCtrsDumpRequested
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsDump(void)
+{
+   char   name[MAXPATHLEN];
+   FILE*  out;
+   size_t len;
+
+   PerfCtrsDumpRequested = 0;
+   if(!dump_file)
+   {
+      return;
+   }
+   if(strcmp(dump_file, "-")==0)
+   {
+      out = stderr;
+   }
+   else
+   {
+      if(getpid() == dump_pid)
+      {
+         snprintf(name, MAXPATHLEN, "%s", dump_file);
+      }
+      else
+      {
+         snprintf(name, MAXPATHLEN, "%s.%ld", dump_file, (long)getpid());
+      }
+      out = fopen(name, "w");
+      if(!out)
+      {
+         TmpErrno = errno;
+         SysError("Cannot open performance counter file %s", FILE_ERROR,
+                  name);
+      }
+   }
+   len = strlen(dump_file);
+   if(len > 4 && strcmp(dump_file+len-4, ".csv")==0)
+   {
+      PerfCtrsDumpCSV(out);
+   }
+   else
+   {
+      PerfCtrsDumpJSON(out);
+   }
+   if(out == stderr)
+   {
+      fflush(out);
+   }
+   else
+   {
+      fclose(out);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsSignalHandler()
+//
+//   Request a dump of the counters. The dump itself happens at the
+//   next call of PerfCtrsDump() from the main loop, as output is not
+//   safe in a signal handler.
+//
+// Global Variables: PerfCtrsDumpRequested
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsSignalHandler(int mysignal)
+{
+   PerfCtrsDumpRequested = 1;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
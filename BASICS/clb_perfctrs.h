@@ -0,0 +1,257 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_perfctrs.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Performance counters for self-profiling. A counter is a global
+  PerfCtrCell defined with PERF_CTR_DEFINE(). It is either used as a
+  timer (PERF_CTR_ENTRY()/PERF_CTR_EXIT()) or to collect sampled
+  values (PERF_CTR_SAMPLE()). For both, the number of events, the sum
+  and a histogram over the binary logarithm of the values are
+  recorded.
+
+  Counters are compiled in by default, but cost only a test of
+  PerfCtrsEnabled unless they are enabled at run time with
+  PerfCtrsEnable(). Timers use the time stamp counter of the CPU
+  where available, and are nested: Time spent in a timer that is
+  entered while another one is running is attributed to that other
+  timer as child time, so that the self time of the phases of the
+  proof procedure can be computed. Counters register themselves when
+  they are first used, and all registered counters can be dumped in
+  JSON or CSV format at exit or on request (SIGUSR1).
+
+  Define NO_PERF_CTR to compile the counters out completely.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 04:12:38 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_PERFCTRS
+
+#define CLB_PERFCTRS
+
+#include <signal.h>
+#include <time.h>
+#include <clb_error.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define PERF_CTR_HIST_SIZE 64
+
+typedef enum
+{
+   PCUnused,
+   PCTimer,   /* Values are ticks */
+   PCSample   /* Values are arbitrary non-negative numbers */
+}PerfCtrType;
+
+typedef struct perfctrcell
+{
+   const char         *name;
+   PerfCtrType        type;
+   bool               registered;
+   int                depth;       /* Of open (recursive) entries */
+   long long          start;       /* Tick count at outermost entry */
+   long long          events;
+   long long          total;       /* Sum of values/ticks */
+   long long          child;       /* Ticks spent in nested timers */
+   struct perfctrcell *outer;      /* Enclosing timer of open entry */
+   struct perfctrcell *parent;     /* Enclosing timer of first entry */
+   bool               mixed;       /* Entered under different timers */
+   long long          hist[PERF_CTR_HIST_SIZE];
+   struct perfctrcell *next;       /* In the registry */
+}PerfCtrCell, *PerfCtr_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern bool                  PerfCtrsEnabled;
+extern volatile sig_atomic_t PerfCtrsDumpRequested;
+extern PerfCtr_p             PerfCtrCurrent;
+
+#define PERF_CTR_INIT(name) {(name), PCUnused, false, 0, 0, 0, 0, 0, \
+                             NULL, NULL, false, {0}, NULL}
+
+#ifndef NO_PERF_CTR
+#define PERF_CTR_DEFINE(name)  PerfCtrCell name = PERF_CTR_INIT(#name)
+#define PERF_CTR_DECL(name)    extern PerfCtrCell name
+#define PERF_CTR_RESET(name)   PerfCtrReset(&(name))
+#define PERF_CTR_ENTRY(name)   do{if(UNLIKELY(PerfCtrsEnabled)){PerfCtrEntry(&(name));}}while(0)
+#define PERF_CTR_EXIT(name)    do{if(UNLIKELY(PerfCtrsEnabled)){PerfCtrExit(&(name));}}while(0)
+#define PERF_CTR_SAMPLE(name, value) do{if(UNLIKELY(PerfCtrsEnabled)){PerfCtrRecord(&(name),(value));}}while(0)
+#define PERF_CTR_PRINT(out, name) PerfCtrPrint((out), &(name))
+#else
+#define PERF_CTR_DEFINE(name)  enum { name##_store } // Used to silence compiler warnings
+#define PERF_CTR_DECL(name)    enum { name }         // about extra semicolons.
+#define PERF_CTR_RESET(name)
+#define PERF_CTR_ENTRY(name)
+#define PERF_CTR_EXIT(name)
+#define PERF_CTR_SAMPLE(name, value)
+#define PERF_CTR_PRINT(out, name)
+#endif
+
+void   PerfCtrsEnable(char* dump_file_name);
+void   PerfCtrRegister(PerfCtr_p ctr);
+void   PerfCtrReset(PerfCtr_p ctr);
+double PerfCtrsTicksPerSecond(void);
+
+void   PerfCtrPrint(FILE* out, PerfCtr_p ctr);
+void   PerfCtrsPrint(FILE* out);
+void   PerfCtrsDumpJSON(FILE* out);
+void   PerfCtrsDumpCSV(FILE* out);
+void   PerfCtrsDump(void);
+void   PerfCtrsSignalHandler(int mysignal);
+
+static __inline__ long long PerfCtrTicks(void);
+static __inline__ void      PerfCtrRecord(PerfCtr_p ctr, long long value);
+static __inline__ void      PerfCtrEntry(PerfCtr_p ctr);
+static __inline__ void      PerfCtrExit(PerfCtr_p ctr);
+
+
+/*---------------------------------------------------------------------*/
+/*                     Inline functions                                */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTicks()
+//
+//   Return the current value of the time stamp counter, or, on
+//   machines without one, of the monotonic clock in nanoseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ long long PerfCtrTicks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+   return (long long)__builtin_ia32_rdtsc();
+#else
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (long long)now.tv_sec*1000000000LL+now.tv_nsec;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrRecord()
+//
+//   Record a single (non-negative) value for the counter.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes ctr, may register it.
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void PerfCtrRecord(PerfCtr_p ctr, long long value)
+{
+   if(UNLIKELY(!ctr->registered))
+   {
+      PerfCtrRegister(ctr);
+   }
+   if(ctr->type == PCUnused)
+   {
+      ctr->type = PCSample;
+   }
+   ctr->events++;
+   ctr->total += value;
+   ctr->hist[value>1?63-__builtin_clzll((unsigned long long)value):0]++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrEntry()
+//
+//   Start the timer ctr and make it the current one. Recursive
+//   entries are only counted once.
+//
+// Global Variables: PerfCtrCurrent
+//
+// Side Effects    : Changes ctr, may register it.
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void PerfCtrEntry(PerfCtr_p ctr)
+{
+   if(ctr->depth++)
+   {
+      return;
+   }
+   if(UNLIKELY(!ctr->registered))
+   {
+      PerfCtrRegister(ctr);
+      ctr->parent = PerfCtrCurrent;
+   }
+   else if(ctr->parent != PerfCtrCurrent)
+   {
+      ctr->mixed = true;
+   }
+   ctr->type  = PCTimer;
+   ctr->outer = PerfCtrCurrent;
+   PerfCtrCurrent = ctr;
+   ctr->start = PerfCtrTicks();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrExit()
+//
+//   Stop the timer ctr, record the elapsed ticks and charge them to
+//   the enclosing timer as child time.
+//
+// Global Variables: PerfCtrCurrent
+//
+// Side Effects    : Changes ctr and the enclosing timer.
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void PerfCtrExit(PerfCtr_p ctr)
+{
+   long long ticks;
+
+   if(ctr->depth == 0 || --ctr->depth)
+   {
+      /* Entered before the counters were enabled, or recursively */
+      return;
+   }
+   ticks = MAX(PerfCtrTicks()-ctr->start, 0);
+   PerfCtrRecord(ctr, ticks);
+   if(ctr->outer)
+   {
+      ctr->outer->child += ticks;
+   }
+   PerfCtrCurrent = ctr->outer;
+}
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
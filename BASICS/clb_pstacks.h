@@ -70,6 +70,8 @@ static __inline__ void     PStackPushInt(PStack_p stack, long val);
 static __inline__ void     PStackPushP(PStack_p stack, void* val);
 #define  PStackGetSP(stack) ((stack)->current)
 #define  PStackGetTopSP(stack) ((stack)->current-1)
+/* Only for shrinking the stack! */
+#define  PStackSetSP(stack, sp) ((stack)->current = (sp))
 
 static __inline__ IntOrP   PStackPop(PStack_p stack);
 #define  PStackPopInt(stack) (PStackPop(stack).i_val)
@@ -0,0 +1,271 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Open addressing hash tables with string keys.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 15:20:11 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "clb_strhash.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_table_alloc()
+//
+//   Allocate an array of size empty entries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static StrHashEntry_p strhash_table_alloc(long size)
+{
+   StrHashEntry_p table = SizeMalloc(size*sizeof(StrHashEntryCell));
+   long i;
+
+   for(i=0; i<size; i++)
+   {
+      table[i].key = NULL;
+   }
+   return table;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_find_slot()
+//
+//   Return the entry for key (with hash value hash) if it exists,
+//   otherwise the empty entry where it would be inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static StrHashEntry_p strhash_find_slot(StrHash_p htable, const char* key,
+                                        unsigned long hash)
+{
+   unsigned long  mask = htable->size-1;
+   unsigned long  i    = hash & mask;
+   StrHashEntry_p entry;
+
+   while(true)
+   {
+      entry = &(htable->table[i]);
+      if(!entry->key ||
+         (entry->hash == hash && strcmp(entry->key, key)==0))
+      {
+         return entry;
+      }
+      i = (i+1) & mask;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_grow()
+//
+//   Double the size of the table and rehash all entries (using the
+//   stored hash values).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void strhash_grow(StrHash_p htable)
+{
+   StrHashEntry_p old_table = htable->table, entry;
+   long           old_size  = htable->size, i;
+
+   htable->size  = 2*old_size;
+   htable->table = strhash_table_alloc(htable->size);
+
+   for(i=0; i<old_size; i++)
+   {
+      if(old_table[i].key)
+      {
+         entry = strhash_find_slot(htable, old_table[i].key,
+                                   old_table[i].hash);
+         *entry = old_table[i];
+      }
+   }
+   SizeFree(old_table, old_size*sizeof(StrHashEntryCell));
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashValue()
+//
+//   Return the hash value of key (FNV-1a).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long StrHashValue(const char* key)
+{
+   unsigned long hash = 2166136261UL;
+
+   while(*key)
+   {
+      hash ^= (unsigned char)*key;
+      hash *= 16777619UL;
+      key++;
+   }
+   return hash;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashAlloc()
+//
+//   Allocate an empty hash table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHash_p StrHashAlloc(void)
+{
+   StrHash_p handle = StrHashCellAlloc();
+
+   handle->size    = STRHASH_INIT_SIZE;
+   handle->entries = 0;
+   handle->table   = strhash_table_alloc(handle->size);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFree()
+//
+//   Free a hash table. Keys and values are not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StrHashFree(StrHash_p junk)
+{
+   assert(junk);
+
+   SizeFree(junk->table, junk->size*sizeof(StrHashEntryCell));
+   StrHashCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFind()
+//
+//   Return the entry for key, or NULL if key is not in the table.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashFind(StrHash_p htable, const char* key)
+{
+   StrHashEntry_p entry;
+
+   entry = strhash_find_slot(htable, key, StrHashValue(key));
+
+   return entry->key?entry:NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashInsert()
+//
+//   Insert key with value val into the table. If key already is in
+//   the table, return the old entry (and do not change it), otherwise
+//   return NULL. Entry pointers are only valid until the next
+//   insertion.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes table, memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashInsert(StrHash_p htable, char* key, IntOrP val)
+{
+   unsigned long  hash = StrHashValue(key);
+   StrHashEntry_p entry;
+
+   entry = strhash_find_slot(htable, key, hash);
+   if(entry->key)
+   {
+      return entry;
+   }
+   entry->key  = key;
+   entry->hash = hash;
+   entry->val  = val;
+   htable->entries++;
+
+   if(2*htable->entries > htable->size)
+   {
+      strhash_grow(htable);
+   }
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,80 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Hash tables with string keys and a single int or pointer value,
+  using open addressing with linear probing. Lookup does not need to
+  compare strings except on a full hash match, so this is preferable
+  to StrTrees for large, lookup-heavy indices (e.g. the signature)
+  that are never traversed in order.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 15:20:11 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_STRHASH
+
+#define CLB_STRHASH
+
+#include <clb_memory.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Keys are NOT owned by the table - they must stay valid as long as
+   the entry exists and are not touched when the table is freed. An
+   entry with key NULL is empty. */
+
+typedef struct strhashentrycell
+{
+   char          *key;
+   unsigned long hash;
+   IntOrP        val;
+}StrHashEntryCell, *StrHashEntry_p;
+
+typedef struct strhashcell
+{
+   long           size;    /* Always a power of 2 */
+   long           entries;
+   StrHashEntry_p table;
+}StrHashCell, *StrHash_p;
+
+#define STRHASH_INIT_SIZE 64
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define StrHashCellAlloc() (StrHashCell*)SizeMalloc(sizeof(StrHashCell))
+#define StrHashCellFree(junk)         SizeFree(junk, sizeof(StrHashCell))
+
+unsigned long  StrHashValue(const char* key);
+
+StrHash_p      StrHashAlloc(void);
+void           StrHashFree(StrHash_p junk);
+StrHashEntry_p StrHashFind(StrHash_p htable, const char* key);
+StrHashEntry_p StrHashInsert(StrHash_p htable, char* key, IntOrP val);
+
+#define StrHashEntries(htable) ((htable)->entries)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
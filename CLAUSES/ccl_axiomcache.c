@@ -0,0 +1,961 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_axiomcache.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Creation and loading of precompiled axiom files (see
+  ccl_axiomcache.h).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 14:02:37 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ccl_axiomcache.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Term properties that are recomputed (or only used temporarily) and
+   hence not stored in the cache. */
+
+#define AXCACHE_TRANSIENT_PROPS (TPIsShared|TPGarbageFlag|TPIsGround|\
+                                 TPSpecialFlag|TPOpFlag|TPCheckFlag|\
+                                 TPOutputFlag)
+
+/* Section pointers into a mapped cache file */
+
+typedef struct axcache_image_cell
+{
+   AxCacheHeader_p header;
+   AxCacheSymbol_p syms;
+   long*           sorts;
+   AxCacheNode_p   nodes;
+   long*           args;
+   AxCacheVar_p    vars;
+   AxCacheForm_p   forms;
+   char*           strs;
+}AxCacheImageCell, *AxCacheImage_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: str_store()
+//
+//   Append str (with the terminating '\0') to the string pool and
+//   return its offset.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long str_store(DStr_p pool, char* str)
+{
+   long res = DStrLen(pool);
+
+   DStrAppendBuffer(pool, str, strlen(str)+1);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sort_check()
+//
+//   Check that sort is one of the predefined sorts (user sorts are
+//   numbered in order of declaration and hence differ between
+//   problems).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool sort_check(long sort)
+{
+   return (sort > STNoSort) && (sort <= STPredefined);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: collect_form_vars()
+//
+//   Push the variables with external names in terms->vars (i.e. the
+//   variables of the formula just parsed) onto vars in the order of
+//   their creation, and record their index in var_index (indexed by
+//   -f_code).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void collect_form_vars(TB_p terms, PStack_p vars,
+                              PDArray_p var_index, DStr_p strs)
+{
+   PStack_p  stack, found = PStackAlloc();
+   StrTree_p cell;
+   Term_p    var;
+   long      i, j;
+
+   stack = StrTreeTraverseInit(terms->vars->ext_index);
+   while((cell = StrTreeTraverseNext(stack)))
+   {
+      PStackPushP(found, cell);
+   }
+   StrTreeTraverseExit(stack);
+
+   /* Fresh variables are allocated with decreasing f_codes - sort
+      by descending f_code (insertion sort, formulas have few
+      variables) */
+   for(i=1; i<PStackGetSP(found); i++)
+   {
+      cell = PStackElementP(found, i);
+      for(j=i; j>0; j--)
+      {
+         var = ((StrTree_p)PStackElementP(found, j-1))->val1.p_val;
+         if(var->f_code > ((Term_p)cell->val1.p_val)->f_code)
+         {
+            break;
+         }
+         PStackAssignP(found, j, PStackElementP(found, j-1));
+      }
+      PStackAssignP(found, j, cell);
+   }
+   for(i=0; i<PStackGetSP(found); i++)
+   {
+      cell = PStackElementP(found, i);
+      var  = cell->val1.p_val;
+      if(var->sort != SigDefaultSort(terms->sig))
+      {
+         Error("Axiom caches do not support sorted variables (%s)",
+               USAGE_ERROR, cell->key);
+      }
+      PDArrayAssignInt(var_index, -var->f_code,
+                       PStackGetSP(vars)/2+1);
+      PStackPushInt(vars, str_store(strs, cell->key));
+      PStackPushInt(vars, var->sort);
+   }
+   PStackFree(found);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: write_section()
+//
+//   Write the long values on stack to out.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static void write_section(FILE* out, PStack_p stack, char* name)
+{
+   PStackPointer i;
+   long          val;
+
+   for(i=0; i<PStackGetSP(stack); i++)
+   {
+      val = PStackElementInt(stack, i);
+      if(fwrite(&val, sizeof(long), 1, out)!=1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot write axiom cache %s", FILE_ERROR, name);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_str_valid()
+//
+//   Return true if off is a valid string offset in the image.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_str_valid(AxCacheImage_p img, long off)
+{
+   return (off >= 0) && (off < img->header->str_size);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_init()
+//
+//   Check the header of the mapped cache file against the source
+//   file read by in and the term bank, and set up the section
+//   pointers. Return true if the cache is usable so far.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_init(AxCacheImage_p img, char* map, long size,
+                       Scanner_p in, TB_p terms)
+{
+   AxCacheHeader_p hdr = (AxCacheHeader_p)map;
+   long            expected;
+
+   if((size < (long)sizeof(AxCacheHeaderCell)) ||
+      memcmp(hdr->magic, AXIOM_CACHE_MAGIC, sizeof(AXIOM_CACHE_MAGIC)) ||
+      (hdr->version != AXIOM_CACHE_VERSION) ||
+      (hdr->word_size != (long)sizeof(long)) ||
+      (hdr->format != ScannerGetFormat(in)) ||
+      (hdr->distinct_props != terms->sig->distinct_props) ||
+      (hdr->default_sort != SigDefaultSort(terms->sig)) ||
+      (hdr->src_size != in->source->data_len))
+   {
+      return false;
+   }
+   if((hdr->sym_no < 0)  || (hdr->sym_no > size)  ||
+      (hdr->sort_no < 0) || (hdr->sort_no > size) ||
+      (hdr->node_no < 0) || (hdr->node_no > size) ||
+      (hdr->arg_no < 0)  || (hdr->arg_no > size)  ||
+      (hdr->var_no < 0)  || (hdr->var_no > size)  ||
+      (hdr->form_no < 0) || (hdr->form_no > size) ||
+      (hdr->str_size < 1)|| (hdr->str_size > size))
+   {
+      return false;
+   }
+   expected = sizeof(AxCacheHeaderCell)
+      + hdr->sym_no*sizeof(AxCacheSymbolCell)
+      + hdr->sort_no*sizeof(long)
+      + hdr->node_no*sizeof(AxCacheNodeCell)
+      + hdr->arg_no*sizeof(long)
+      + hdr->var_no*sizeof(AxCacheVarCell)
+      + hdr->form_no*sizeof(AxCacheFormCell)
+      + hdr->str_size;
+   if(expected != size)
+   {
+      return false;
+   }
+   img->header = hdr;
+   img->syms   = (AxCacheSymbol_p)(hdr+1);
+   img->sorts  = (long*)(img->syms+hdr->sym_no);
+   img->nodes  = (AxCacheNode_p)(img->sorts+hdr->sort_no);
+   img->args   = (long*)(img->nodes+hdr->node_no);
+   img->vars   = (AxCacheVar_p)(img->args+hdr->arg_no);
+   img->forms  = (AxCacheForm_p)(img->vars+hdr->var_no);
+   img->strs   = (char*)(img->forms+hdr->form_no);
+
+   if(img->strs[hdr->str_size-1] != '\0')
+   {
+      return false;
+   }
+   return AxiomCacheHash(in->source->data, in->source->data_len)
+      == hdr->src_hash;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_check_symbols()
+//
+//   Check the symbol records and their compatibility with the
+//   symbols already in sig. Return true if all are ok.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_check_symbols(AxCacheImage_p img, Sig_p sig)
+{
+   AxCacheSymbol_p sym;
+   Type_p          type;
+   long            i, j, arity, *sorts;
+   FunCode         f;
+
+   for(i=0; i<img->header->sym_no; i++)
+   {
+      sym = &(img->syms[i]);
+      if(!image_str_valid(img, sym->name) || (sym->arity < 0))
+      {
+         return false;
+      }
+      sorts = NULL;
+      arity = 0;
+      if(sym->type != -1)
+      {
+         if((sym->type < 0) || (sym->type+2 > img->header->sort_no))
+         {
+            return false;
+         }
+         sorts = &(img->sorts[sym->type]);
+         arity = sorts[0];
+         if((arity < 0) || (sym->type+2+arity > img->header->sort_no))
+         {
+            return false;
+         }
+         for(j=1; j<=arity+1; j++)
+         {
+            if(!sort_check(sorts[j]))
+            {
+               return false;
+            }
+         }
+      }
+      f = SigFindFCode(sig, img->strs+sym->name);
+      if(f)
+      {
+         if(SigFindArity(sig, f) != sym->arity)
+         {
+            return false;
+         }
+         type = SigGetType(sig, f);
+         if(type && sorts)
+         {
+            if((type->arity != arity) || (type->domain_sort != sorts[1]))
+            {
+               return false;
+            }
+            for(j=0; j<arity; j++)
+            {
+               if(type->args[j] != sorts[j+2])
+               {
+                  return false;
+               }
+            }
+         }
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_check_nodes()
+//
+//   Check the node records in [start, end), where var_no variables
+//   are available for arguments. Return true if all are ok.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_check_nodes(AxCacheImage_p img, long start, long end,
+                              long var_no)
+{
+   AxCacheNode_p node;
+   long          i, j, arg;
+
+   for(i=start; i<end; i++)
+   {
+      node = &(img->nodes[i]);
+      if((node->f_code < 1) || (node->f_code > img->header->sym_no) ||
+         (node->arity != img->syms[node->f_code-1].arity) ||
+         !sort_check(node->sort) ||
+         (node->args < 0) || (node->args+node->arity > img->header->arg_no))
+      {
+         return false;
+      }
+      for(j=0; j<node->arity; j++)
+      {
+         arg = img->args[node->args+j];
+         if((arg >= i) || (arg < -var_no))
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_check()
+//
+//   Check the consistency of the cache image and its compatibility
+//   with sig. Return true if it can be replayed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_check(AxCacheImage_p img, Sig_p sig)
+{
+   AxCacheHeader_p hdr = img->header;
+   AxCacheForm_p   form;
+   long            i, node_pos, var_pos;
+
+   if(!image_check_symbols(img, sig))
+   {
+      return false;
+   }
+   for(i=0; i<hdr->var_no; i++)
+   {
+      if(!image_str_valid(img, img->vars[i].name) ||
+         (img->vars[i].sort != SigDefaultSort(sig)))
+      {
+         return false;
+      }
+   }
+   node_pos = hdr->form_no?img->forms[0].node_start:hdr->node_no;
+   if((node_pos < 0) || (node_pos > hdr->node_no) ||
+      !image_check_nodes(img, 0, node_pos, 0))
+   {
+      return false;
+   }
+   var_pos = 0;
+   for(i=0; i<hdr->form_no; i++)
+   {
+      form = &(img->forms[i]);
+      if(!image_str_valid(img, form->name) ||
+         (form->is_clause < 0) || (form->is_clause > 1) ||
+         (form->node_start != node_pos) ||
+         (form->node_end < node_pos) || (form->node_end > hdr->node_no) ||
+         (form->var_start != var_pos) ||
+         (form->var_end < var_pos) || (form->var_end > hdr->var_no) ||
+         (form->root < 0) || (form->root >= form->node_end) ||
+         !image_check_nodes(img, form->node_start, form->node_end,
+                            form->var_end-form->var_start))
+      {
+         return false;
+      }
+      node_pos = form->node_end;
+      var_pos  = form->var_end;
+   }
+   return (node_pos == hdr->node_no) && (var_pos == hdr->var_no);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_replay_nodes()
+//
+//   Insert the nodes [start, end) into terms, with variable arguments
+//   taken from vars.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes terms
+//
+/----------------------------------------------------------------------*/
+
+static void image_replay_nodes(AxCacheImage_p img, long start, long end,
+                               FunCode *fmap, Term_p *cells,
+                               Term_p *vars, TB_p terms)
+{
+   AxCacheNode_p node;
+   Term_p        t;
+   long          i, arg;
+   int           j;
+
+   for(i=start; i<end; i++)
+   {
+      node = &(img->nodes[i]);
+      t = TermTopAlloc(fmap[node->f_code], node->arity);
+      t->sort       = node->sort;
+      t->properties = node->properties;
+      for(j=0; j<node->arity; j++)
+      {
+         arg = img->args[node->args+j];
+         t->args[j] = (arg>=0)?cells[arg]:vars[-arg-1];
+      }
+      cells[i] = TBTermTopInsert(terms, t);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_replay()
+//
+//   Replay a checked cache image into terms and insert the formulas
+//   into fset. Variable handling and the allocation of clauses and
+//   formulas follow the parser, so that the result is identical to
+//   parsing the source file.
+//
+// Global Variables: ClausesHaveLocalVariables,
+//                   ClausesHaveDisjointVariables
+//
+// Side Effects    : Changes terms, fset
+//
+/----------------------------------------------------------------------*/
+
+static void image_replay(AxCacheImage_p img, char* source,
+                         FormulaSet_p fset, TB_p terms)
+{
+   AxCacheHeader_p hdr = img->header;
+   AxCacheSymbol_p sym;
+   AxCacheForm_p   form;
+   Sig_p           sig = terms->sig;
+   FunCode         *fmap;
+   Term_p          *cells, *vars;
+   SortType        *args;
+   WFormula_p      handle;
+   long            i, j, *sorts;
+
+   fmap  = SizeMalloc((hdr->sym_no+1)*sizeof(FunCode));
+   cells = SizeMalloc((hdr->node_no+1)*sizeof(Term_p));
+   vars  = SizeMalloc((hdr->var_no+1)*sizeof(Term_p));
+
+   for(i=0; i<hdr->sym_no; i++)
+   {
+      sym = &(img->syms[i]);
+      fmap[i+1] = SigInsertId(sig, img->strs+sym->name, sym->arity, false);
+      SigSetFuncProp(sig, fmap[i+1], sym->properties);
+      if((sym->type != -1) && !SigGetType(sig, fmap[i+1]))
+      {
+         sorts = &(img->sorts[sym->type]);
+         args  = TypeArgumentAlloc(sorts[0]+1);
+         for(j=0; j<sorts[0]; j++)
+         {
+            args[j] = sorts[j+2];
+         }
+         SigDeclareType(sig, fmap[i+1],
+                        TypeNewFunction(sig->type_table, sorts[1],
+                                        sorts[0], args));
+         TypeArgumentFree(args, sorts[0]+1);
+      }
+   }
+   image_replay_nodes(img, 0, hdr->form_no?img->forms[0].node_start:0,
+                      fmap, cells, vars, terms);
+
+   for(i=0; i<hdr->form_no; i++)
+   {
+      form = &(img->forms[i]);
+      if(form->is_clause && ClausesHaveLocalVariables)
+      {
+         VarBankClearExtNames(terms->vars);
+      }
+      if(ClausesHaveDisjointVariables)
+      {
+         VarBankClearExtNamesNoReset(terms->vars);
+      }
+      for(j=form->var_start; j<form->var_end; j++)
+      {
+         vars[j-form->var_start] =
+            VarBankExtNameAssertAlloc(terms->vars,
+                                      img->strs+img->vars[j].name);
+      }
+      image_replay_nodes(img, form->node_start, form->node_end,
+                         fmap, cells, vars, terms);
+      if(form->is_clause)
+      {
+         /* Keep the clause numbering in sync with the parser */
+         ClauseFree(ClauseAlloc(NULL));
+      }
+      handle = WTFormulaAlloc(terms, cells[form->root]);
+      handle->is_clause  = form->is_clause;
+      handle->properties = (FormulaProperties)form->properties;
+      handle->info       = ClauseInfoAlloc(img->strs+form->name, source,
+                                           form->line, form->column);
+      FormulaSetInsert(fset, handle);
+   }
+   SizeFree(fmap, (hdr->sym_no+1)*sizeof(FunCode));
+   SizeFree(cells, (hdr->node_no+1)*sizeof(Term_p));
+   SizeFree(vars, (hdr->var_no+1)*sizeof(Term_p));
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: AxiomCacheHash()
+//
+//   Return the 64 bit FNV-1a hash of data[0..len).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long AxiomCacheHash(char* data, long len)
+{
+   unsigned long res = 14695981039346656037UL;
+   long i;
+
+   for(i=0; i<len; i++)
+   {
+      res ^= (unsigned char)data[i];
+      res *= 1099511628211UL;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AxiomCacheCreate()
+//
+//   Parse the axiom file source (in the given format and with the
+//   given distinct object properties) into a fresh term bank and
+//   write the result to cache_name. Return the number of formulas
+//   and clauses cached. Terminates with an error if the file
+//   contains anything that cannot be cached (includes, typed
+//   formulas).
+//
+// Global Variables: ClausesHaveLocalVariables,
+//                   ClausesHaveDisjointVariables (temporarily
+//                   changed)
+//
+// Side Effects    : Input, output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long AxiomCacheCreate(char* source, IOFormat format,
+                      FunctionProperties distinct_props,
+                      char* cache_name)
+{
+   Scanner_p         in;
+   TB_p              terms;
+   Sig_p             sig;
+   WFormula_p        form;
+   AxCacheHeaderCell hdr;
+   Func_p            fun;
+   Term_p            *cells, t;
+   PStack_p          syms, sorts, nodes, args, vars, forms, stack;
+   PDArray_p         var_index;
+   DStr_p            strs;
+   FILE              *out;
+   bool              old_local = ClausesHaveLocalVariables;
+   bool              old_disjoint = ClausesHaveDisjointVariables;
+   long              i, j, form_no = 0, node_start, owner, var_start;
+   long              local;
+
+   if((format != TPTPFormat) && (format != TSTPFormat))
+   {
+      Error("Axiom caches require TPTP or TSTP format", USAGE_ERROR);
+   }
+   sig = SigAlloc(DefaultSortTableAlloc());
+   SigInsertInternalCodes(sig);
+   sig->distinct_props = distinct_props;
+   terms = TBAlloc(sig);
+
+   /* Make each formula's variables distinct, so that they can be
+      recreated according to the settings at load time. */
+   ClausesHaveLocalVariables    = false;
+   ClausesHaveDisjointVariables = true;
+
+   in = CreateScanner(StreamTypeFile, source, true, NULL);
+   if(!in->source->map_size)
+   {
+      Error("%s: Axiom caches require a regular, non-empty file",
+            USAGE_ERROR, source);
+   }
+   ScannerSetFormat(in, format);
+
+   syms      = PStackAlloc();
+   sorts     = PStackAlloc();
+   nodes     = PStackAlloc();
+   args      = PStackAlloc();
+   vars      = PStackAlloc();
+   forms     = PStackAlloc();
+   var_index = PDIntArrayAlloc(64, 0);
+   strs      = DStrAlloc();
+
+   while(TestInpId(in, "input_formula|input_clause|fof|cnf|tff|include"))
+   {
+      if(TestInpId(in, "include|tff"))
+      {
+         AktTokenError(in, "Axiom caches do not support includes or "
+                       "typed formulas", false);
+      }
+      node_start = terms->in_count;
+      var_start  = PStackGetSP(vars)/2;
+      if(TestInpId(in, "input_formula|fof"))
+      {
+         form = WFormulaParse(in, terms);
+      }
+      else
+      {
+         form = WFormClauseParse(in, terms);
+      }
+      if(TermIsVar(form->tformula))
+      {
+         Error("%s: Formula %s is a variable", USAGE_ERROR,
+               source, form->info->name);
+      }
+      collect_form_vars(terms, vars, var_index, strs);
+
+      PStackPushInt(forms, str_store(strs, form->info->name));
+      PStackPushInt(forms, form->info->line);
+      PStackPushInt(forms, form->info->column);
+      PStackPushInt(forms, form->properties);
+      PStackPushInt(forms, form->is_clause);
+      PStackPushInt(forms, node_start);
+      PStackPushInt(forms, terms->in_count);
+      PStackPushInt(forms, var_start);
+      PStackPushInt(forms, PStackGetSP(vars)/2);
+      PStackPushInt(forms, form->tformula->entry_no-1);
+      WFormulaFree(form);
+      form_no++;
+   }
+   CheckInpTok(in, NoToken);
+
+   for(i=1; i<=sig->f_count; i++)
+   {
+      fun = &(sig->f_info[i]);
+      PStackPushInt(syms, str_store(strs, fun->name));
+      PStackPushInt(syms, fun->arity);
+      PStackPushInt(syms, fun->properties);
+      if(fun->type)
+      {
+         PStackPushInt(syms, PStackGetSP(sorts));
+         PStackPushInt(sorts, fun->type->arity);
+         PStackPushInt(sorts, fun->type->domain_sort);
+         for(j=0; j<fun->type->arity; j++)
+         {
+            PStackPushInt(sorts, fun->type->args[j]);
+         }
+         for(j=PStackGetSP(sorts)-fun->type->arity-1;
+             j<PStackGetSP(sorts); j++)
+         {
+            if(!sort_check(PStackElementInt(sorts, j)))
+            {
+               Error("%s: Axiom caches do not support user-defined "
+                     "sorts (%s)", USAGE_ERROR, source, fun->name);
+            }
+         }
+      }
+      else
+      {
+         PStackPushInt(syms, -1);
+      }
+   }
+
+   /* Without garbage collection, the term nodes are numbered
+      densely in order of creation. */
+   cells = SizeMalloc((terms->in_count+1)*sizeof(Term_p));
+   memset(cells, 0, (terms->in_count+1)*sizeof(Term_p));
+   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   {
+      stack = TermTreeTraverseInit(terms->term_store.store[i]);
+      while((t = TermTreeTraverseNext(stack)))
+      {
+         assert(t->entry_no >= 1 && t->entry_no <= (long)terms->in_count);
+         cells[t->entry_no-1] = t;
+      }
+      TermTreeTraverseExit(stack);
+   }
+   owner = -1;
+   for(i=0; i<(long)terms->in_count; i++)
+   {
+      t = cells[i];
+      assert(t);
+      while((owner+1 < form_no) &&
+            (PStackElementInt(forms, (owner+1)*10+5) <= i))
+      {
+         owner++;
+      }
+      if(!sort_check(t->sort))
+      {
+         Error("%s: Axiom caches do not support user-defined sorts",
+               USAGE_ERROR, source);
+      }
+      PStackPushInt(nodes, t->f_code);
+      PStackPushInt(nodes, t->arity);
+      PStackPushInt(nodes, t->sort);
+      PStackPushInt(nodes, t->properties & ~AXCACHE_TRANSIENT_PROPS);
+      PStackPushInt(nodes, PStackGetSP(args));
+      for(j=0; j<t->arity; j++)
+      {
+         if(!TermIsVar(t->args[j]))
+         {
+            PStackPushInt(args, t->args[j]->entry_no-1);
+            continue;
+         }
+         local = -1;
+         if(owner >= 0 && (-t->args[j]->f_code < PDArraySize(var_index)))
+         {
+            local = PDArrayElementInt(var_index, -t->args[j]->f_code)-1
+               - PStackElementInt(forms, owner*10+7);
+         }
+         if((local < 0) ||
+            (local >= PStackElementInt(forms, owner*10+8)
+             - PStackElementInt(forms, owner*10+7)))
+         {
+            Error("%s: Axiom caches require named variables",
+                  USAGE_ERROR, source);
+         }
+         PStackPushInt(args, -local-1);
+      }
+   }
+   SizeFree(cells, (terms->in_count+1)*sizeof(Term_p));
+
+   memset(&hdr, 0, sizeof(AxCacheHeaderCell));
+   strcpy(hdr.magic, AXIOM_CACHE_MAGIC);
+   hdr.version        = AXIOM_CACHE_VERSION;
+   hdr.word_size      = sizeof(long);
+   hdr.format         = format;
+   hdr.distinct_props = distinct_props;
+   hdr.default_sort   = SigDefaultSort(sig);
+   hdr.src_size       = in->source->data_len;
+   hdr.src_hash       = AxiomCacheHash(in->source->data,
+                                       in->source->data_len);
+   hdr.sym_no         = PStackGetSP(syms)/4;
+   hdr.sort_no        = PStackGetSP(sorts);
+   hdr.node_no        = PStackGetSP(nodes)/5;
+   hdr.arg_no         = PStackGetSP(args);
+   hdr.var_no         = PStackGetSP(vars)/2;
+   hdr.form_no        = form_no;
+   hdr.str_size       = DStrLen(strs);
+
+   out = SecureFOpen(cache_name, "w");
+   if((fwrite(&hdr, sizeof(AxCacheHeaderCell), 1, out)!=1))
+   {
+      TmpErrno = errno;
+      SysError("Cannot write axiom cache %s", FILE_ERROR, cache_name);
+   }
+   write_section(out, syms, cache_name);
+   write_section(out, sorts, cache_name);
+   write_section(out, nodes, cache_name);
+   write_section(out, args, cache_name);
+   write_section(out, vars, cache_name);
+   write_section(out, forms, cache_name);
+   if(fwrite(DStrView(strs), 1, DStrLen(strs), out)!=(size_t)DStrLen(strs))
+   {
+      TmpErrno = errno;
+      SysError("Cannot write axiom cache %s", FILE_ERROR, cache_name);
+   }
+   SecureFClose(out);
+
+   DestroyScanner(in);
+   PStackFree(syms);
+   PStackFree(sorts);
+   PStackFree(nodes);
+   PStackFree(args);
+   PStackFree(vars);
+   PStackFree(forms);
+   PDArrayFree(var_index);
+   DStrFree(strs);
+
+   ClausesHaveLocalVariables    = old_local;
+   ClausesHaveDisjointVariables = old_disjoint;
+
+   SortTableFree(sig->sort_table);
+   SigFree(sig);
+   terms->sig = NULL;
+   TBFree(terms);
+
+   return form_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AxiomCacheLoad()
+//
+//   If the file read by in has a valid cache, replay it into terms
+//   and fset, set *count to the number of formulas and return
+//   true. Otherwise return false and leave everything unchanged. The
+//   scanner has to be freshly opened on a (mapped) file.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes terms and fset
+//
+/----------------------------------------------------------------------*/
+
+bool AxiomCacheLoad(Scanner_p in, FormulaSet_p fset, TB_p terms,
+                    long *count)
+{
+   AxCacheImageCell img;
+   DStr_p           cache_name;
+   struct stat      stat_buf;
+   char             *map = MAP_FAILED;
+   long             size = 0;
+   int              fd;
+   bool             res = false;
+
+   if(!in->source->map_size)
+   {
+      return false;
+   }
+   cache_name = DStrAlloc();
+   DStrAppendStr(cache_name, DStrView(in->source->source));
+   DStrAppendStr(cache_name, AXIOM_CACHE_SUFFIX);
+
+   fd = open(DStrView(cache_name), O_RDONLY);
+   if(fd != -1)
+   {
+      if((fstat(fd, &stat_buf)==0) && S_ISREG(stat_buf.st_mode) &&
+         (stat_buf.st_size > 0) &&
+         (stat_buf.st_size == (off_t)(long)stat_buf.st_size))
+      {
+         size = stat_buf.st_size;
+         map  = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      close(fd);
+   }
+   if(map != MAP_FAILED)
+   {
+      if(image_init(&img, map, size, in, terms) &&
+         image_check(&img, terms->sig))
+      {
+         image_replay(&img, DStrView(in->source->source), fset, terms);
+         *count = img.header->form_no;
+         res = true;
+         VERBOUTARG("Loaded axiom cache ", DStrView(cache_name));
+      }
+      else
+      {
+         VERBOUTARG("Ignoring stale or incompatible axiom cache ",
+                    DStrView(cache_name));
+      }
+      munmap(map, size);
+   }
+   DStrFree(cache_name);
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,148 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_axiomcache.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Precompiled axiom files. An axiom cache is a binary image of the
+  result of parsing an (untyped) TPTP/TSTP axiom file into a fresh
+  term bank: The signature, the shared term nodes in order of
+  creation, and the formulas and clauses with their names and source
+  positions. Caches are created by e_axcache and are stored next to
+  the axiom file (<file>.ecache). When an included file has a cache
+  that matches its size and content hash, the cache is mapped into
+  memory and replayed into the current term bank instead of lexing
+  and parsing the file again. Replaying creates exactly the same
+  symbols, term cells and formulas (including internal numbering)
+  that parsing the file would have created, so the rest of the
+  system cannot tell the difference.
+
+  The format is native (word size and byte order of the machine
+  that created it) and is rejected on mismatch.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 14:02:37 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_AXIOMCACHE
+
+#define CCL_AXIOMCACHE
+
+#include <ccl_formulasets.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define AXIOM_CACHE_SUFFIX  ".ecache"
+#define AXIOM_CACHE_MAGIC   "E-AXCACHE"
+#define AXIOM_CACHE_VERSION 1
+
+/* The file consists of the header, followed by the symbol records,
+   the sort pool, the node records, the argument pool, the variable
+   records, the formula records, and the string pool, each section
+   as a plain array. All references are indices into the respective
+   section. */
+
+typedef struct axcache_header_cell
+{
+   char          magic[16];
+   long          version;
+   long          word_size;
+   long          format;         /* IOFormat of the source */
+   long          distinct_props; /* Of the signature used */
+   long          default_sort;   /* Of the sort table used */
+   long          src_size;       /* Size of the source file... */
+   unsigned long src_hash;       /* ...and FNV-1a hash of its content */
+   long          sym_no;
+   long          sort_no;
+   long          node_no;
+   long          arg_no;
+   long          var_no;
+   long          form_no;
+   long          str_size;
+}AxCacheHeaderCell, *AxCacheHeader_p;
+
+
+/* Symbol f_code is stored at index f_code-1. type is the index of the
+   type in the sort pool (arity, domain sort, argument sorts), or -1
+   if the symbol has no type. */
+
+typedef struct axcache_symbol_cell
+{
+   long name;
+   long arity;
+   long properties;
+   long type;
+}AxCacheSymbolCell, *AxCacheSymbol_p;
+
+
+/* Term node with entry_no n is stored at index n-1. Arguments are
+   stored in the argument pool starting at args. A non-negative
+   argument is the index of a (previous) node, a negative argument -i
+   is the (i-1)th variable of the formula the node belongs to. */
+
+typedef struct axcache_node_cell
+{
+   long f_code;
+   long arity;
+   long sort;
+   long properties;
+   long args;
+}AxCacheNodeCell, *AxCacheNode_p;
+
+
+typedef struct axcache_var_cell
+{
+   long name;
+   long sort;
+}AxCacheVarCell, *AxCacheVar_p;
+
+
+/* Parsing the formula created the nodes [node_start, node_end) and
+   the variables [var_start, var_end) (in this order). */
+
+typedef struct axcache_form_cell
+{
+   long name;
+   long line;
+   long column;
+   long properties;
+   long is_clause;
+   long node_start;
+   long node_end;
+   long var_start;
+   long var_end;
+   long root;
+}AxCacheFormCell, *AxCacheForm_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+unsigned long AxiomCacheHash(char* data, long len);
+
+long AxiomCacheCreate(char* source, IOFormat format,
+                      FunctionProperties distinct_props,
+                      char* cache_name);
+bool AxiomCacheLoad(Scanner_p in, FormulaSet_p fset, TB_p terms,
+                    long *count);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
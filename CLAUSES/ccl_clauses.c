@@ -1565,21 +1565,15 @@ void ClauseTSTPPrint(FILE* out, Clause_p clause, bool fullterms, bool complete)
     break;
    }
    source = ClauseQueryCSSCPASource(clause);
-   if(clause->ident >= 0)
-   {
-      fprintf(out, "%s(c_%d_%ld,",
-         kind,
-         source,
-         clause->ident);
-   }
-   else
-   {
-      fprintf(out, "%s(i_%d_%ld,",
-         kind,
-         source,
-         clause->ident-LONG_MIN);
-   }
-   fprintf(out, "%s,", typename);
+   fputs(kind, out);
+   fputs((clause->ident >= 0)?"(c_":"(i_", out);
+   OutLong(out, source);
+   putc('_', out);
+   OutLong(out, (clause->ident >= 0)?
+           clause->ident:clause->ident-LONG_MIN);
+   putc(',', out);
+   fputs(typename, out);
+   putc(',', out);
 
    if (is_untyped)
    {
@@ -116,9 +116,11 @@ typedef enum
                                            * and hence can only be
                                            * rewritten in limited
                                            * ways. */
-   CPIsRelevant     = 2*CPLimitedRW       /* Clause is selected as
+   CPIsRelevant     = 2*CPLimitedRW,      /* Clause is selected as
                                            * relevant for a proof
                                            * attempt (used by SInE). */
+   CPIsWIndexed     = 2*CPIsRelevant      /* Clause is in the
+                                           * watchlist index */
 }FormulaProperties;
 
 
@@ -335,6 +335,7 @@ ClauseSet_p ClauseSetAlloc(void)
    SysDateInc(&handle->date);
    handle->demod_index = NULL;
    handle->fvindex = NULL;
+   handle->watch_index = NULL;
 
    handle->eval_indices = PDArrayAlloc(4,4);
    handle->eval_no = 0;
@@ -397,6 +398,10 @@ void ClauseSetFree(ClauseSet_p junk)
    {
       FVIAnchorFree(junk->fvindex);
    }
+   if(junk->watch_index)
+   {
+      WatchIndexFree(junk->watch_index);
+   }
    PDArrayFree(junk->eval_indices);
    ClauseCellFree(junk->anchor);
    DStrFree(junk->identifier);
@@ -598,6 +603,11 @@ void ClauseSetIndexedInsert(ClauseSet_p set, FVPackedClause_p newclause)
       FVIndexInsert(set->fvindex, newclause);
       ClauseSetProp(newclause->clause, CPIsSIndexed);
    }
+   if(set->watch_index)
+   {
+      WatchIndexInsert(set->watch_index, newclause->clause);
+      ClauseSetProp(newclause->clause, CPIsWIndexed);
+   }
 }
 
 
@@ -688,6 +698,15 @@ Clause_p ClauseSetExtractEntry(Clause_p clause)
       FVIndexDelete(clause->set->fvindex, clause);
       ClauseDelProp(clause, CPIsSIndexed);
    }
+   if(ClauseQueryProp(clause, CPIsWIndexed))
+   {
+      /* Copies of watch clauses inherit the property */
+      if(clause->set->watch_index)
+      {
+         WatchIndexDelete(clause->set->watch_index, clause);
+      }
+      ClauseDelProp(clause, CPIsWIndexed);
+   }
    clause_set_extract_entry(clause);
    return clause;
 }
@@ -722,6 +741,42 @@ Clause_p ClauseSetExtractFirst(ClauseSet_p set)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetRotateFirst()
+//
+//   Move the first clause of set to the end of the clause list and
+//   return it (NULL if the set is empty). The evaluation indices are
+//   not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause order in set
+//
+/----------------------------------------------------------------------*/
+
+Clause_p ClauseSetRotateFirst(ClauseSet_p set)
+{
+   Clause_p handle;
+
+   if(ClauseSetEmpty(set))
+   {
+      return NULL;
+   }
+   handle = set->anchor->succ;
+   assert(handle->set == set);
+
+   handle->pred->succ = handle->succ;
+   handle->succ->pred = handle->pred;
+   handle->succ = set->anchor;
+   handle->pred = set->anchor->pred;
+   set->anchor->pred->succ = handle;
+   set->anchor->pred = handle;
+
+   return handle;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetDeleteEntry()
@@ -1454,6 +1509,46 @@ void ClauseSetRemoveEvaluations(ClauseSet_p set)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetRebuildEvalIndex()
+//
+//   Rebuild the evaluation index at pos from scratch from the current
+//   evaluations of the clauses in set. Use this after changing these
+//   evaluations in bulk (the old index is invalid then and is
+//   simply dropped).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetRebuildEvalIndex(ClauseSet_p set, int pos)
+{
+   Eval_p   *array;
+   long     size = 0;
+   Clause_p handle;
+
+   if(ClauseSetEmpty(set))
+   {
+      PDArrayAssignP(set->eval_indices, pos, NULL);
+      return;
+   }
+   array = SizeMalloc(set->members*sizeof(Eval_p));
+   for(handle = set->anchor->succ; handle!=set->anchor;
+       handle=handle->succ)
+   {
+      if(handle->evaluations && (handle->evaluations->eval_no > pos))
+      {
+         array[size++] = handle->evaluations;
+      }
+   }
+   PDArrayAssignP(set->eval_indices, pos, EvalTreeBuild(array, size, pos));
+   SizeFree(array, set->members*sizeof(Eval_p));
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetFilterTrivial()
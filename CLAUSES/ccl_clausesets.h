@@ -32,6 +32,7 @@ Changes
 #include <ccl_fcvindexing.h>
 #include <ccl_tautologies.h>
 #include <ccl_pdtrees.h>
+#include <ccl_watchindex.h>
 #include <clb_plist.h>
 #include <clb_objtrees.h>
 
@@ -53,6 +54,7 @@ typedef struct clausesetcell
           checking for irreducability. */
    PDTree_p  demod_index; /* If used for demodulators */
    FVIAnchor_p fvindex; /* Used for non-unit subsumption */
+   WatchIndex_p watch_index; /* Used for watchlists */
    PDArray_p eval_indices;
    long      eval_no;
    DStr_p     identifier;
@@ -93,6 +95,7 @@ Clause_p    ClauseSetExtractEntry(Clause_p clause);
 #define     ClauseSetMoveClause(set, clause) \
             ClauseSetExtractEntry(clause);ClauseSetInsert((set), (clause))
 Clause_p    ClauseSetExtractFirst(ClauseSet_p set);
+Clause_p    ClauseSetRotateFirst(ClauseSet_p set);
 void        ClauseSetDeleteEntry(Clause_p clause);
 Clause_p    ClauseSetFindBest(ClauseSet_p set, int idx);
 void        ClauseSetPrint(FILE* out, ClauseSet_p set, bool
@@ -126,6 +129,9 @@ SysDate     ClauseSetListGetMaxDate(ClauseSet_p *demodulators, int
 Clause_p    ClauseSetFind(ClauseSet_p set, Clause_p clause);
 Clause_p    ClauseSetFindById(ClauseSet_p set, long ident);
 void        ClauseSetRemoveEvaluations(ClauseSet_p set);
+#define     ClauseSetEvalIndex(set, pos) \
+            ((Eval_p*)&(PDArrayElementP((set)->eval_indices, (pos))))
+void        ClauseSetRebuildEvalIndex(ClauseSet_p set, int pos);
 long        ClauseSetFilterTrivial(ClauseSet_p set);
 long        ClauseSetFilterTautologies(ClauseSet_p set, TB_p work_bank);
 
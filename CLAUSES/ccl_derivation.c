@@ -18,6 +18,9 @@ Changes
 
 <1> Sat Apr  6 10:58:29 CEST 2013
     New
+<2> Tue Oct 20 00:58:37 CEST 2026
+    Print additional premises (DCCnfAddArg) as part of the preceding
+    inference.
 
 -----------------------------------------------------------------------*/
 
@@ -66,7 +69,9 @@ char *opids[] =
    /* Others */
    PCL_SE,
    PCL_ID_DEF,
-   PCL_SC
+   PCL_SC,
+   PCL_SATREF,
+   NULL
 };
 
 char *optheory [] =
@@ -103,6 +108,8 @@ char *optheory [] =
    /* Others */
    NULL,
    NULL,
+   NULL,
+   NULL,
    NULL
 };
 
@@ -141,7 +148,9 @@ char *opstatus [] =
    /* Others */
    "thm",
    NULL,
-   "thm"
+   "thm",
+   "thm",
+   NULL
 };
 
 
@@ -210,6 +219,37 @@ int derived_compare(const void* p1, const void* p2)
    return PCmp(key1, key2);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: derivation_next_op()
+//
+//   Given the position of an operation in a derivation stack, return
+//   the position of the next operation.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static PStackPointer derivation_next_op(PStack_p derivation,
+                                        PStackPointer i)
+{
+   DerivationCodes op = PStackElementInt(derivation, i);
+
+   i++;
+   if(DCOpHasArg1(op))
+   {
+      i++;
+   }
+   if(DCOpHasArg2(op))
+   {
+      i++;
+   }
+   return i;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: derived_get_derivation()
@@ -891,6 +931,7 @@ void DerivStackCountSearchInferences(PStack_p derivation,
          case DCOrderedFactor:
          case DCEqFactor:
          case DCEqRes:
+         case DCSatRefutation:
                (*generating_count)++;
                break;
          case DCRewrite:
@@ -969,9 +1010,11 @@ void DerivationStackPCLPrint(FILE* out, Sig_p sig, PStack_p derivation)
       i  = 0;
       while(i<sp)
       {
-         PStackPushInt(subexpr_stack, i);
-
          op = PStackElementInt(derivation, i);
+         if(op != DCCnfAddArg)
+         {
+            PStackPushInt(subexpr_stack, i);
+         }
          i++;
          if(DCOpHasArg1(op))
          {
@@ -1021,6 +1064,15 @@ void DerivationStackPCLPrint(FILE* out, Sig_p sig, PStack_p derivation)
                        get_clauseform_id(op, 2, PStackElementP(derivation, i+2)));
             }
          }
+         for(j=derivation_next_op(derivation, i);
+             j<PStackGetSP(derivation) &&
+                PStackElementInt(derivation, j)==DCCnfAddArg;
+             j+=2)
+         {
+            fprintf(out, ", %ld",
+                    get_clauseform_id(DCCnfAddArg, 1,
+                                      PStackElementP(derivation, j+1)));
+         }
          switch(op)
          {
          case DCCnfQuote:
@@ -1079,9 +1131,11 @@ void DerivationStackTSTPPrint(FILE* out, Sig_p sig, PStack_p derivation)
       i  = 0;
       while(i<sp)
       {
-         PStackPushInt(subexpr_stack, i);
-
          op = PStackElementInt(derivation, i);
+         if(op != DCCnfAddArg)
+         {
+            PStackPushInt(subexpr_stack, i);
+         }
          i++;
          if(DCOpHasArg1(op))
          {
@@ -1135,6 +1189,15 @@ void DerivationStackTSTPPrint(FILE* out, Sig_p sig, PStack_p derivation)
                        tstp_get_clauseform_id(op, 2, PStackElementP(derivation, i+2)));
             }
          }
+         for(j=derivation_next_op(derivation, i);
+             j<PStackGetSP(derivation) &&
+                PStackElementInt(derivation, j)==DCCnfAddArg;
+             j+=2)
+         {
+            fprintf(out, ", %s",
+                    tstp_get_clauseform_id(DCCnfAddArg, 1,
+                                           PStackElementP(derivation, j+1)));
+         }
          switch(op)
          {
          case DCCnfQuote:
@@ -18,6 +18,9 @@ Changes
 
 <1> Thu Feb 14 00:21:15 CET 2013
     New
+<2> Tue Oct 20 00:58:37 CEST 2026
+    Added DOSatRefutation and DOAddArg for inferences with an
+    arbitrary number of premises.
 
 -----------------------------------------------------------------------*/
 
@@ -77,7 +80,11 @@ typedef enum
    /* CNF conversion and similar */
    DOSplitEquiv,
    DOIntroDef,
-   DOSplitConjunct
+   DOSplitConjunct,
+   /* Refutation of a ground abstraction by a SAT solver */
+   DOSatRefutation,
+   /* Pseudo-op: Additional premise of the preceding inference */
+   DOAddArg
 }OpCodes;
 
 
@@ -127,7 +134,9 @@ typedef enum
    /* CNF conversion and similar */
    DCSplitEquiv       = DOSplitEquiv|Arg1Fof,
    DCIntroDef         = DOIntroDef,
-   DCSplitConjunct    = DOSplitConjunct|Arg1Fof
+   DCSplitConjunct    = DOSplitConjunct|Arg1Fof,
+   DCSatRefutation    = DOSatRefutation|Arg1Cnf,
+   DCCnfAddArg        = DOAddArg|Arg1Cnf
 }DerivationCodes;
 
 
@@ -168,8 +168,8 @@ static long extract_generality(FunGen_p gen,  GeneralityMeasure gentype)
 //
 // function: compute_d_rel()
 //
-//   Find the least general of the function symbols in dist_array and
-//   push them onto res.
+//   Find the least general of the function symbols in
+//   symbol_stack[start...end-1] and push them onto res.
 //
 // Global Variables: -
 //
@@ -182,6 +182,8 @@ static void compute_d_rel(GenDistrib_p      generality,
                           double            benevolence,
                           long              generosity,
                           PStack_p          symbol_stack,
+                          PStackPointer     start,
+                          PStackPointer     end,
                           PStack_p          res)
 {
    FunCode       i;
@@ -192,7 +194,7 @@ static void compute_d_rel(GenDistrib_p      generality,
 
    sort_stack = PStackAlloc();
 
-   for(sp=0; sp < PStackGetSP(symbol_stack); sp++)
+   for(sp=start; sp < end; sp++)
    {
       i = PStackElementInt(symbol_stack, sp);
       if(i >= generality->sig->internal_symbols)
@@ -643,7 +645,8 @@ void ClauseComputeDRel(GenDistrib_p generality,
 
    /* printf("Symbolstack has %d elements\n",
       PStackGetSP(symbol_stack)); */
-   compute_d_rel(generality, gentype, benevolence, generosity, symbol_stack, res);
+   compute_d_rel(generality, gentype, benevolence, generosity,
+                 symbol_stack, 0, PStackGetSP(symbol_stack), res);
 
    while(!PStackEmpty(symbol_stack))
    {
@@ -681,7 +684,8 @@ void FormulaComputeDRel(GenDistrib_p generality,
 
    /* printf("Symbolstack has %d elements\n",
       PStackGetSP(symbol_stack)); */
-   compute_d_rel(generality, gentype, benevolence, generosity, symbol_stack, res);
+   compute_d_rel(generality, gentype, benevolence, generosity,
+                 symbol_stack, 0, PStackGetSP(symbol_stack), res);
 
    while(!PStackEmpty(symbol_stack))
    {
@@ -691,6 +695,35 @@ void FormulaComputeDRel(GenDistrib_p generality,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SymbolsComputeDRel()
+//
+//   Push the FCodes of functions in D-relation with an axiom whose
+//   (distinct) symbols are symbols[start...end-1] onto res. This is
+//   equivalent to ClauseComputeDRel()/FormulaComputeDRel() if the
+//   symbols are in the order of first occurrence in the axiom.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void SymbolsComputeDRel(GenDistrib_p generality,
+                        GeneralityMeasure gentype,
+                        double benevolence,
+                        long generosity,
+                        PStack_p symbols,
+                        PStackPointer start,
+                        PStackPointer end,
+                        PStack_p res)
+{
+   compute_d_rel(generality, gentype, benevolence, generosity,
+                 symbols, start, end, res);
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
@@ -120,6 +120,14 @@ void        FormulaComputeDRel(GenDistrib_p generality,
                                long generosity,
                                WFormula_p form,
                                PStack_p res);
+void        SymbolsComputeDRel(GenDistrib_p generality,
+                               GeneralityMeasure gentype,
+                               double benevolence,
+                               long generosity,
+                               PStack_p symbols,
+                               PStackPointer start,
+                               PStackPointer end,
+                               PStack_p res);
 
 #endif
 
@@ -31,6 +31,7 @@ Changes
 
 long global_formula_counter = LONG_MIN;
 long FormulaDefLimit        = TFORM_RENAME_LIMIT;
+long FormulaDefShareLimit   = 0;
 bool FormulasKeepInputNames = true;
 
 
@@ -56,6 +56,7 @@ typedef struct wformula_cell
 extern long FormulaIdentCounter;
 extern bool FormulaTermEncoding;
 extern long FormulaDefLimit;
+extern long FormulaDefShareLimit;
 
 #define FormulaSetProp(form, prop) SetProp((form), (prop))
 #define FormulaDelProp(form, prop) DelProp((form), (prop))
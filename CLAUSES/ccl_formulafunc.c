@@ -19,9 +19,15 @@ Changes
 
 <1> Sun Apr  4 14:12:05 CEST 2004
     New
+<2> Tue Oct 20 12:14:51 CEST 2026
+    Clausification in forked worker processes
 
 -----------------------------------------------------------------------*/
 
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <cio_signals.h>
 #include "ccl_formulafunc.h"
 
 
@@ -30,135 +36,1204 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Number of processes used by FormulaSetCNF() and FormulaSetCNF2() */
+
+int FormulaCNFWorkers = 1;
+
+/* Records in the stream from a clausification worker to the
+   parent. All items are longs. For each formula of its chunk that is
+   not a plain clause, the worker sends the symbols it created (in
+   order of creation), the resulting clauses, and a formula
+   record. Changes to older symbols follow at the end, together with
+   the final variable counters and the number of items sent before
+   the last one. Terms are sent in prefix notation with the worker's
+   f_codes and their sorts, variables as f_code and sort only. */
+
+#define CNF_REC_SYMBOL  1  /* f_code, kind, arity, properties, old
+                              properties, sort, type arity (or -1),
+                              argument sorts..., name length, name... */
+#define CNF_REC_CLAUSE  2  /* properties, lit_no, (properties, lterm,
+                              rterm)... */
+#define CNF_REC_FORMULA 3
+#define CNF_REC_END     4  /* v_count, fresh v_count, length */
+
+#define CNF_IO_BUFFER   4096 /* In longs */
+
+/* How the parent reproduces a symbol from a worker */
+
+typedef enum
+{
+   CNFSymOld,       /* Existing symbol with new type or properties */
+   CNFSymSkolem,    /* New Skolem symbol */
+   CNFSymPred,      /* New definition predicate */
+   CNFSymNamed      /* Any other new symbol */
+}CNFSymKind;
+
+typedef struct cnf_channel_cell
+{
+   int       fd;
+   pid_t     pid;
+   char      *buffer;
+   size_t    size;     /* Allocated bytes */
+   size_t    start;    /* First unread byte (reader) */
+   size_t    end;      /* First free byte */
+   long      count;    /* Items written (writer) */
+   bool      open;
+}CNFChannelCell, *CNFChannel_p;
+
+/* What a worker needs to know. forms contains the formulas in input
+   order, worker i handles forms[bounds[i]] up to (excluding)
+   forms[bounds[i+1]]. The parent replays the chunks in the same
+   order. */
+
+typedef struct cnf_work_cell
+{
+   ClauseSet_p clauseset;
+   TB_p        terms;
+   VarBank_p   fresh_vars;
+   GCAdmin_p   gc;
+   bool        new_cnf;
+   long        miniscope_limit;
+   WFormula_p  *forms;
+   long        bounds[CNF_MAX_WORKERS+1];
+   int         workers;
+   FunCode     old_symbols; /* f_count at the time of the fork */
+   long        old_nodes;
+   long        gc_threshold;
+}CNFWorkCell, *CNFWork_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
 
 
-/*---------------------------------------------------------------------*/
-/*                         Internal Functions                          */
-/*---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: answer_lit_alloc()
+//
+//   Allocate a FOF literal of the form ~$answer(skn(x1, ... xn)),
+//   where the xi are the variables on varstack and skn is a new
+//   skolem symbol.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes the term bank.
+//
+/----------------------------------------------------------------------*/
+
+TFormula_p answer_lit_alloc(TB_p terms, PStack_p varstack)
+{
+   TFormula_p res;
+   Term_p handle;
+
+   handle       = TBAllocNewSkolem(terms, varstack, STNoSort);
+   res          = TermTopAlloc(terms->sig->answer_code, 1);
+   res->args[0] = handle;
+   res          = TBTermTopInsert(terms, res);
+   res          = EqnTermsTBTermEncode(terms, res, terms->true_term, false, PENormal);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: verify_name()
+//
+//   If name_selector is NULL, return true. Otherwise, check if
+//   info->name is in name_selector. Return true if yes, false
+//   otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool verify_name(StrTree_p *name_selector, ClauseInfo_p info)
+{
+   StrTree_p handle;
+
+   if(!(*name_selector))
+   {
+      return true;
+   }
+   handle = StrTreeFind(name_selector, info->name);
+   if(!handle)
+   {
+      return false;
+   }
+   handle->val1.i_val = 1; /* Mark as found */
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: check_all_found()
+//
+//   Check if all names in name_selector are marked as found. Print a
+//   useful error message and terminate otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Possibly exit, memory operations.
+//
+/----------------------------------------------------------------------*/
+
+static void check_all_found(Scanner_p in, StrTree_p name_selector)
+{
+   PStack_p trav_stack, err_stack = PStackAlloc();
+   StrTree_p handle;
+
+   trav_stack = StrTreeTraverseInit(name_selector);
+
+   while((handle = StrTreeTraverseNext(trav_stack)))
+   {
+      if(!handle->val1.i_val)
+      {
+         PStackPushP(err_stack, handle->key);
+      }
+   }
+   StrTreeTraverseExit(trav_stack);
+
+   if(!PStackEmpty(err_stack))
+   {
+      DStr_p err_str = DStrAlloc();
+      char *sep = "";
+      PStackPointer i;
+
+      if(in->include_pos)
+      {
+         DStrSet(err_str, in->include_pos);
+         DStrAppendStr(err_str, " ");
+      }
+      DStrAppendStr(err_str, "\"include\" statement cannot "
+                    "find the following requested clauses/formulae in ");
+      DStrAppendDStr(err_str, Source(in));
+      DStrAppendStr(err_str, ": ");
+
+      for(i=0; i< PStackGetSP(err_stack); i++)
+      {
+         DStrAppendStr(err_str, sep);
+         DStrAppendStr(err_str, PStackElementP(err_stack, i));
+         sep = ", ";
+      }
+      Error(DStrView(err_str), INPUT_SEMANTIC_ERROR);
+      DStrFree(err_str);
+   }
+
+   PStackFree(err_stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: filter_selected()
+//
+//   Remove all formulas and clauses not named in name_selector from
+//   fset and cset, and check that all selected names have been found.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes sets, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static void filter_selected(Scanner_p in, ClauseSet_p cset,
+                            FormulaSet_p fset, StrTree_p *name_selector)
+{
+   WFormula_p form, nextform;
+   Clause_p   clause, nextclause;
+
+   form = fset->anchor->succ;
+   while(form!= fset->anchor)
+   {
+      nextform = form->succ;
+      if(!verify_name(name_selector, form->info))
+      {
+         FormulaSetDeleteEntry(form);
+      }
+      form = nextform;
+   }
+   clause = cset->anchor->succ;
+   while(clause!= cset->anchor)
+   {
+      nextclause = clause->succ;
+      if(!verify_name(name_selector, clause->info))
+      {
+         ClauseSetDeleteEntry(clause);
+      }
+      clause = nextclause;
+   }
+   check_all_found(in, *name_selector);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_formula_clausify()
+//
+//   Clausify form into set with the method selected for work.
+//
+// Global Variables: -
+//
+// Side Effects    : As WFormulaCNF()/WFormulaCNF2()
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_formula_clausify(CNFWork_p work, WFormula_p form,
+                                 ClauseSet_p set)
+{
+   if(work->new_cnf)
+   {
+      return WFormulaCNF2(form, set, work->terms, work->fresh_vars,
+                          work->miniscope_limit);
+   }
+   return WFormulaCNF(form, set, work->terms, work->fresh_vars);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_collect_garbage()
+//
+//   Collect garbage after form has been clausified if the term bank
+//   has grown too much, as in FormulaSetCNF2().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_collect_garbage(CNFWork_p work, WFormula_p form)
+{
+   if(form->tformula &&
+      (TBNonVarTermNodes(work->terms)>work->gc_threshold))
+   {
+      assert(work->terms == form->terms);
+      GCCollect(work->gc);
+      work->old_nodes = TBNonVarTermNodes(work->terms);
+      work->gc_threshold = work->old_nodes*TFORMULA_GC_LIMIT;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_chunk_serial()
+//
+//   Clausify the formulas of chunk in the parent process. Return
+//   number of clauses generated.
+//
+// Global Variables: -
+//
+// Side Effects    : As FormulaSetCNF2()
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_chunk_serial(CNFWork_p work, int chunk)
+{
+   WFormula_p handle;
+   long       i, res = 0;
+
+   for(i=work->bounds[chunk]; i<work->bounds[chunk+1]; i++)
+   {
+      handle = work->forms[i];
+      FormulaSetExtractEntry(handle);
+      res += cnf_formula_clausify(work, handle, work->clauseset);
+      cnf_collect_garbage(work, handle);
+      WFormulaFree(handle);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_generated_name()
+//
+//   Return true if name is of the form <prefix><count>_<arity>, as
+//   created by SigGetNewSkolemCode() and SigGetNewPredicateCode().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool cnf_generated_name(char* name, char* prefix)
+{
+   size_t len = strlen(prefix);
+   int    i;
+
+   if(strncmp(name, prefix, len) != 0)
+   {
+      return false;
+   }
+   name += len;
+   for(i=0; i<2; i++)
+   {
+      if(!isdigit((unsigned char)*name))
+      {
+         return false;
+      }
+      while(isdigit((unsigned char)*name))
+      {
+         name++;
+      }
+      if(*name != (i?'\0':'_'))
+      {
+         return false;
+      }
+      name++;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_init()
+//
+//   Initialize a channel to or from a clausification worker.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_init(CNFChannel_p ch, int fd, pid_t pid)
+{
+   ch->fd     = fd;
+   ch->pid    = pid;
+   ch->size   = CNF_IO_BUFFER*sizeof(long);
+   ch->buffer = SecureMalloc(ch->size);
+   ch->start  = 0;
+   ch->end    = 0;
+   ch->count  = 0;
+   ch->open   = true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_flush()
+//
+//   Write the buffered data of a worker channel. If this fails, the
+//   parent is gone, and the worker terminates.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate the process
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_flush(CNFChannel_p ch)
+{
+   size_t  done = 0;
+   ssize_t written;
+
+   while(done < ch->end)
+   {
+      written = write(ch->fd, ch->buffer+done, ch->end-done);
+      if(written < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         _exit(OTHER_ERROR);
+      }
+      done += written;
+   }
+   ch->end = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_put()
+//
+//   Append a value to the stream of a worker channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_put(CNFChannel_p ch, long value)
+{
+   if(ch->end+sizeof(long) > ch->size)
+   {
+      cnf_channel_flush(ch);
+   }
+   memcpy(ch->buffer+ch->end, &value, sizeof(long));
+   ch->end += sizeof(long);
+   ch->count++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_put_term()
+//
+//   Write a term in prefix notation.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_put_term(CNFChannel_p ch, Term_p term)
+{
+   int i;
+
+   cnf_channel_put(ch, term->f_code);
+   if(!TermIsVar(term))
+   {
+      cnf_channel_put(ch, term->arity);
+   }
+   cnf_channel_put(ch, term->sort);
+   for(i=0; i<term->arity; i++)
+   {
+      cnf_channel_put_term(ch, term->args[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_put_clause()
+//
+//   Write a clause record.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_put_clause(CNFChannel_p ch, Clause_p clause)
+{
+   Eqn_p handle;
+
+   cnf_channel_put(ch, CNF_REC_CLAUSE);
+   cnf_channel_put(ch, clause->properties);
+   cnf_channel_put(ch, ClauseLiteralNumber(clause));
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      cnf_channel_put(ch, handle->properties);
+      cnf_channel_put_term(ch, handle->lterm);
+      cnf_channel_put_term(ch, handle->rterm);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_put_symbol()
+//
+//   Write a symbol record for f. old_props are the properties of an
+//   existing symbol at the time of the fork. The type is only sent
+//   if with_type is true.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_put_symbol(CNFChannel_p ch, Sig_p sig, FunCode f,
+                                   CNFSymKind kind, long old_props,
+                                   bool with_type)
+{
+   Func_p info = &(sig->f_info[f]);
+   long   len, i, value;
+   int    j;
+
+   cnf_channel_put(ch, CNF_REC_SYMBOL);
+   cnf_channel_put(ch, f);
+   cnf_channel_put(ch, kind);
+   cnf_channel_put(ch, info->arity);
+   cnf_channel_put(ch, info->properties);
+   cnf_channel_put(ch, old_props);
+   if(with_type && info->type)
+   {
+      cnf_channel_put(ch, info->type->domain_sort);
+      cnf_channel_put(ch, info->type->arity);
+      for(j=0; j<info->type->arity; j++)
+      {
+         cnf_channel_put(ch, info->type->args[j]);
+      }
+   }
+   else
+   {
+      cnf_channel_put(ch, STNoSort);
+      cnf_channel_put(ch, -1);
+   }
+   len = (kind == CNFSymNamed)?strlen(info->name):0;
+   cnf_channel_put(ch, len);
+   for(i=0; i<len; i+=sizeof(long))
+   {
+      value = 0;
+      memcpy(&value, info->name+i, MIN(sizeof(long), len-i));
+      cnf_channel_put(ch, value);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_worker()
+//
+//   Clausify the formulas of chunk worker with the worker's private
+//   copy of the term bank and signature, and write the results to
+//   ch. Plain clauses are only clausified to keep the state in sync,
+//   the parent redoes them (it needs the clause information).
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes the (private) bank and signature
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_worker(CNFWork_p work, int worker, CNFChannel_p ch)
+{
+   Sig_p       sig = work->terms->sig;
+   ClauseSet_p tmp = ClauseSetAlloc();
+   PDArray_p   props = PDIntArrayAlloc(sig->f_count+1, 0);
+   PDArray_p   types = PDArrayAlloc(sig->f_count+1, 0);
+   FunCode     f, known = sig->f_count;
+   WFormula_p  handle;
+   Clause_p    clause;
+   CNFSymKind  kind;
+   long        i;
+   bool        changed_type;
+
+   for(f=1; f<=known; f++)
+   {
+      PDArrayAssignInt(props, f, sig->f_info[f].properties);
+      PDArrayAssignP(types, f, sig->f_info[f].type);
+   }
+   for(i=work->bounds[worker]; i<work->bounds[worker+1]; i++)
+   {
+      handle = work->forms[i];
+      FormulaSetExtractEntry(handle);
+      cnf_formula_clausify(work, handle, tmp);
+      if(handle->is_clause)
+      {
+         ClauseSetFreeClauses(tmp);
+      }
+      else
+      {
+         for(f=known+1; f<=sig->f_count; f++)
+         {
+            kind = CNFSymNamed;
+            if(cnf_generated_name(sig->f_info[f].name, "esk"))
+            {
+               kind = CNFSymSkolem;
+            }
+            else if(cnf_generated_name(sig->f_info[f].name, "epred"))
+            {
+               kind = CNFSymPred;
+            }
+            cnf_channel_put_symbol(ch, sig, f, kind, 0, true);
+            PDArrayAssignInt(props, f, sig->f_info[f].properties);
+            PDArrayAssignP(types, f, sig->f_info[f].type);
+         }
+         known = sig->f_count;
+         while((clause = ClauseSetExtractFirst(tmp)))
+         {
+            cnf_channel_put_clause(ch, clause);
+            ClauseFree(clause);
+         }
+         cnf_channel_put(ch, CNF_REC_FORMULA);
+      }
+      cnf_collect_garbage(work, handle);
+      WFormulaFree(handle);
+   }
+   for(f=1; f<=known; f++)
+   {
+      changed_type = (PDArrayElementP(types, f) != sig->f_info[f].type);
+      if(changed_type ||
+         PDArrayElementInt(props, f) != sig->f_info[f].properties)
+      {
+         cnf_channel_put_symbol(ch, sig, f, CNFSymOld,
+                                PDArrayElementInt(props, f), changed_type);
+      }
+   }
+   cnf_channel_put(ch, CNF_REC_END);
+   cnf_channel_put(ch, VarBankGetVCount(work->terms->vars));
+   cnf_channel_put(ch, VarBankGetVCount(work->fresh_vars));
+   cnf_channel_put(ch, ch->count);
+   cnf_channel_flush(ch);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_read()
+//
+//   Read whatever is available from a worker into the buffer of a
+//   parent channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations, may terminate with
+//                   error
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_channel_read(CNFChannel_p ch)
+{
+   ssize_t got;
+
+   if(ch->size-ch->end < CNF_IO_BUFFER*sizeof(long))
+   {
+      ch->size   = 2*ch->size;
+      ch->buffer = SecureRealloc(ch->buffer, ch->size);
+   }
+   got = read(ch->fd, ch->buffer+ch->end, ch->size-ch->end);
+   if(got < 0)
+   {
+      if(errno == EINTR)
+      {
+         return;
+      }
+      TmpErrno = errno;
+      SysError("Cannot read clausification worker results", SYS_ERROR);
+   }
+   if(got == 0)
+   {
+      ch->open = false;
+   }
+   ch->end += got;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_get()
+//
+//   Return the next buffered value of a parent channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Consumes the value
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_channel_get(CNFChannel_p ch)
+{
+   long res;
+
+   assert(ch->end-ch->start >= sizeof(long));
+   memcpy(&res, ch->buffer+ch->start, sizeof(long));
+   ch->start += sizeof(long);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_complete()
+//
+//   Return true if a closed parent channel contains the complete
+//   results of the worker, i.e. ends with an intact end record.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool cnf_channel_complete(CNFChannel_p ch)
+{
+   long items = ch->end/sizeof(long), length, tag;
+
+   if(ch->end%sizeof(long) || items < 4)
+   {
+      return false;
+   }
+   memcpy(&length, ch->buffer+(items-1)*sizeof(long), sizeof(long));
+   memcpy(&tag, ch->buffer+(items-4)*sizeof(long), sizeof(long));
+
+   return length == items-1 && tag == CNF_REC_END;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_map_symbol()
+//
+//   Map a worker f_code to the parent's f_code.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static FunCode cnf_map_symbol(CNFWork_p work, PDArray_p fmap, FunCode f)
+{
+   if(f <= work->old_symbols)
+   {
+      return f;
+   }
+   assert(PDArrayElementInt(fmap, f));
+   return PDArrayElementInt(fmap, f);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_channel_get_term()
+//
+//   Read a term in prefix notation and insert it into the term bank
+//   of work.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the term bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p cnf_channel_get_term(CNFWork_p work, CNFChannel_p ch,
+                                   PDArray_p fmap)
+{
+   FunCode f_code = cnf_channel_get(ch);
+   Term_p  handle;
+   int     i;
 
+   if(f_code < 0)
+   {
+      return VarBankVarAssertAlloc(work->terms->vars, f_code,
+                                   cnf_channel_get(ch));
+   }
+   i = cnf_channel_get(ch);
+   handle = TermTopAlloc(cnf_map_symbol(work, fmap, f_code), i);
+   handle->sort = cnf_channel_get(ch);
+   for(i=0; i<handle->arity; i++)
+   {
+      handle->args[i] = cnf_channel_get_term(work, ch, fmap);
+   }
+   return TBTermTopInsert(work->terms, handle);
+}
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: answer_lit_alloc()
+// Function: cnf_channel_get_clause()
 //
-//   Allocate a FOF literal of the form ~$answer(skn(x1, ... xn)),
-//   where the xi are the variables on varstack and skn is a new
-//   skolem symbol.
+//   Read the body of a clause record and return the clause.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, changes the term bank.
+// Side Effects    : Changes the term bank, memory operations
 //
 /----------------------------------------------------------------------*/
 
-TFormula_p answer_lit_alloc(TB_p terms, PStack_p varstack)
+static Clause_p cnf_channel_get_clause(CNFWork_p work, CNFChannel_p ch,
+                                       PDArray_p fmap)
 {
-   TFormula_p res;
-   Term_p handle;
+   long     properties = cnf_channel_get(ch);
+   long     lit_no = cnf_channel_get(ch), lit_props, i;
+   Eqn_p    list = NULL, lit;
+   EqnRef   tail = &list;
+   Term_p   lterm, rterm;
+   Clause_p clause;
 
-   handle       = TBAllocNewSkolem(terms, varstack, STNoSort);
-   res          = TermTopAlloc(terms->sig->answer_code, 1);
-   res->args[0] = handle;
-   res          = TBTermTopInsert(terms, res);
-   res          = EqnTermsTBTermEncode(terms, res, terms->true_term, false, PENormal);
+   for(i=0; i<lit_no; i++)
+   {
+      lit_props = cnf_channel_get(ch);
+      lterm = cnf_channel_get_term(work, ch, fmap);
+      rterm = cnf_channel_get_term(work, ch, fmap);
+      lit = EqnAlloc(lterm, rterm, work->terms, lit_props & EPIsPositive);
+      lit->properties = lit_props;
+      *tail = lit;
+      tail  = &(lit->next);
+   }
+   clause = ClauseAlloc(list);
+   clause->properties = properties;
 
-   return res;
+   return clause;
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: verify_name()
+// Function: cnf_channel_get_symbol()
 //
-//   If name_selector is NULL, return true. Otherwise, check if
-//   info->name is in name_selector. Return true if yes, false
-//   otherwise.
+//   Read the body of a symbol record and recreate the symbol (or its
+//   changes) in the parent's signature.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Changes the signature
 //
 /----------------------------------------------------------------------*/
 
-static bool verify_name(StrTree_p *name_selector, ClauseInfo_p info)
+static void cnf_channel_get_symbol(CNFWork_p work, CNFChannel_p ch,
+                                   PDArray_p fmap)
 {
-   StrTree_p handle;
-
-   if(!(*name_selector))
+   Sig_p      sig = work->terms->sig;
+   FunCode    local = cnf_channel_get(ch), f;
+   CNFSymKind kind = cnf_channel_get(ch);
+   int        arity = cnf_channel_get(ch);
+   long       props = cnf_channel_get(ch);
+   long       old_props = cnf_channel_get(ch);
+   SortType   sort = cnf_channel_get(ch), *args;
+   int        type_arity = cnf_channel_get(ch), i;
+   Type_p     type = NULL;
+   long       len, j, value;
+   DStr_p     name = DStrAlloc();
+
+   if(type_arity == 0)
    {
-      return true;
+      type = TypeNewConstant(sig->type_table, sort);
    }
-   handle = StrTreeFind(name_selector, info->name);
-   if(!handle)
+   else if(type_arity > 0)
    {
-      return false;
+      args = TypeArgumentAlloc(type_arity);
+      for(i=0; i<type_arity; i++)
+      {
+         args[i] = cnf_channel_get(ch);
+      }
+      type = TypeNewFunction(sig->type_table, sort, type_arity, args);
+      TypeArgumentFree(args, type_arity);
    }
-   handle->val1.i_val = 1; /* Mark as found */
-   return true;
+   len = cnf_channel_get(ch);
+   for(j=0; j<len; j+=sizeof(long))
+   {
+      value = cnf_channel_get(ch);
+      DStrAppendBuffer(name, (char*)&value, MIN(sizeof(long), len-j));
+   }
+   switch(kind)
+   {
+   case CNFSymSkolem:
+         f = SigGetNewSkolemCode(sig, arity);
+         break;
+   case CNFSymPred:
+         f = SigGetNewPredicateCode(sig, arity);
+         break;
+   case CNFSymNamed:
+         f = SigInsertId(sig, DStrView(name), arity, false);
+         break;
+   default:
+         /* Apply the worker's changes to the current properties */
+         f = cnf_map_symbol(work, fmap, local);
+         props = (sig->f_info[f].properties & ~(old_props & ~props))
+            | (props & ~old_props);
+         break;
+   }
+   if(kind != CNFSymOld)
+   {
+      PDArrayAssignInt(fmap, local, f);
+   }
+   sig->f_info[f].properties = props;
+   if(type)
+   {
+      sig->f_info[f].type = type;
+   }
+   DStrFree(name);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: check_all_found()
+// Function: cnf_chunk_replay()
 //
-//   Check if all names in name_selector are marked as found. Print a
-//   useful error message and terminate otherwise.
+//   Replay the results of a worker for its chunk in the parent, in the
+//   order of the formulas. Return number of clauses generated.
 //
 // Global Variables: -
 //
-// Side Effects    : Possibly exit, memory operations.
+// Side Effects    : Changes the clause set, term bank and signature
 //
 /----------------------------------------------------------------------*/
 
-static void check_all_found(Scanner_p in, StrTree_p name_selector)
+static long cnf_chunk_replay(CNFWork_p work, int chunk, CNFChannel_p ch)
 {
-   PStack_p trav_stack, err_stack = PStackAlloc();
-   StrTree_p handle;
+   PDArray_p  fmap = PDIntArrayAlloc(64, 0);
+   WFormula_p handle;
+   long       i, tag, res = 0;
 
-   trav_stack = StrTreeTraverseInit(name_selector);
+   for(i=work->bounds[chunk]; i<work->bounds[chunk+1]; i++)
+   {
+      handle = work->forms[i];
+      FormulaSetExtractEntry(handle);
+      if(handle->is_clause)
+      {
+         res += cnf_formula_clausify(work, handle, work->clauseset);
+      }
+      else
+      {
+         while((tag = cnf_channel_get(ch)) != CNF_REC_FORMULA)
+         {
+            if(tag == CNF_REC_SYMBOL)
+            {
+               cnf_channel_get_symbol(work, ch, fmap);
+            }
+            else
+            {
+               assert(tag == CNF_REC_CLAUSE);
+               ClauseSetInsert(work->clauseset,
+                               cnf_channel_get_clause(work, ch, fmap));
+               res++;
+            }
+         }
+      }
+      cnf_collect_garbage(work, handle);
+      WFormulaFree(handle);
+   }
+   while((tag = cnf_channel_get(ch)) == CNF_REC_SYMBOL)
+   {
+      cnf_channel_get_symbol(work, ch, fmap);
+   }
+   assert(tag == CNF_REC_END);
+   VarBankSetVCount(work->terms->vars, cnf_channel_get(ch));
+   VarBankSetVCount(work->fresh_vars, cnf_channel_get(ch));
+   PDArrayFree(fmap);
 
-   while((handle = StrTreeTraverseNext(trav_stack)))
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_run_workers()
+//
+//   Fork one worker per chunk of work, and replay their results in
+//   order as they become complete. Chunks of workers that fail are
+//   clausified in the parent. Return number of clauses generated.
+//
+// Global Variables: SilentTimeOut (in workers)
+//
+// Side Effects    : Forks, changes the clause set, term bank and
+//                   signature, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_run_workers(CNFWork_p work)
+{
+   CNFChannelCell channels[CNF_MAX_WORKERS];
+   struct pollfd  fds[CNF_MAX_WORKERS];
+   int            index[CNF_MAX_WORKERS];
+   int            pipefd[2], w, i, polled, next, status;
+   CNFChannel_p   ch;
+   struct rlimit  limit;
+   rlim_t         remaining = RLIM_INFINITY, used;
+   long           res = 0;
+
+   if(getrlimit(RLIMIT_CPU, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
    {
-      if(!handle->val1.i_val)
+      used = (rlim_t)GetTotalCPUTime();
+      remaining = (used >= limit.rlim_cur)?1:limit.rlim_cur-used;
+   }
+   fflush(GlobalOut);
+   fflush(stdout);
+   for(w=0; w<work->workers; w++)
+   {
+      if(pipe(pipefd) == -1)
       {
-         PStackPushP(err_stack, handle->key);
+         TmpErrno = errno;
+         SysError("Cannot create pipe for clausification worker", SYS_ERROR);
+      }
+      channels[w].pid = fork();
+      if(channels[w].pid == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot fork clausification worker", SYS_ERROR);
+      }
+      if(channels[w].pid == 0)
+      {
+         /* Child: Run silently, never touch the parent's output */
+         close(pipefd[0]);
+         for(i=0; i<w; i++)
+         {
+            close(channels[i].fd);
+         }
+         SilentTimeOut = true;
+         if(remaining != RLIM_INFINITY)
+         {
+            SetSoftRlimit(RLIMIT_CPU, remaining);
+         }
+         cnf_channel_init(&(channels[w]), pipefd[1], 0);
+         cnf_worker(work, w, &(channels[w]));
+         _exit(NO_ERROR);
       }
+      close(pipefd[1]);
+      cnf_channel_init(&(channels[w]), pipefd[0], channels[w].pid);
    }
-   StrTreeTraverseExit(trav_stack);
 
-   if(!PStackEmpty(err_stack))
+   next = 0;
+   while(next < work->workers)
    {
-      DStr_p err_str = DStrAlloc();
-      char *sep = "";
-      PStackPointer i;
+      ch = &(channels[next]);
+      if(!ch->open)
+      {
+         res += cnf_channel_complete(ch)?
+            cnf_chunk_replay(work, next, ch):
+            cnf_chunk_serial(work, next);
+         next++;
+         continue;
+      }
+      polled = 0;
+      for(w=next; w<work->workers; w++)
+      {
+         if(channels[w].open)
+         {
+            fds[polled].fd     = channels[w].fd;
+            fds[polled].events = POLLIN;
+            index[polled]      = w;
+            polled++;
+         }
+      }
+      if(poll(fds, polled, -1) == -1)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         TmpErrno = errno;
+         SysError("Cannot wait for clausification worker results",
+                  SYS_ERROR);
+      }
+      for(i=0; i<polled; i++)
+      {
+         if(fds[i].revents)
+         {
+            cnf_channel_read(&(channels[index[i]]));
+         }
+      }
+   }
 
-      if(in->include_pos)
+   for(w=0; w<work->workers; w++)
+   {
+      ch = &(channels[w]);
+      close(ch->fd);
+      while(waitpid(ch->pid, &status, 0) == -1)
       {
-         DStrSet(err_str, in->include_pos);
-         DStrAppendStr(err_str, " ");
+         if(errno != EINTR)
+         {
+            TmpErrno = errno;
+            SysError("Cannot wait for clausification worker", SYS_ERROR);
+         }
       }
-      DStrAppendStr(err_str, "\"include\" statement cannot "
-                    "find the following requested clauses/formulae in ");
-      DStrAppendDStr(err_str, Source(in));
-      DStrAppendStr(err_str, ": ");
+      FREE(ch->buffer);
+   }
+   return res;
+}
 
-      for(i=0; i< PStackGetSP(err_stack); i++)
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_worker_number()
+//
+//   Return the number of processes that should clausify set. Workers
+//   cannot document inferences or build proof objects, so both
+//   require serial clausification.
+//
+// Global Variables: FormulaCNFWorkers, BuildProofObject, OutputLevel
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cnf_worker_number(FormulaSet_p set)
+{
+   if(FormulaCNFWorkers <= 1 || BuildProofObject || OutputLevel >= 2)
+   {
+      return 1;
+   }
+   return MIN(FormulaCNFWorkers,
+              FormulaSetCardinality(set)/CNF_WORKER_MIN_FORMULAS);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: formula_set_cnf_parallel()
+//
+//   Clausify all formulas of set into clauseset with the given
+//   number of forked workers. Formulas are split into contiguous
+//   chunks of similar size, which are clausified by the workers with
+//   private copies of the term bank and signature. The parent
+//   replays the results in input order, creating the same symbols,
+//   terms and clauses as a serial run. Return number of clauses
+//   generated.
+//
+// Global Variables: -
+//
+// Side Effects    : Forks, empties set, changes clauseset, terms and
+//                   the signature, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long formula_set_cnf_parallel(FormulaSet_p set,
+                                     ClauseSet_p clauseset, TB_p terms,
+                                     VarBank_p fresh_vars, GCAdmin_p gc,
+                                     bool new_cnf, long miniscope_limit,
+                                     int workers)
+{
+   CNFWorkCell work;
+   WFormula_p  handle;
+   long        count = FormulaSetCardinality(set), i, total = 0, acc = 0;
+   long        res;
+   int         w;
+
+   work.clauseset       = clauseset;
+   work.terms           = terms;
+   work.fresh_vars      = fresh_vars;
+   work.gc              = gc;
+   work.new_cnf         = new_cnf;
+   work.miniscope_limit = miniscope_limit;
+   work.forms           = SizeMalloc(count*sizeof(WFormula_p));
+   work.workers         = workers;
+   work.old_symbols     = terms->sig->f_count;
+   work.old_nodes       = TBNonVarTermNodes(terms);
+   work.gc_threshold    = work.old_nodes*TFORMULA_GC_LIMIT;
+
+   for(i=0, handle = set->anchor->succ;
+       handle != set->anchor;
+       i++, handle = handle->succ)
+   {
+      work.forms[i] = handle;
+      total += handle->tformula?TermStandardWeight(handle->tformula):1;
+   }
+   /* Balance chunks by formula size */
+   w = 0;
+   work.bounds[0] = 0;
+   for(i=0; i<count; i++)
+   {
+      handle = work.forms[i];
+      acc += handle->tformula?TermStandardWeight(handle->tformula):1;
+      while(w+1 < workers && acc*workers >= total*(w+1))
       {
-         DStrAppendStr(err_str, sep);
-         DStrAppendStr(err_str, PStackElementP(err_stack, i));
-         sep = ", ";
+         work.bounds[++w] = i+1;
       }
-      Error(DStrView(err_str), INPUT_SEMANTIC_ERROR);
-      DStrFree(err_str);
    }
+   while(w < workers)
+   {
+      work.bounds[++w] = count;
+   }
+   res = cnf_run_workers(&work);
+   SizeFree(work.forms, count*sizeof(WFormula_p));
 
-   PStackFree(err_stack);
+   return res;
 }
 
 
@@ -542,9 +1617,11 @@ long FormulaSetSimplify(FormulaSet_p set, TB_p terms)
 // Function: FormulaSetCNF()
 //
 //   Transform all formulae in set into CNF. Return number of clauses
-//   generated.
+//   generated. With FormulaCNFWorkers > 1, large sets are clausified
+//   by forked workers (see formula_set_cnf_parallel()), with the
+//   same result.
 //
-// Global Variables: -
+// Global Variables: FormulaCNFWorkers
 //
 // Side Effects    : Plenty of memory stuff.
 //
@@ -558,12 +1635,20 @@ long FormulaSetCNF(FormulaSet_p set, FormulaSet_p archive,
    long res = 0;
    long old_nodes = TBNonVarTermNodes(terms);
    long gc_threshold = old_nodes*TFORMULA_GC_LIMIT;
+   int  workers;
 
    FormulaSetSimplify(set, terms);
    // printf("FormulaSetSimplify done\n");
    TFormulaSetIntroduceDefs(set, archive, terms);
    // printf("Definitions introduced\n");
 
+   workers = cnf_worker_number(set);
+   if(workers > 1)
+   {
+      res = formula_set_cnf_parallel(set, clauseset, terms, fresh_vars,
+                                     gc, false, 0, workers);
+   }
+
    while(!FormulaSetEmpty(set))
    {
       handle = FormulaSetExtractFirst(set);
@@ -607,9 +1692,11 @@ long FormulaSetCNF(FormulaSet_p set, FormulaSet_p archive,
 // Function: FormulaSetCNF2()
 //
 //   Transform all formulae in set into CNF. Return number of clauses
-//   generated.
+//   generated. With FormulaCNFWorkers > 1, large sets are clausified
+//   by forked workers (see formula_set_cnf_parallel()), with the
+//   same result.
 //
-// Global Variables: -
+// Global Variables: FormulaCNFWorkers
 //
 // Side Effects    : Plenty of memory stuff.
 //
@@ -623,10 +1710,18 @@ long FormulaSetCNF2(FormulaSet_p set, FormulaSet_p archive,
    long res = 0;
    long old_nodes = TBNonVarTermNodes(terms);
    long gc_threshold = old_nodes*TFORMULA_GC_LIMIT;
+   int  workers;
 
    TFormulaSetIntroduceDefs(set, archive, terms);
    // printf("# Definitions introduced\n");
 
+   workers = cnf_worker_number(set);
+   if(workers > 1)
+   {
+      res = formula_set_cnf_parallel(set, clauseset, terms, fresh_vars,
+                                     gc, true, miniscope_limit, workers);
+   }
+
    while(!FormulaSetEmpty(set))
    {
       handle = FormulaSetExtractFirst(set);
@@ -688,8 +1783,7 @@ long FormulaAndClauseSetParse(Scanner_p in, ClauseSet_p cset,
                               StrTree_p *skip_includes)
 {
    long res = 0;
-   WFormula_p form, nextform;
-   Clause_p   clause, nextclause;
+   WFormula_p form;
    StrTree_p  stand_in = NULL;
 
    if(!name_selector)
@@ -725,12 +1819,12 @@ long FormulaAndClauseSetParse(Scanner_p in, ClauseSet_p cset,
 
                if(new_in)
                {
-                  res += FormulaAndClauseSetParse(new_in,
-                                                  ncset,
-                                                  nfset,
-                                                  terms,
-                                                  &new_limit,
-                                                  skip_includes);
+                  res += FormulaAndClauseSetParseCached(new_in,
+                                                        ncset,
+                                                        nfset,
+                                                        terms,
+                                                        &new_limit,
+                                                        skip_includes);
                   DestroyScanner(new_in);
                }
                StrTreeFree(new_limit);
@@ -766,27 +1860,40 @@ long FormulaAndClauseSetParse(Scanner_p in, ClauseSet_p cset,
    }
    if(*name_selector)
    {
-      form = fset->anchor->succ;
-      while(form!= fset->anchor)
-      {
-         nextform = form->succ;
-         if(!verify_name(name_selector, form->info))
-         {
-            FormulaSetDeleteEntry(form);
-         }
-         form = nextform;
-      }
-      clause = cset->anchor->succ;
-      while(clause!= cset->anchor)
-      {
-         nextclause = clause->succ;
-         if(!verify_name(name_selector, clause->info))
-         {
-            ClauseSetDeleteEntry(clause);
-         }
-         clause = nextclause;
-      }
-      check_all_found(in, *name_selector);
+      filter_selected(in, cset, fset, name_selector);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FormulaAndClauseSetParseCached()
+//
+//   As FormulaAndClauseSetParse(), but use a valid axiom cache for
+//   the file read by in if one exists (see ccl_axiomcache.h).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes termbank and sets.
+//
+/----------------------------------------------------------------------*/
+
+long FormulaAndClauseSetParseCached(Scanner_p in, ClauseSet_p cset,
+                                    FormulaSet_p fset, TB_p terms,
+                                    StrTree_p *name_selector,
+                                    StrTree_p *skip_includes)
+{
+   long res;
+
+   if(!AxiomCacheLoad(in, fset, terms, &res))
+   {
+      return FormulaAndClauseSetParse(in, cset, fset, terms,
+                                      name_selector, skip_includes);
+   }
+   if(name_selector && *name_selector)
+   {
+      filter_selected(in, cset, fset, name_selector);
    }
    return res;
 }
@@ -873,6 +1980,53 @@ void TFormulaSetDelTermpProp(FormulaSet_p set, TermProperties prop)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: TFormulaSetFindSharedDefs()
+//
+//   Find all subformulas that would be replicated by clausification
+//   at least share_limit times in the whole set (counting each
+//   occurrence in each formula) and enter them into defs and
+//   renamed_forms. This catches subformulas that are reused across
+//   many formulas (as is typical for large axiom libraries) but are
+//   too small to be renamed in any single one.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes terms
+//
+/----------------------------------------------------------------------*/
+
+void TFormulaSetFindSharedDefs(FormulaSet_p set, TB_p terms,
+                               long share_limit, NumXTree_p *defs,
+                               PStack_p renamed_forms)
+{
+   WFormula_p handle;
+   NumXTree_p counts = NULL, cell;
+   PStack_p   stack;
+
+   for(handle = set->anchor->succ; handle!=set->anchor; handle =
+          handle->succ)
+   {
+      if(handle->tformula)
+      {
+         TFormulaCountSharedDefs(terms, handle->tformula, 1, &counts);
+      }
+   }
+   stack = NumXTreeTraverseInit(counts);
+   while((cell = NumXTreeTraverseNext(stack)))
+   {
+      if(cell->vals[0].i_val >= share_limit)
+      {
+         TFormulaDefRename(terms, cell->vals[2].p_val,
+                           cell->vals[1].i_val, defs, renamed_forms);
+      }
+   }
+   NumXTreeTraverseExit(stack);
+   NumXTreeFree(counts);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TFormulaSetFindDefs()
@@ -892,6 +2046,11 @@ void TFormulaSetFindDefs(FormulaSet_p set, TB_p terms, NumXTree_p *defs,
    WFormula_p handle;
 
    // printf("TFormulaSetFindDefs()...\n");
+   if(FormulaDefLimit && FormulaDefShareLimit)
+   {
+      TFormulaSetFindSharedDefs(set, terms, FormulaDefShareLimit,
+                                defs, renamed_forms);
+   }
    for(handle = set->anchor->succ; handle!=set->anchor; handle =
           handle->succ)
    {
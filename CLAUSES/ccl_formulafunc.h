@@ -19,6 +19,8 @@ Changes
 
 <1> Sun Apr  4 14:10:19 CEST 2004
     New
+<2> Tue Oct 20 12:14:51 CEST 2026
+    Parallel clausification
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ Changes
 
 #include <ccl_garbage_coll.h>
 #include <ccl_tcnf.h>
+#include <ccl_axiomcache.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -41,6 +44,15 @@ Changes
 
 #define TFORMULA_GC_LIMIT 1.5
 
+/* Clausification can be spread over up to CNF_MAX_WORKERS forked
+   processes, each of which gets at least CNF_WORKER_MIN_FORMULAS
+   formulas (see FormulaSetCNF2()). */
+
+#define CNF_MAX_WORKERS         64
+#define CNF_WORKER_MIN_FORMULAS 100
+
+extern int FormulaCNFWorkers;
+
 bool WFormulaConjectureNegate(WFormula_p wform);
 
 TFormula_p TFormulaAnnotateQuestion(TB_p terms,
@@ -77,12 +89,19 @@ long FormulaAndClauseSetParse(Scanner_p in, ClauseSet_p cset,
                               FormulaSet_p fset, TB_p terms,
                               StrTree_p *name_selector,
                               StrTree_p *skip_includes);
+long FormulaAndClauseSetParseCached(Scanner_p in, ClauseSet_p cset,
+                                    FormulaSet_p fset, TB_p terms,
+                                    StrTree_p *name_selector,
+                                    StrTree_p *skip_includes);
 long FormulaToCNF(WFormula_p form, FormulaProperties type,
                   ClauseSet_p set, TB_p terms, VarBank_p fresh_vars);
 long TFormulaToCNF(WFormula_p form, FormulaProperties type, ClauseSet_p set,
                    TB_p terms, VarBank_p fresh_vars);
 
 void TFormulaSetDelTermpProp(FormulaSet_p set, TermProperties prop);
+void TFormulaSetFindSharedDefs(FormulaSet_p set, TB_p terms,
+                               long share_limit, NumXTree_p *defs,
+                               PStack_p renamed_forms);
 void TFormulaSetFindDefs(FormulaSet_p set, TB_p terms, NumXTree_p *defs,
                          PStack_p renamed_forms);
 long TFormulaApplyDefs(WFormula_p form, TB_p terms, NumXTree_p *defs);
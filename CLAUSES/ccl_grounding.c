@@ -21,6 +21,9 @@ Changes
 
 <1> Tue May 29 02:25:12 CEST 2001
     New
+<2> Tue Oct 20 02:31:05 CEST 2026
+    Parallel grounding in forked worker processes, fixed
+    ClausePrintDimacs() ignoring out.
 
 -----------------------------------------------------------------------*/
 
@@ -32,6 +35,55 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Records in the stream from a grounding worker to the parent. All
+   items are longs. An atom record announces a worker-local literal
+   code together with the atom (in prefix notation as a sequence of
+   f_codes), a clause record lists signed local literal codes (as in
+   DIMACS), a next record follows the instances of each input clause,
+   the end record carries the final GroundSetState of the worker. */
+
+#define GROUND_REC_ATOM   1  /* code, length, f_codes... */
+#define GROUND_REC_CLAUSE 2  /* lit_no, codes... */
+#define GROUND_REC_END    3  /* GroundSetState */
+#define GROUND_REC_NEXT   4
+
+#define GROUND_IO_BUFFER  4096 /* In longs */
+
+typedef struct ground_channel_cell
+{
+   int       fd;
+   pid_t     pid;
+   char      *buffer;
+   size_t    size;     /* Allocated bytes */
+   size_t    start;    /* First unread byte (reader) */
+   size_t    end;      /* First free byte */
+   bool      open;
+   bool      done;     /* End record seen */
+   long      state;    /* ...and the state it reported */
+   long      clause;   /* First clause not completed (reader) */
+   PDArray_p atoms;    /* Worker: local code -> announced?
+                          Parent: local code -> atom term */
+}GroundChannelCell, *GroundChannel_p;
+
+/* What a worker needs to know. Workers get a copy-on-write view of
+   all of this, including the unit clauses of groundset at the time
+   of the fork, which they use read-only for simplification. */
+
+typedef struct ground_work_cell
+{
+   TB_p         bank;
+   GroundSet_p  groundset;
+   Clause_p     *clauses;
+   VarSetInst_p *insts;
+   long         first;    /* First clause handled by workers */
+   long         count;
+   bool         subsume;
+   bool         resolve;
+   bool         taut_check;
+   long         give_up;
+   int          workers;
+}GroundWorkCell, *GroundWork_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -232,6 +284,723 @@ void ground_set_print_unit(FILE* out, GroundSet_p set, long unit, bool
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ground_set_add_instance()
+//
+//   Simplify the ground clause new with the unit clauses in
+//   groundset and insert it unless it is subsumed. If it becomes
+//   empty, groundset is reduced to just the empty clause and false
+//   is returned, otherwise true. new is consumed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes groundset, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool ground_set_add_instance(GroundSet_p groundset, Clause_p new,
+                                    bool subsume, bool resolve)
+{
+   bool res = true;
+
+   if(GroundSetUnitSimplifyClause(groundset, new, subsume, resolve))
+   {
+      ClauseFree(new);
+      return true;
+   }
+   if(ClauseIsEmpty(new))
+   {
+      res = false;
+      PropClauseSetFree(groundset->non_units);
+      groundset->non_units = PropClauseSetAlloc();
+      PDArrayFree(groundset->units);
+      groundset->units = PDArrayAlloc(1,1);
+      groundset->unit_no = 0;
+   }
+   GroundSetInsert(groundset, new);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_init()
+//
+//   Initialize a channel to or from a grounding worker.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_init(GroundChannel_p ch, int fd, pid_t pid,
+                                bool writer)
+{
+   ch->fd     = fd;
+   ch->pid    = pid;
+   ch->size   = GROUND_IO_BUFFER*sizeof(long);
+   ch->buffer = SecureMalloc(ch->size);
+   ch->start  = 0;
+   ch->end    = 0;
+   ch->open   = true;
+   ch->done   = false;
+   ch->state  = cpl_unknown;
+   ch->clause = 0;
+   ch->atoms  = writer?PDIntArrayAlloc(DEFAULT_LIT_NO, DEFAULT_LIT_GROW):
+      PDArrayAlloc(DEFAULT_LIT_NO, DEFAULT_LIT_GROW);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_exit()
+//
+//   Free the memory associated with a channel (does not close the
+//   file descriptor).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_exit(GroundChannel_p ch)
+{
+   FREE(ch->buffer);
+   PDArrayFree(ch->atoms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_flush()
+//
+//   Write the buffered data of a worker channel. If this fails, the
+//   parent is gone (or has given up on us), and the worker
+//   terminates.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate the process
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_flush(GroundChannel_p ch)
+{
+   size_t  done = 0;
+   ssize_t written;
+
+   while(done < ch->end)
+   {
+      written = write(ch->fd, ch->buffer+done, ch->end-done);
+      if(written < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         _exit(OTHER_ERROR);
+      }
+      done += written;
+   }
+   ch->end = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_put()
+//
+//   Append a value to the stream of a worker channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_put(GroundChannel_p ch, long value)
+{
+   if(ch->end+sizeof(long) > ch->size)
+   {
+      ground_channel_flush(ch);
+   }
+   memcpy(ch->buffer+ch->end, &value, sizeof(long));
+   ch->end += sizeof(long);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_term_length()
+//
+//   Return the number of symbol occurrences in a ground term.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long ground_term_length(Term_p term)
+{
+   long res = 1;
+   int  i;
+
+   for(i=0; i<term->arity; i++)
+   {
+      res += ground_term_length(term->args[i]);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_put_term()
+//
+//   Write a ground term in prefix notation.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_put_term(GroundChannel_p ch, Term_p term)
+{
+   int i;
+
+   assert(!TermIsVar(term));
+   ground_channel_put(ch, term->f_code);
+   for(i=0; i<term->arity; i++)
+   {
+      ground_channel_put_term(ch, term->args[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_put_clause()
+//
+//   Write a ground clause, preceded by the definitions of all atoms
+//   not yet announced on this channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Output (eventually)
+//
+/----------------------------------------------------------------------*/
+
+static void ground_channel_put_clause(GroundChannel_p ch, Clause_p clause)
+{
+   Eqn_p handle;
+   long  code;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      code = EqnLitCode(handle);
+      if(!PDArrayElementInt(ch->atoms, code))
+      {
+         ground_channel_put(ch, GROUND_REC_ATOM);
+         ground_channel_put(ch, code);
+         ground_channel_put(ch, ground_term_length(handle->lterm));
+         ground_channel_put_term(ch, handle->lterm);
+         PDArrayAssignInt(ch->atoms, code, 1);
+      }
+   }
+   ground_channel_put(ch, GROUND_REC_CLAUSE);
+   ground_channel_put(ch, ClauseLiteralNumber(clause));
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      code = EqnLitCode(handle);
+      ground_channel_put(ch, EqnIsPositive(handle)?code:-code);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_fill()
+//
+//   Make sure that at least need values are buffered in a parent
+//   channel, reading (and blocking) as necessary. Return false if
+//   the worker closed the stream before that.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations, may terminate with
+//                   error
+//
+/----------------------------------------------------------------------*/
+
+static bool ground_channel_fill(GroundChannel_p ch, long need)
+{
+   size_t  bytes = need*sizeof(long);
+   ssize_t got;
+
+   if(ch->end-ch->start >= bytes)
+   {
+      return true;
+   }
+   memmove(ch->buffer, ch->buffer+ch->start, ch->end-ch->start);
+   ch->end  -= ch->start;
+   ch->start = 0;
+   if(ch->size < bytes)
+   {
+      ch->size   = MAX(2*ch->size, bytes);
+      ch->buffer = SecureRealloc(ch->buffer, ch->size);
+   }
+   while(ch->end < bytes)
+   {
+      got = read(ch->fd, ch->buffer+ch->end, ch->size-ch->end);
+      if(got < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         TmpErrno = errno;
+         SysError("Cannot read grounding worker results", SYS_ERROR);
+      }
+      if(got == 0)
+      {
+         ch->open = false;
+         return false;
+      }
+      ch->end += got;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_get()
+//
+//   Return the next buffered value of a parent channel.
+//
+// Global Variables: -
+//
+// Side Effects    : Consumes the value
+//
+/----------------------------------------------------------------------*/
+
+static long ground_channel_get(GroundChannel_p ch)
+{
+   long res;
+
+   assert(ch->end-ch->start >= sizeof(long));
+   memcpy(&res, ch->buffer+ch->start, sizeof(long));
+   ch->start += sizeof(long);
+
+   return res;
+}
+
+#define ground_channel_available(ch) (((ch)->end-(ch)->start)/sizeof(long))
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_channel_get_term()
+//
+//   Read a ground term in prefix notation (which has to be buffered
+//   completely) and insert it into bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p ground_channel_get_term(GroundChannel_p ch, TB_p bank)
+{
+   FunCode f_code = ground_channel_get(ch);
+   Term_p  handle;
+   int     i;
+
+   assert(f_code > 0);
+   handle = TermTopAlloc(f_code, SigFindArity(bank->sig, f_code));
+   for(i=0; i<handle->arity; i++)
+   {
+      handle->args[i] = ground_channel_get_term(ch, bank);
+   }
+   return TBTermTopInsert(bank, handle);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_worker_instances()
+//
+//   Worker version of ClauseCreateGroundInstances(): Write the ground
+//   instances of clause described by inst that survive unit
+//   simplification against the (frozen) unit clauses of the ground
+//   set to ch. Return false if the empty clause has been created,
+//   true otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes work->bank, output, changes inst
+//
+/----------------------------------------------------------------------*/
+
+static bool ground_worker_instances(GroundWork_p work, Clause_p clause,
+                                    VarSetInst_p inst, GroundChannel_p ch)
+{
+   bool     next = true, res = true;
+   Eqn_p    handle;
+   Clause_p new;
+
+   if(!varsetinstinitialize(inst))
+   {
+      return true;
+   }
+   while(next && res && !TimeIsUp && !MemIsLow)
+   {
+      varsetinstapply(inst);
+      handle = EqnListCopy(clause->literals, work->bank);
+      EqnListRemoveDuplicates(handle);
+      if(work->taut_check && EqnListIsTrivial(handle))
+      {
+         EqnListFree(handle);
+      }
+      else
+      {
+         new = ClauseAlloc(handle);
+         if(!GroundSetUnitSimplifyClause(work->groundset, new,
+                                         work->subsume, work->resolve))
+         {
+            ground_channel_put_clause(ch, new);
+            res = !ClauseIsEmpty(new);
+         }
+         ClauseFree(new);
+      }
+      next = varsetinstnext(inst);
+   }
+   varsetinstclear(inst);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_worker()
+//
+//   Main function of grounding worker number worker: Handle clauses
+//   from work->first on. Clauses are partitioned by the domain of
+//   their first variable - every worker takes the values at
+//   positions congruent to its number (offset by the position of the
+//   clause to spread the load for small domains). Ground clauses are
+//   distributed round-robin. The instances of each clause are
+//   followed by a next record, so that the parent can merge them in
+//   clause order.
+//
+// Global Variables: TimeIsUp, MemIsLow
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ground_worker(GroundWork_p work, int worker, GroundChannel_p ch)
+{
+   PStack_p      slice = PStackAlloc(), alternatives;
+   PStackPointer j;
+   VarSetInst_p  inst;
+   long          i;
+   bool          res = true;
+
+   for(i=work->first; i<work->count && res && !TimeIsUp && !MemIsLow; i++)
+   {
+      inst = work->insts[i];
+      if(!inst->size)
+      {
+         if(i%work->workers == worker)
+         {
+            res = ground_worker_instances(work, work->clauses[i], inst, ch);
+         }
+      }
+      else
+      {
+         alternatives = inst->cells[0].alternatives;
+         for(j=0; j<PStackGetSP(alternatives); j++)
+         {
+            if((i+j)%work->workers == worker)
+            {
+               PStackPushP(slice, PStackElementP(alternatives, j));
+            }
+         }
+         inst->cells[0].alternatives = slice;
+         res = ground_worker_instances(work, work->clauses[i], inst, ch);
+         inst->cells[0].alternatives = alternatives;
+         PStackReset(slice);
+      }
+      ground_channel_put(ch, GROUND_REC_NEXT);
+   }
+   PStackFree(slice);
+
+   ground_channel_put(ch, GROUND_REC_END);
+   ground_channel_put(ch, TimeIsUp?cpl_timeout:(MemIsLow?cpl_lowmem:cpl_complete));
+   ground_channel_flush(ch);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_merge_record()
+//
+//   Read one record from a worker and process it. Clauses are mapped
+//   to the parent's atoms and inserted into work->groundset (with
+//   another round of unit simplification against the current
+//   state). Return false if the empty clause has been found, true
+//   otherwise. Truncated records are ignored.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes work->groundset and work->bank
+//
+/----------------------------------------------------------------------*/
+
+static bool ground_merge_record(GroundWork_p work, GroundChannel_p ch)
+{
+   long     tag, code, len, i;
+   Term_p   atom;
+   Eqn_p    lits = NULL, lit;
+   EqnRef   tail = &lits;
+
+   if(!ground_channel_fill(ch, 1))
+   {
+      return true;
+   }
+   tag = ground_channel_get(ch);
+   switch(tag)
+   {
+   case GROUND_REC_ATOM:
+         if(!ground_channel_fill(ch, 2))
+         {
+            break;
+         }
+         code = ground_channel_get(ch);
+         len  = ground_channel_get(ch);
+         if(!ground_channel_fill(ch, len))
+         {
+            break;
+         }
+         atom = ground_channel_get_term(ch, work->bank);
+         PDArrayAssignP(ch->atoms, code, atom);
+         break;
+   case GROUND_REC_CLAUSE:
+         if(!ground_channel_fill(ch, 1))
+         {
+            break;
+         }
+         len = ground_channel_get(ch);
+         if(!ground_channel_fill(ch, len))
+         {
+            break;
+         }
+         for(i=0; i<len; i++)
+         {
+            code = ground_channel_get(ch);
+            atom = PDArrayElementP(ch->atoms, ABS(code));
+            assert(atom);
+            lit = EqnAlloc(atom, work->bank->true_term, work->bank, code>0);
+            *tail = lit;
+            tail  = &(lit->next);
+         }
+         return ground_set_add_instance(work->groundset, ClauseAlloc(lits),
+                                        work->subsume, work->resolve);
+   case GROUND_REC_END:
+         if(ground_channel_fill(ch, 1))
+         {
+            ch->state = ground_channel_get(ch);
+            ch->done  = true;
+         }
+         break;
+   case GROUND_REC_NEXT:
+         ch->clause++;
+         break;
+   default:
+         assert(false && "Corrupted grounding worker stream");
+         break;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_check_give_up()
+//
+//   Terminate the program if the estimated number of instances of
+//   the clause described by inst (plus the current members of
+//   groundset if running is true) exceeds give_up (if non-zero).
+//
+// Global Variables: -
+//
+// Side Effects    : May terminate the program with output
+//
+/----------------------------------------------------------------------*/
+
+static void ground_check_give_up(GroundSet_p groundset, VarSetInst_p inst,
+                                 bool running, long give_up)
+{
+   double estimate;
+
+   if(!give_up)
+   {
+      return;
+   }
+   estimate = varinstestimate(inst);
+   if(running)
+   {
+      estimate += GroundSetMembers(groundset);
+   }
+   if(estimate > give_up)
+   {
+      fprintf(GlobalOut, "\n# Failure: User resource limit"
+              " exceeded (estimated number of instances)!\n");
+      exit(NO_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_run_workers()
+//
+//   Fork work->workers processes grounding the clauses from
+//   work->first on and merge their results into work->groundset in
+//   clause order (and for each clause, in worker order), so that the
+//   result does not depend on timing. Before the instances of a
+//   clause are merged, the clause is checked against give_up as in
+//   ClauseSetCreateConstrGroundInstances(). Return false if the empty
+//   clause has been found, true otherwise. *state is set to the
+//   completeness of the results. Workers that do not report back
+//   completely are assumed to have run out of time.
+//
+// Global Variables: -
+//
+// Side Effects    : Forks, changes work->groundset, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool ground_run_workers(GroundWork_p work, GroundSetState *state)
+{
+   GroundChannelCell channels[GROUND_MAX_WORKERS];
+   int               pipefd[2], w, status;
+   long              i;
+   GroundChannel_p   ch;
+   struct rlimit     limit;
+   rlim_t            remaining = RLIM_INFINITY, used;
+   bool              res = true;
+
+   if(getrlimit(RLIMIT_CPU, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+   {
+      used = (rlim_t)GetTotalCPUTime();
+      remaining = (used >= limit.rlim_cur)?1:limit.rlim_cur-used;
+   }
+   fflush(GlobalOut);
+   fflush(stdout);
+   for(w=0; w<work->workers; w++)
+   {
+      if(pipe(pipefd) == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot create pipe for grounding worker", SYS_ERROR);
+      }
+      channels[w].pid = fork();
+      if(channels[w].pid == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot fork grounding worker", SYS_ERROR);
+      }
+      if(channels[w].pid == 0)
+      {
+         /* Child: Run silently, never touch the parent's output */
+         close(pipefd[0]);
+         for(i=0; i<w; i++)
+         {
+            close(channels[i].fd);
+         }
+         SilentTimeOut = true;
+         if(remaining != RLIM_INFINITY)
+         {
+            SetSoftRlimit(RLIMIT_CPU, remaining);
+         }
+         ground_channel_init(&(channels[w]), pipefd[1], 0, true);
+         ground_worker(work, w, &(channels[w]));
+         _exit(NO_ERROR);
+      }
+      close(pipefd[1]);
+      ground_channel_init(&(channels[w]), pipefd[0], channels[w].pid, false);
+      channels[w].clause = work->first;
+   }
+
+   for(i=work->first; i<work->count && res && !TimeIsUp && !MemIsLow; i++)
+   {
+      ground_check_give_up(work->groundset, work->insts[i], true,
+                           work->give_up);
+      for(w=0; w<work->workers && res; w++)
+      {
+         ch = &(channels[w]);
+         while(res && ch->open && !ch->done && ch->clause == i)
+         {
+            res = ground_merge_record(work, ch);
+         }
+      }
+   }
+   if(res && !TimeIsUp && !MemIsLow)
+   {
+      /* Collect the end records */
+      for(w=0; w<work->workers; w++)
+      {
+         ch = &(channels[w]);
+         while(ch->open && !ch->done)
+         {
+            ground_merge_record(work, ch);
+         }
+      }
+   }
+
+   *state = cpl_complete;
+   for(w=0; w<work->workers; w++)
+   {
+      ch = &(channels[w]);
+      if(ch->open)
+      {
+         kill(ch->pid, SIGKILL);
+      }
+      close(ch->fd);
+      while(waitpid(ch->pid, &status, 0) == -1)
+      {
+         if(errno != EINTR)
+         {
+            TmpErrno = errno;
+            SysError("Cannot wait for grounding worker", SYS_ERROR);
+         }
+      }
+      if(res && *state == cpl_complete)
+      {
+         if(!ch->done)
+         {
+            *state = cpl_timeout;
+         }
+         else if(ch->state != cpl_complete)
+         {
+            *state = ch->state;
+         }
+      }
+      ground_channel_exit(ch);
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -585,11 +1354,11 @@ void ClausePrintDimacs(FILE* out, Clause_p clause)
       {
     if(EqnIsPositive(handle))
     {
-       fprintf(stdout, "  %ld", handle->lterm->entry_no);
+       fprintf(out, "  %ld", handle->lterm->entry_no);
     }
     else
     {
-       fprintf(stdout, " -%ld", handle->lterm->entry_no);
+       fprintf(out, " -%ld", handle->lterm->entry_no);
     }
       }
       fputs(" 0\n", out);
@@ -911,6 +1680,57 @@ bool GroundSetUnitSimplifyClause(GroundSet_p set, Clause_p clause,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GroundSetUnitSimplify()
+//
+//   Simplify all non-unit clauses of set with the unit clauses of
+//   set until no new units are found. The result only depends on the
+//   ground instances in set, not on the order in which they were
+//   inserted (or simplified on insertion). Return false if the empty
+//   clause has been found, true otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool GroundSetUnitSimplify(GroundSet_p set, bool subsume, bool resolve)
+{
+   PropClause_p handle, list;
+   long         units = -1;
+   bool         res = true;
+
+   if(!subsume && !resolve)
+   {
+      return true;
+   }
+   while(res && units != set->unit_no)
+   {
+      units = set->unit_no;
+      list  = set->non_units->list;
+      set->non_units->list    = NULL;
+      PropClauseSetFree(set->non_units);
+      set->non_units = PropClauseSetAlloc();
+      while(list)
+      {
+         handle = list;
+         list   = list->next;
+         if(res)
+         {
+            res = ground_set_add_instance(set,
+                                          PropClauseToClause(set->lit_bank,
+                                                             handle),
+                                          subsume, resolve);
+         }
+         PropClauseFree(handle);
+      }
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseCreateGroundInstances()
@@ -961,24 +1781,7 @@ bool ClauseCreateGroundInstances(TB_p bank, Clause_p clause,
       else
       {
     new = ClauseAlloc(handle);
-    if(!GroundSetUnitSimplifyClause(groundset, new, subsume,
-                resolve))
-    {
-       if(ClauseIsEmpty(new))
-       {
-          res = false;
-          PropClauseSetFree(groundset->non_units);
-          groundset->non_units = PropClauseSetAlloc();
-          PDArrayFree(groundset->units);
-          groundset->units = PDArrayAlloc(1,1);
-          groundset->unit_no = 0;
-       }
-       GroundSetInsert(groundset, new);
-    }
-    else
-    {
-       ClauseFree(new);
-    }
+    res = ground_set_add_instance(groundset, new, subsume, resolve);
       }
       next = varsetinstnext(inst);
    }
@@ -1018,12 +1821,12 @@ bool ClauseSetCreateGroundInstances(TB_p bank, ClauseSet_p set,
    if(give_up)
    {
       long vars = ClauseSetMaxVarNumber(set);
+      long constants = PStackGetSP(default_terms);
       double est_inst=1;
 
-      tmp = PStackGetSP(default_terms);
       for(i=0; i<vars; i++)
       {
-    est_inst = est_inst*tmp;
+    est_inst = est_inst*constants;
     if(est_inst > give_up)
     {
        fprintf(GlobalOut, "\n# Failure: User resource limit"
@@ -1160,6 +1963,162 @@ bool ClauseSetCreateConstrGroundInstances(TB_p bank, ClauseSet_p set,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetCreateGroundInstancesParallel()
+//
+//   Create ground instances of set (using global instantiation
+//   constraints if constraints is true) and put them into groundset,
+//   using up to workers forked processes. The leading unit clauses
+//   (set should be sorted by length) are grounded first in this
+//   process, so that workers can use all their instances for unit
+//   simplification. The instances of the remaining clauses are
+//   partitioned by the domain of the first variable and streamed
+//   back as propositional clauses, which are merged in clause
+//   order. Return false if the empty clause has been found, true
+//   otherwise. give_up works as for the sequential versions. As
+//   workers only simplify with the units known before they start,
+//   the ground set depends on the number of workers until it is
+//   simplified with GroundSetUnitSimplify().
+//
+// Global Variables: TimeIsUp, MemIsLow
+//
+// Side Effects    : Forks, changes groundset, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool ClauseSetCreateGroundInstancesParallel(TB_p bank, ClauseSet_p set,
+                                            GroundSet_p groundset,
+                                            bool subsume, bool resolve,
+                                            bool taut_check,
+                                            bool constraints,
+                                            long give_up, int workers)
+{
+   PStack_p       default_terms = PStackAlloc();
+   PTree_p        default_term_tree = NULL;
+   LitOccTable_p  p_table = NULL, n_table = NULL;
+   GroundWorkCell work;
+   GroundSetState state = cpl_complete;
+   Clause_p       handle;
+   VarSetInst_p   inst;
+   long           i, j;
+   bool           res = true;
+
+   SigCollectConstantTerms(bank, default_terms, 0);
+   if(constraints)
+   {
+      PStackToPTree(&default_term_tree, default_terms);
+      p_table = LitOccTableAlloc(bank->sig);
+      n_table = LitOccTableAlloc(bank->sig);
+      LitOccAddClauseSetAlt(p_table, n_table, set);
+   }
+   work.bank       = bank;
+   work.groundset  = groundset;
+   work.count      = set->members;
+   work.first      = work.count;
+   work.subsume    = subsume;
+   work.resolve    = resolve;
+   work.taut_check = taut_check;
+   work.workers    = MIN(workers, GROUND_MAX_WORKERS);
+   work.clauses    = SizeMalloc(MAX(work.count,1)*sizeof(Clause_p));
+   work.insts      = SizeMalloc(MAX(work.count,1)*sizeof(VarSetInst_p));
+
+   i = 0;
+   for(handle = set->anchor->succ; handle != set->anchor; handle = handle->succ)
+   {
+      if(constraints)
+      {
+         inst = VarSetConstrInstAlloc(p_table, n_table, handle,
+                                      default_term_tree);
+      }
+      else
+      {
+         inst = VarSetInstAlloc(handle);
+         for(j=0; j<inst->size; j++)
+         {
+            inst->cells[j].alternatives = default_terms;
+         }
+      }
+      if(give_up && !constraints)
+      {
+         ground_check_give_up(groundset, inst, false, give_up);
+      }
+      if(ClauseLiteralNumber(handle) > 1 && work.first == work.count)
+      {
+         work.first = i;
+      }
+      work.clauses[i] = handle;
+      work.insts[i]   = inst;
+      i++;
+   }
+
+   give_up = constraints?give_up:0;
+   for(i=0; i<work.first && res && !TimeIsUp && !MemIsLow; i++)
+   {
+      ground_check_give_up(groundset, work.insts[i], true, give_up);
+      res = ClauseCreateGroundInstances(bank, work.clauses[i], work.insts[i],
+                                        groundset, subsume, resolve,
+                                        taut_check);
+   }
+   if(res && work.first < work.count && !TimeIsUp && !MemIsLow)
+   {
+      if(work.workers < 2)
+      {
+         for(i=work.first; i<work.count && res && !TimeIsUp && !MemIsLow; i++)
+         {
+            ground_check_give_up(groundset, work.insts[i], true, give_up);
+            res = ClauseCreateGroundInstances(bank, work.clauses[i],
+                                              work.insts[i], groundset,
+                                              subsume, resolve, taut_check);
+         }
+      }
+      else
+      {
+         work.give_up = give_up;
+         for(i=work.first; i<work.count && OutputLevel == 1; i++)
+         {
+            fputc('#', GlobalOut);
+         }
+         res = ground_run_workers(&work, &state);
+      }
+   }
+   if(TimeIsUp)
+   {
+      groundset->complete = cpl_timeout;
+   }
+   else if(MemIsLow)
+   {
+      groundset->complete = cpl_lowmem;
+   }
+   else
+   {
+      groundset->complete = state;
+   }
+
+   for(i=0; i<work.count; i++)
+   {
+      if(constraints)
+      {
+         VarSetConstrInstFree(work.insts[i]);
+      }
+      else
+      {
+         VarSetInstFree(work.insts[i]);
+      }
+   }
+   SizeFree(work.clauses, MAX(work.count,1)*sizeof(Clause_p));
+   SizeFree(work.insts, MAX(work.count,1)*sizeof(VarSetInst_p));
+   if(constraints)
+   {
+      LitOccTableFree(p_table);
+      LitOccTableFree(n_table);
+      PTreeFree(default_term_tree);
+   }
+   PStackFree(default_terms);
+
+   return res;
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
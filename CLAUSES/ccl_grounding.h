@@ -19,6 +19,10 @@ Changes
 
 <1> Tue May 29 02:20:15 CEST 2001
     New
+<2> Tue Oct 20 02:31:05 CEST 2026
+    Parallel grounding in forked worker processes.
+<3> Wed Oct 21 10:05:18 CEST 2026
+    Final unit simplification of ground sets.
 
 -----------------------------------------------------------------------*/
 
@@ -26,6 +30,8 @@ Changes
 
 #define CCL_GROUNDING
 
+#include <sys/types.h>
+#include <sys/wait.h>
 #include <ccl_g_lithash.h>
 #include <ccl_propclauses.h>
 #include <ccl_groundconstr.h>
@@ -68,6 +74,10 @@ typedef enum
 #define DEFAULT_LIT_NO   4096
 #define DEFAULT_LIT_GROW 8192
 
+/* Upper bound for the number of grounding worker processes */
+
+#define GROUND_MAX_WORKERS 64
+
 typedef enum
 {
    cpl_complete,
@@ -136,6 +146,8 @@ void        GroundSetPrintDimacs(FILE* out, GroundSet_p set);
 
 bool        GroundSetUnitSimplifyClause(GroundSet_p set, Clause_p clause,
                bool subsume, bool resolve);
+bool        GroundSetUnitSimplify(GroundSet_p set, bool subsume,
+                                  bool resolve);
 
 bool ClauseCreateGroundInstances(TB_p bank, Clause_p clause,
              VarSetInst_p inst, GroundSet_p
@@ -154,6 +166,13 @@ bool ClauseSetCreateConstrGroundInstances(TB_p bank, ClauseSet_p set,
                  give_up, long
                  just_one_instance);
 
+bool ClauseSetCreateGroundInstancesParallel(TB_p bank, ClauseSet_p set,
+                                            GroundSet_p groundset,
+                                            bool subsume, bool resolve,
+                                            bool taut_check,
+                                            bool constraints,
+                                            long give_up, int workers);
+
 #endif
 
 /*---------------------------------------------------------------------*/
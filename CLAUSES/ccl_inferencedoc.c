@@ -95,8 +95,17 @@ char* PCLTypeStr(FormulaProperties type)
 
 static void pcl_print_start(FILE* out, Clause_p clause, bool print_clause)
 {
-   fprintf(out, PCLStepCompact?"%ld:":"%6ld : ", clause->ident);
-   fprintf(out, "%s:", PCLTypeStr(ClauseQueryTPTPType(clause)));
+   if(PCLStepCompact)
+   {
+      OutLong(out, clause->ident);
+      putc(':', out);
+   }
+   else
+   {
+      fprintf(out, "%6ld : ", clause->ident);
+   }
+   fputs(PCLTypeStr(ClauseQueryTPTPType(clause)), out);
+   putc(':', out);
    if(print_clause)
    {
       ClausePCLPrint(out, clause, PCLFullTerms);
@@ -220,17 +229,23 @@ static void print_paramod(FILE* out, Clause_p clause, Clause_p
    {
    case pcl_format:
     pcl_print_start(out, clause, PCLShellLevel<1);
-    fprintf(out, "%s(%ld,%ld)", inf, parent1->ident,
-       parent2->ident);
+    fputs(inf, out);
+    putc('(', out);
+    OutLong(out, parent1->ident);
+    putc(',', out);
+    OutLong(out, parent2->ident);
+    putc(')', out);
     pcl_print_end(out, comment, clause);
     break;
    case tstp_format:
     ClauseTSTPPrint(out, clause, PCLFullTerms, false);
-    fprintf(out,
-       ",inference(%s,[status(thm)],[c_0_%ld,c_0_%ld])",
-                 inf,
-       parent1->ident,
-       parent2->ident);
+    fputs(",inference(", out);
+    fputs(inf, out);
+    fputs(",[status(thm)],[c_0_", out);
+    OutLong(out, parent1->ident);
+    fputs(",c_0_", out);
+    OutLong(out, parent2->ident);
+    fputs("])", out);
     tstp_print_end(out, comment, clause);
     break;
    default:
@@ -701,11 +716,13 @@ static void print_rewrite(FILE* out, ClausePos_p rewritten, long
     {
        fputs(PCL_RW"(", out);
     }
-    fprintf(out, "%ld", old_id);
+    OutLong(out, old_id);
     for(i=0; i<PStackGetSP(rwsteps); i++)
     {
             demod = PStackElementP(rwsteps,i);
-       fprintf(out, ",%ld)", demod->ident);
+       putc(',', out);
+       OutLong(out, demod->ident);
+       putc(')', out);
     }
     pcl_print_end(out, comment, rewritten->clause);
     break;
@@ -718,12 +735,14 @@ static void print_rewrite(FILE* out, ClausePos_p rewritten, long
     {
        fprintf(out,"inference("PCL_RW", [status(thm)],[");
     }
-    fprintf(out, "c_0_%ld", old_id);
+    fputs("c_0_", out);
+    OutLong(out, old_id);
     for(i=0; i<PStackGetSP(rwsteps); i++)
     {
             demod = PStackElementP(rwsteps,i);
-       fprintf(out, ",c_0_%ld])",
-          demod->ident);
+       fputs(",c_0_", out);
+       OutLong(out, demod->ident);
+       fputs("])", out);
     }
     tstp_print_end(out, comment, rewritten->clause);
     break;
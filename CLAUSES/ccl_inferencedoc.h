@@ -108,6 +108,7 @@ typedef enum
 #define PCL_ANNOQ  "add_answer_literal"
 #define PCL_EVANS  "eval_answer_literal"
 #define PCL_NC     "assume_negation"
+#define PCL_SATREF "sat_refutation"
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
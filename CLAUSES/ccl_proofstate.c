@@ -20,6 +20,8 @@ Changes
     New
 <2> Wed Oct 14 22:46:13 MET DST 1998
     Extracted from CONTROL/cco_proofstate.c
+<3> Tue Oct 20 02:31:05 CEST 2026
+    Watchlists use a dedicated index.
 
 -----------------------------------------------------------------------*/
 
@@ -205,6 +207,8 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
 
    handle->status_reported              = false;
    handle->answer_count                 = 0;
+   handle->reweight_base                = 0;
+   handle->reweight_pending             = 0;
 
    handle->processed_count              = 0;
    handle->proc_trivial_count           = 0;
@@ -256,6 +260,7 @@ void ProofStateInitWatchlist(ProofState_p state, OCB_p ocb,
    if(watchlist_filename)
    {
       state->watchlist = ClauseSetAlloc();
+      state->watchlist->watch_index = WatchIndexAlloc();
       GCRegisterClauseSet(state->gc_terms, state->watchlist);
 
       if(watchlist_filename != UseInlinedWatchList)
@@ -336,6 +341,8 @@ void ProofStateResetClauseSets(ProofState_p state, bool term_gc)
    ClauseSetFreeClauses(state->ax_archive);
    FormulaSetFreeFormulas(state->f_ax_archive);
    GlobalIndicesReset(&(state->gindices));
+   state->reweight_base    = 0;
+   state->reweight_pending = 0;
    if(state->watchlist)
    {
       ClauseSetFreeClauses(state->watchlist);
@@ -589,6 +596,13 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
    fprintf(out,
       "# Current number of archived clauses   : %ld\n",
       state->archive->members);
+   if(state->watchlist && state->watchlist->watch_index)
+   {
+      fprintf(out,
+              "# Current number of watchlist clauses  : %ld\n",
+              state->watchlist->members);
+      WatchIndexPrintStatistics(out, state->watchlist->watch_index);
+   }
    if(ProofObjectRecordsGCSelection)
    {
       fprintf(out,
@@ -80,6 +80,11 @@ typedef struct proofstatecell
    bool              status_reported;
    long              answer_count;
 
+   long              reweight_base;    /* Size of unprocessed at the
+                                          last reweighting */
+   long              reweight_pending; /* Clauses still to be reweighted
+                                          in the current round */
+
    unsigned long           processed_count;
    unsigned long           proc_trivial_count;
    unsigned long           proc_forward_subsumed_count;
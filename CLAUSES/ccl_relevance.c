@@ -18,6 +18,9 @@ Changes
 
 <1> Wed Jun  3 00:07:17 CEST 2009
     New
+<2> Mon Oct 19 22:05:31 CEST 2026
+    Replaced PList/FIndex level computation with bit sets over
+    numbered clauses/formulas and symbols.
 
 -----------------------------------------------------------------------*/
 
@@ -42,11 +45,10 @@ Changes
 
 /*-----------------------------------------------------------------------
 //
-// Function: find_level_fcodes()
+// Function: item_is_conjecture()
 //
-//   Find all (non-special) function symbols in the relevance cores
-//   and assign their relevance level. Push them onto the new_codes
-//   stack (once).
+//   Return true if item number i of reldata is a (real or negated)
+//   conjecture.
 //
 // Global Variables: -
 //
@@ -54,104 +56,124 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-void find_level_fcodes(Relevance_p reldata, long level)
+static bool item_is_conjecture(Relevance_p reldata, long i)
 {
-   PList_p handle;
-   PStack_p collector = PStackAlloc();
-   Clause_p clause;
-   WFormula_p form;
-   FunCode   f;
+   if(i < reldata->clause_no)
+   {
+      return ClauseIsConjecture((Clause_p)PStackElementP(reldata->items, i));
+   }
+   return FormulaIsConjecture((WFormula_p)PStackElementP(reldata->items, i));
+}
 
-   for(handle = reldata->clauses_core->succ;
-       handle != reldata->clauses_core;
-       handle = handle->succ)
+
+/*-----------------------------------------------------------------------
+//
+// Function: build_item_symbols()
+//
+//   Collect the (non-special) function symbols of all items into
+//   item_start/item_syms.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void build_item_symbols(Relevance_p reldata)
+{
+   PStack_p      collector = PStackAlloc();
+   PStack_p      f_codes = PStackAlloc();
+   PStackPointer j;
+   FunCode       f;
+   long          i;
+
+   reldata->item_start = SizeMalloc((reldata->item_no+1)*sizeof(long));
+   for(i=0; i<reldata->item_no; i++)
    {
-      clause = handle->key.p_val;
-      ClauseReturnFCodes(clause, collector);
-      while(!PStackEmpty(collector))
+      reldata->item_start[i] = PStackGetSP(f_codes);
+      if(i < reldata->clause_no)
+      {
+         ClauseReturnFCodes(PStackElementP(reldata->items, i), collector);
+      }
+      else
       {
-         f = PStackPopInt(collector);
+         WFormulaReturnFCodes(PStackElementP(reldata->items, i), collector);
+      }
+      for(j=0; j<PStackGetSP(collector); j++)
+      {
+         f = PStackElementInt(collector, j);
          if(!SigIsSpecial(reldata->sig, f))
          {
-            if(!PDArrayElementInt(reldata->fcode_relevance, f))
-            {
-               PDArrayAssignInt(reldata->fcode_relevance, f, level);
-               PStackPushInt(reldata->new_codes, f);
-            }
+            PStackPushInt(f_codes, f);
          }
       }
+      PStackReset(collector);
    }
+   reldata->item_start[reldata->item_no] = PStackGetSP(f_codes);
 
-   for(handle = reldata->formulas_core->succ;
-       handle != reldata->formulas_core;
-       handle = handle->succ)
+   reldata->item_syms = SizeMalloc(MAX(PStackGetSP(f_codes),1)*sizeof(FunCode));
+   for(j=0; j<PStackGetSP(f_codes); j++)
    {
-      form = handle->key.p_val;
-      WFormulaReturnFCodes(form, collector);
-      while(!PStackEmpty(collector))
-      {
-         f = PStackPopInt(collector);
-         if(!SigIsSpecial(reldata->sig, f))
-         {
-            if(!PDArrayElementInt(reldata->fcode_relevance, f))
-            {
-               PDArrayAssignInt(reldata->fcode_relevance, f, level);
-               PStackPushInt(reldata->new_codes, f);
-            }
-         }
-      }
+      reldata->item_syms[j] = PStackElementInt(f_codes, j);
    }
+   PStackFree(f_codes);
    PStackFree(collector);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: extract_new_core()
+// Function: build_symbol_items()
 //
-//   Find the formulas and clauses in the the "rest" part and put them
-//   into the core.
+//   Invert item_start/item_syms into sym_start/sym_items (by
+//   counting occurrences per symbol).
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
-void extract_new_core(Relevance_p reldata)
+static void build_symbol_items(Relevance_p reldata)
 {
+   long occurrences = reldata->item_start[reldata->item_no];
+   long *fill, i, j;
    FunCode f;
-   PTree_p root;
-   PList_p entry;
 
-   while(!PStackEmpty(reldata->new_codes))
+   reldata->sym_start = SizeMalloc((reldata->sym_no+1)*sizeof(long));
+   fill = SizeMalloc((reldata->sym_no+1)*sizeof(long));
+   for(f=0; f<=reldata->sym_no; f++)
    {
-      f = PStackPopInt(reldata->new_codes);
-
-      while((root = PDArrayElementP(reldata->clauses_index->index, f)))
-      {
-         entry = root->key;
-         FIndexRemovePLClause(reldata->clauses_index, entry);
-         PListExtract(entry);
-         PListInsert(reldata->clauses_core, entry);
-      }
-      while((root = PDArrayElementP(reldata->formulas_index->index, f)))
+      reldata->sym_start[f] = 0;
+   }
+   for(j=0; j<occurrences; j++)
+   {
+      reldata->sym_start[reldata->item_syms[j]+1]++;
+   }
+   for(f=0; f<reldata->sym_no; f++)
+   {
+      reldata->sym_start[f+1] += reldata->sym_start[f];
+      fill[f] = reldata->sym_start[f];
+   }
+   reldata->sym_items = SizeMalloc(MAX(occurrences,1)*sizeof(long));
+   for(i=0; i<reldata->item_no; i++)
+   {
+      for(j=reldata->item_start[i]; j<reldata->item_start[i+1]; j++)
       {
-         entry = root->key;
-         FIndexRemovePLFormula(reldata->formulas_index, entry);
-         PListExtract(entry);
-         PListInsert(reldata->formulas_core, entry);
+         f = reldata->item_syms[j];
+         reldata->sym_items[fill[f]++] = i;
       }
    }
+   SizeFree(fill, (reldata->sym_no+1)*sizeof(long));
 }
 
 
-
 /*-----------------------------------------------------------------------
 //
-// Function: move_clauses()
+// Function: effective_level()
 //
-//   Given a plist of clauses, move them into the clauseset.
+//   Return the relevance level of item i, with unreachable items
+//   sorted in after all real levels.
 //
 // Global Variables: -
 //
@@ -159,46 +181,90 @@ void extract_new_core(Relevance_p reldata)
 //
 /----------------------------------------------------------------------*/
 
-static void move_clauses(PList_p from, ClauseSet_p to)
+static long effective_level(Relevance_p reldata, long i)
 {
-   PList_p handle;
-   Clause_p clause;
+   return reldata->item_level[i]?reldata->item_level[i]:reldata->max_level;
+}
 
-   for(handle = from->succ;
-       handle != from;
-       handle = handle->succ)
+
+/*-----------------------------------------------------------------------
+//
+// Function: items_by_level()
+//
+//   Return an array of all item numbers of reldata sorted (stably)
+//   by relevance level, with unreachable items last. The caller has
+//   to free the result.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long* items_by_level(Relevance_p reldata)
+{
+   long *start = SizeMalloc((reldata->max_level+2)*sizeof(long));
+   long *res   = SizeMalloc(MAX(reldata->item_no,1)*sizeof(long));
+   long i, level;
+
+   for(level=0; level<=reldata->max_level+1; level++)
    {
-      clause = handle->key.p_val;
-      ClauseSetExtractEntry(clause);
-      ClauseSetInsert(to, clause);
+      start[level] = 0;
+   }
+   for(i=0; i<reldata->item_no; i++)
+   {
+      start[effective_level(reldata, i)+1]++;
+   }
+   for(level=0; level<=reldata->max_level; level++)
+   {
+      start[level+1] += start[level];
+   }
+   for(i=0; i<reldata->item_no; i++)
+   {
+      res[start[effective_level(reldata, i)]++] = i;
    }
+   SizeFree(start, (reldata->max_level+2)*sizeof(long));
+
+   return res;
 }
 
+
 /*-----------------------------------------------------------------------
 //
-// Function: move_formulas()
+// Function: relevance_print_levels()
 //
-//   Given a plist of formulas, move them into the formulaset.
+//   Print the number of clauses and formulas and the time used for
+//   each relevance level.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Output
 //
 /----------------------------------------------------------------------*/
 
-static void move_formulas(PList_p from, FormulaSet_p to)
+static void relevance_print_levels(FILE* out, Relevance_p reldata)
 {
-   PList_p handle;
-   WFormula_p form;
+   long *counts = SizeMalloc((reldata->max_level+1)*sizeof(long));
+   long i, level;
 
-   for(handle = from->succ;
-       handle != from;
-       handle = handle->succ)
+   for(level=0; level<=reldata->max_level; level++)
    {
-      form = handle->key.p_val;
-      FormulaSetExtractEntry(form);
-      FormulaSetInsert(to, form);
+      counts[level] = 0;
+   }
+   for(i=0; i<reldata->item_no; i++)
+   {
+      counts[effective_level(reldata, i)]++;
    }
+   for(level=1; level<reldata->max_level; level++)
+   {
+      fprintf(out, "# Relevance level %ld: %ld clauses/formulas (%.6f s)\n",
+              level, counts[level],
+              PStackElementInt(reldata->level_times, level-1)/1000000.0);
+   }
+   fprintf(out, "# Relevance: %ld clauses/formulas unreachable\n",
+           counts[reldata->max_level]);
+
+   SizeFree(counts, (reldata->max_level+1)*sizeof(long));
 }
 
 
@@ -207,7 +273,8 @@ static void move_formulas(PList_p from, FormulaSet_p to)
 // Function: proofstate_rel_prune()
 //
 //   Use the relevance data to prune axioms to those with a relevancy <=
-//   level.
+//   level. If there are no more than level relevance levels, all
+//   clauses and formulas are kept.
 //
 // Global Variables: -
 //
@@ -221,29 +288,38 @@ static void proofstate_rel_prune(ProofState_p state,
 {
    ClauseSet_p  new_ax  = ClauseSetAlloc();
    FormulaSet_p new_fax = FormulaSetAlloc();
-   PStackPointer i, base;
-   PList_p       set;
+   long         *order = items_by_level(reldata);
+   long         i, item, item_level;
+   Clause_p     clause;
+   WFormula_p   form;
 
    GCDeregisterFormulaSet(state->gc_terms, state->f_axioms);
    GCDeregisterClauseSet(state->gc_terms, state->axioms);
 
-   for(i=0; i<level; i++)
+   for(i=0; i<reldata->item_no; i++)
    {
-      base = 2*i;
-      if(base >= PStackGetSP(reldata->relevance_levels))
+      item = order[i];
+      item_level = reldata->item_level[item];
+      if(level < reldata->max_level &&
+         (!item_level || item_level > level))
       {
-         /* Not enough levels to fullfil the request, add the
-            remaining clauses.*/
-         move_clauses(reldata->clauses_rest, new_ax);
-         move_formulas(reldata->formulas_rest, new_fax);
          break;
       }
-      set = PStackElementP(reldata->relevance_levels, base);
-      move_clauses(set, new_ax);
-
-      set = PStackElementP(reldata->relevance_levels, base+1);
-      move_formulas(set, new_fax);
+      if(item < reldata->clause_no)
+      {
+         clause = PStackElementP(reldata->items, item);
+         ClauseSetExtractEntry(clause);
+         ClauseSetInsert(new_ax, clause);
+      }
+      else
+      {
+         form = PStackElementP(reldata->items, item);
+         FormulaSetExtractEntry(form);
+         FormulaSetInsert(new_fax, form);
+      }
    }
+   SizeFree(order, MAX(reldata->item_no,1)*sizeof(long));
+
    ClauseSetFree(state->axioms);
    FormulaSetFree(state->f_axioms);
    state->axioms   = new_ax;
@@ -265,13 +341,13 @@ static void proofstate_rel_prune(ProofState_p state,
 //
 // Function: RelevanceAlloc()
 //
-//   Allocate a relevancy data structure - mostly used to be able to
-//   clearly state invariants. After initialization:
-//   - Core contains the newly found relevant clauses and formulas
-//   - Rest contains the remainder of clauses and formulas
-//   - new_codes is the set of newly found relevant function symbols.
+//   Allocate an empty relevancy data structure. After
+//   RelevanceDataCompute():
+//   - item_level contains for all clauses and formulas the relevance
+//     level (conjectures have level 1) or 0 if they are not reachable
+//     from the conjectures.
 //   - f_code_relevance contains for all f_codes the relevance level
-//     (if found relevant already) or 0.
+//     (the level of the first item they occur in) or 0.
 //
 // Global Variables: -
 //
@@ -283,20 +359,20 @@ Relevance_p RelevanceAlloc(void)
 {
    Relevance_p handle = RelevanceCellAlloc();
 
-   handle->sig              = NULL;
+   handle->sig             = NULL;
+   handle->clause_no       = 0;
+   handle->item_no         = 0;
+   handle->items           = PStackAlloc();
+   handle->item_start      = NULL;
+   handle->item_syms       = NULL;
+   handle->sym_no          = 0;
+   handle->sym_start       = NULL;
+   handle->sym_items       = NULL;
+   handle->item_level      = NULL;
+   handle->max_level       = 0;
+   handle->fcode_relevance = PDArrayAlloc(100, 0);
+   handle->level_times     = PStackAlloc();
 
-   handle->clauses_core     = PListAlloc();
-   handle->formulas_core    = PListAlloc();
-
-   handle->clauses_rest     = PListAlloc();
-   handle->formulas_rest    = PListAlloc();
-
-   handle->clauses_index    = FIndexAlloc();
-   handle->formulas_index   = FIndexAlloc();
-
-   handle->fcode_relevance  = PDArrayAlloc(100, 0);
-   handle->new_codes        = PStackAlloc();
-   handle->relevance_levels =  PStackAlloc();
    return handle;
 }
 
@@ -315,24 +391,25 @@ Relevance_p RelevanceAlloc(void)
 
 void RelevanceFree(Relevance_p junk)
 {
-   PList_p level;
-
-   PListFree(junk->clauses_core);
-   PListFree(junk->formulas_core);
-   PListFree(junk->clauses_rest);
-   PListFree(junk->formulas_rest);
-   FIndexFree(junk->clauses_index);
-   FIndexFree(junk->formulas_index);
-
-   PDArrayFree(junk->fcode_relevance);
-   PStackFree(junk->new_codes);
-
-   while(!PStackEmpty(junk->relevance_levels))
+   if(junk->item_start)
+   {
+      SizeFree(junk->item_syms,
+               MAX(junk->item_start[junk->item_no],1)*sizeof(FunCode));
+      SizeFree(junk->item_start, (junk->item_no+1)*sizeof(long));
+   }
+   if(junk->sym_start)
+   {
+      SizeFree(junk->sym_items,
+               MAX(junk->sym_start[junk->sym_no],1)*sizeof(long));
+      SizeFree(junk->sym_start, (junk->sym_no+1)*sizeof(long));
+   }
+   if(junk->item_level)
    {
-      level = PStackPopP(junk->relevance_levels);
-      PListFree(level);
+      SizeFree(junk->item_level, MAX(junk->item_no,1)*sizeof(long));
    }
-   PStackFree(junk->relevance_levels);
+   PStackFree(junk->items);
+   PDArrayFree(junk->fcode_relevance);
+   PStackFree(junk->level_times);
 
    RelevanceCellFree(junk);
 }
@@ -401,31 +478,53 @@ void FormulaPListPrint(FILE* out, PList_p list)
 //
 // Function: RelevanceDataInit()
 //
-//   Initialize a relevancy data structure - Split conjectures and
-//   non-conjectures, and index the non-conjectures.
+//   Initialize a relevancy data structure - number all clauses and
+//   formulas, index them by symbol, and assign level 1 to the
+//   conjectures. Return the number of conjectures.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 long RelevanceDataInit(ProofState_p state, Relevance_p data)
 {
-   long res = 0;
+   Clause_p   clause;
+   WFormula_p form;
+   long       i, res = 0;
 
-   data->sig = state->signature;
+   data->sig    = state->signature;
+   data->sym_no = state->signature->f_count+1;
 
-   res += ClauseSetSplitConjectures(state->axioms,
-                                    data->clauses_core,
-                                    data->clauses_rest);
-   res += FormulaSetSplitConjectures(state->f_axioms,
-                                    data->formulas_core,
-                                    data->formulas_rest);
+   for(clause = state->axioms->anchor->succ;
+       clause != state->axioms->anchor;
+       clause = clause->succ)
+   {
+      PStackPushP(data->items, clause);
+   }
+   data->clause_no = PStackGetSP(data->items);
+   for(form = state->f_axioms->anchor->succ;
+       form != state->f_axioms->anchor;
+       form = form->succ)
+   {
+      PStackPushP(data->items, form);
+   }
+   data->item_no = PStackGetSP(data->items);
 
-   FIndexAddPLClauseSet(data->clauses_index, data->clauses_rest);
-   FIndexAddPLFormulaSet(data->formulas_index, data->formulas_rest);
+   build_item_symbols(data);
+   build_symbol_items(data);
 
+   data->item_level = SizeMalloc(MAX(data->item_no,1)*sizeof(long));
+   for(i=0; i<data->item_no; i++)
+   {
+      data->item_level[i] = 0;
+      if(item_is_conjecture(data, i))
+      {
+         data->item_level[i] = 1;
+         res++;
+      }
+   }
    return res;
 }
 
@@ -434,43 +533,84 @@ long RelevanceDataInit(ProofState_p state, Relevance_p data)
 //
 // Function: RelevanceDataCompute()
 //
-//   Compute the relevance levels.
+//   Compute the relevance levels. Items of level 1 are the
+//   conjectures, symbols have the level of the first items they
+//   occur in, and items of level n+1 are those not yet reached that
+//   share a symbol of level n. Each level is computed with a few
+//   bit set operations over the new items and symbols, so every
+//   item and every symbol occurrence is touched only once.
 //
-// Global Variables:
+// Global Variables: -
 //
-// Side Effects    :
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 Relevance_p RelevanceDataCompute(ProofState_p state)
 {
    Relevance_p handle = RelevanceAlloc();
-   long level = 1;
+   BitSet_p    frontier, reached, new_syms, reached_syms;
+   long        level = 1, i, j;
+   long long   start;
+   FunCode     f;
 
    (void)RelevanceDataInit(state, handle);
 
-   while(!(PListEmpty(handle->clauses_core) &&
-           PListEmpty(handle->formulas_core)))
+   frontier     = BitSetAlloc(handle->item_no);
+   reached      = BitSetAlloc(handle->item_no);
+   new_syms     = BitSetAlloc(handle->sym_no);
+   reached_syms = BitSetAlloc(handle->sym_no);
+
+   for(i=0; i<handle->item_no; i++)
+   {
+      if(handle->item_level[i])
+      {
+         BitSetInsert(frontier, i);
+      }
+   }
+   BitSetOr(reached, frontier);
+
+   while(!BitSetIsEmpty(frontier))
    {
-      /*
-      printf("Level %ld core:\n", level);
-      ClausePListPrint(stdout, handle->clauses_core);
-      FormulaPListPrint(stdout, handle->formulas_core);
-      printf("\n");
-      */
-      find_level_fcodes(handle, level);
+      start = GetUSecClock();
 
-      PStackPushP(handle->relevance_levels, handle->clauses_core);
-      PStackPushP(handle->relevance_levels, handle->formulas_core);
+      BitSetClearAll(new_syms);
+      BitSetForEach(frontier, i)
+      {
+         for(j=handle->item_start[i]; j<handle->item_start[i+1]; j++)
+         {
+            BitSetInsert(new_syms, handle->item_syms[j]);
+         }
+      }
+      BitSetAndNot(new_syms, reached_syms);
+      BitSetOr(reached_syms, new_syms);
 
-      handle->clauses_core  = PListAlloc();
-      handle->formulas_core = PListAlloc();
+      BitSetClearAll(frontier);
+      BitSetForEach(new_syms, f)
+      {
+         PDArrayAssignInt(handle->fcode_relevance, f, level);
+         for(j=handle->sym_start[f]; j<handle->sym_start[f+1]; j++)
+         {
+            BitSetInsert(frontier, handle->sym_items[j]);
+         }
+      }
+      BitSetAndNot(frontier, reached);
+      BitSetOr(reached, frontier);
 
-      extract_new_core(handle);
       level = level+1;
+      BitSetForEach(frontier, i)
+      {
+         handle->item_level[i] = level;
+      }
+      PStackPushInt(handle->level_times, GetUSecClock()-start);
    }
    handle->max_level = level;
 
+   BitSetFree(frontier);
+   BitSetFree(reached);
+   BitSetFree(new_syms);
+   BitSetFree(reached_syms);
+
    return handle;
 }
 
@@ -483,9 +623,9 @@ Relevance_p RelevanceDataCompute(ProofState_p state)
 //   Perform proof state preprocssing, in particular compute relevancy
 //   data and perform relevancy pruning.
 //
-// Global Variables: -
+// Global Variables: OutputLevel
 //
-// Side Effects    : -
+// Side Effects    : Output
 //
 /----------------------------------------------------------------------*/
 
@@ -499,6 +639,10 @@ long ProofStatePreprocess(ProofState_p state, long level)
       return 0;
    }
    reldata = RelevanceDataCompute(state);
+   if(OutputLevel)
+   {
+      relevance_print_levels(GlobalOut, reldata);
+   }
 
    old_axno = ProofStateAxNo(state);
    proofstate_rel_prune(state, reldata, level);
@@ -513,5 +657,3 @@ long ProofStatePreprocess(ProofState_p state, long level)
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
-
-
@@ -19,6 +19,8 @@ Changes
 
 <1> Sun May 31 11:20:27 CEST 2009
     New
+<2> Mon Oct 19 22:05:31 CEST 2026
+    Bit set based level computation
 
 -----------------------------------------------------------------------*/
 
@@ -27,7 +29,7 @@ Changes
 #define CCL_RELEVANCE
 
 #include <clb_plist.h>
-#include <ccl_findex.h>
+#include <clb_bitsets.h>
 #include <ccl_proofstate.h>
 
 /*---------------------------------------------------------------------*/
@@ -35,25 +37,30 @@ Changes
 /*---------------------------------------------------------------------*/
 
 /* Data structure for computing the relevance of function symbols with
- * respect to a set of conjectures/goals */
+ * respect to a set of conjectures/goals. Clauses and formulas are
+ * numbered consecutively as "items" (clauses first). The symbols of
+ * item i are item_syms[item_start[i]]...item_syms[item_start[i+1]-1],
+ * the items containing symbol f are sym_items[sym_start[f]]... in
+ * the same way. */
 
 typedef struct relevance_cell
 {
    Sig_p     sig;
 
-   PList_p   clauses_core;
-   PList_p   formulas_core;
+   long      clause_no;
+   long      item_no;
+   PStack_p  items;
 
-   PList_p   clauses_rest;
-   PList_p   formulas_rest;
-
-   FIndex_p  clauses_index;
-   FIndex_p  formulas_index;
+   long      *item_start;
+   FunCode   *item_syms;
+   long      sym_no;
+   long      *sym_start;
+   long      *sym_items;
 
+   long      *item_level;      /* 0 for irrelevant items */
    long      max_level;
    PDArray_p fcode_relevance;
-   PStack_p  new_codes;
-   PStack_p  relevance_levels;
+   PStack_p  level_times;      /* CPU time per level (microseconds) */
 }RelevanceCell, *Relevance_p;
 
 
@@ -39,6 +39,333 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: ax_list_alloc()
+//
+//   Allocate an empty SinEAxList.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static SinEAxList_p ax_list_alloc(void)
+{
+   SinEAxList_p handle = SinEAxListCellAlloc();
+
+   handle->axioms  = PStackAlloc();
+   handle->start   = PStackAlloc();
+   handle->symbols = PStackAlloc();
+   PStackPushInt(handle->start, 0);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ax_list_free()
+//
+//   Free a SinEAxList (but not the axioms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ax_list_free(SinEAxList_p junk)
+{
+   PStackFree(junk->axioms);
+   PStackFree(junk->start);
+   PStackFree(junk->symbols);
+   SinEAxListCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ax_list_truncate()
+//
+//   Remove all but the first count axioms from list.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void ax_list_truncate(SinEAxList_p list, long count)
+{
+   assert(count <= PStackGetSP(list->axioms));
+
+   PStackSetSP(list->axioms, count);
+   PStackSetSP(list->start, count+1);
+   PStackSetSP(list->symbols, PStackTopInt(list->start));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ax_list_close_axiom()
+//
+//   The symbols of axiom have just been pushed onto list->symbols
+//   (with the help of dist_array). Add axiom to list and reset
+//   dist_array.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void ax_list_close_axiom(SinEAxList_p list, void* axiom,
+                                long* dist_array)
+{
+   PStackPointer sp;
+
+   for(sp = PStackTopInt(list->start); sp < PStackGetSP(list->symbols); sp++)
+   {
+      dist_array[PStackElementInt(list->symbols, sp)] = 0;
+   }
+   PStackPushP(list->axioms, axiom);
+   PStackPushInt(list->start, PStackGetSP(list->symbols));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: index_set_size()
+//
+//   Return the number of axioms of set number set_no in the
+//   index (as given by the start positions of the sets in set_start
+//   and the axiom list).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long index_set_size(PStack_p set_start, SinEAxList_p list,
+                           PStackPointer set_no)
+{
+   long end;
+
+   if(set_no+1 < PStackGetSP(set_start))
+   {
+      end = PStackElementInt(set_start, set_no+1);
+   }
+   else
+   {
+      end = PStackGetSP(list->axioms);
+   }
+   return end - PStackElementInt(set_start, set_no);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: d_rel_alloc()
+//
+//   Compute the D-Relation for all axioms in list.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static SinEDRel_p d_rel_alloc(SinEAxList_p list, GenDistrib_p generality,
+                              AxFilter_p ax_filter)
+{
+   SinEDRel_p    handle = SinEDRelCellAlloc();
+   PStack_p      pairs  = PStackAlloc();
+   PStack_p      rel_symbols = PStackAlloc();
+   long          *pos, i;
+   FunCode       f;
+   PStackPointer sp;
+
+   handle->f_count = generality->sig->f_count;
+   handle->start   = SizeMalloc((handle->f_count+2)*sizeof(long));
+   memset(handle->start, 0, (handle->f_count+2)*sizeof(long));
+
+   for(i=0; i<PStackGetSP(list->axioms); i++)
+   {
+      SymbolsComputeDRel(generality,
+                         ax_filter->gen_measure,
+                         ax_filter->benevolence,
+                         ax_filter->generosity,
+                         list->symbols,
+                         PStackElementInt(list->start, i),
+                         PStackElementInt(list->start, i+1),
+                         rel_symbols);
+      if(PStackEmpty(rel_symbols))
+      {
+         PStackPushInt(rel_symbols, 0);
+      }
+      while(!PStackEmpty(rel_symbols))
+      {
+         f = PStackPopInt(rel_symbols);
+         PStackPushInt(pairs, f);
+         PStackPushInt(pairs, i);
+         handle->start[f+1]++;
+      }
+   }
+   for(f=0; f<=handle->f_count; f++)
+   {
+      handle->start[f+1] += handle->start[f];
+   }
+   handle->size   = PStackGetSP(pairs)/2;
+   handle->axioms = SizeMalloc(MAX(handle->size,1)*sizeof(long));
+
+   /* Pairs are in order of axioms, so this keeps axioms for each
+      symbol sorted */
+   pos = SizeMalloc((handle->f_count+1)*sizeof(long));
+   memcpy(pos, handle->start, (handle->f_count+1)*sizeof(long));
+   for(sp=0; sp<PStackGetSP(pairs); sp+=2)
+   {
+      f = PStackElementInt(pairs, sp);
+      handle->axioms[pos[f]++] = PStackElementInt(pairs, sp+1);
+   }
+   SizeFree(pos, (handle->f_count+1)*sizeof(long));
+   PStackFree(rel_symbols);
+   PStackFree(pairs);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: d_rel_free()
+//
+//   Free a SinEDRel.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void d_rel_free(SinEDRel_p junk)
+{
+   SizeFree(junk->start, (junk->f_count+2)*sizeof(long));
+   SizeFree(junk->axioms, MAX(junk->size,1)*sizeof(long));
+   SinEDRelCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: d_rel_queue_axioms()
+//
+//   Store all axioms (of the given type) in D-relation with f in
+//   queue.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void d_rel_queue_axioms(SinEDRel_p rel, FunCode f, AxiomType type,
+                               PQueue_p queue)
+{
+   long i;
+
+   if(f > rel->f_count)
+   {
+      return;
+   }
+   for(i=rel->start[f]; i<rel->start[f+1]; i++)
+   {
+      PQueueStoreInt(queue, type);
+      PQueueStoreInt(queue, rel->axioms[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: d_rel_push_axioms()
+//
+//   Push all axioms (from list) in D-relation with f onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void d_rel_push_axioms(SinEDRel_p rel, FunCode f, SinEAxList_p list,
+                              PStack_p res)
+{
+   long i;
+
+   for(i=rel->start[f]; i<rel->start[f+1]; i++)
+   {
+      PStackPushP(res, PStackElementP(list->axioms, rel->axioms[i]));
+   }
+}
+
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: relevance_no_symbol_count()
+//
+//   Return the number of axioms without symbols that ax_filter adds
+//   to the selection.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long relevance_no_symbol_count(SinERelevance_p rel,
+                                      AxFilter_p ax_filter)
+{
+   if(!ax_filter->add_no_symbol_axioms)
+   {
+      return 0;
+   }
+   return PStackGetSP(rel->no_symbol_clauses)+
+      PStackGetSP(rel->no_symbol_formulas);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: relevance_selection_limit()
+//
+//   Return the largest (0-based) position in the selection sequence
+//   of rel that ax_filter may still select, given its size limits
+//   and the axioms without symbols it adds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long relevance_selection_limit(SinERelevance_p rel,
+                                      AxFilter_p ax_filter)
+{
+   long max_result_size;
+
+   max_result_size = ax_filter->max_set_fraction*rel->ax_cardinality;
+   if(ax_filter->max_set_size < max_result_size)
+   {
+      max_result_size = ax_filter->max_set_size;
+   }
+   return max_result_size - relevance_no_symbol_count(rel, ax_filter);
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -616,6 +943,585 @@ long SelectDefiningAxioms(DRelation_p drel,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexAlloc()
+//
+//   Allocate an empty SinE axiom index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SinEIndex_p SinEIndexAlloc(void)
+{
+   SinEIndex_p handle = SinEIndexCellAlloc();
+
+   handle->clause_sets       = PStackAlloc();
+   handle->formula_sets      = PStackAlloc();
+   handle->clause_set_start  = PStackAlloc();
+   handle->formula_set_start = PStackAlloc();
+   handle->clauses           = ax_list_alloc();
+   handle->formulas          = ax_list_alloc();
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexFree()
+//
+//   Free a SinE axiom index. Sets and axioms are external.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SinEIndexFree(SinEIndex_p junk)
+{
+   PStackFree(junk->clause_sets);
+   PStackFree(junk->formula_sets);
+   PStackFree(junk->clause_set_start);
+   PStackFree(junk->formula_set_start);
+   ax_list_free(junk->clauses);
+   ax_list_free(junk->formulas);
+   SinEIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexBacktrack()
+//
+//   Remove all but the first sets (clause and formula sets) from the
+//   index.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void SinEIndexBacktrack(SinEIndex_p index, PStackPointer sets)
+{
+   if(sets >= PStackGetSP(index->clause_sets))
+   {
+      return;
+   }
+   ax_list_truncate(index->clauses,
+                    PStackElementInt(index->clause_set_start, sets));
+   ax_list_truncate(index->formulas,
+                    PStackElementInt(index->formula_set_start, sets));
+   PStackSetSP(index->clause_sets, sets);
+   PStackSetSP(index->formula_sets, sets);
+   PStackSetSP(index->clause_set_start, sets);
+   PStackSetSP(index->formula_set_start, sets);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexUpdate()
+//
+//   Make index describe exactly the clause_sets and formula_sets
+//   (which have to be of the same length). Sets that already are in
+//   the index (at the same position and with the same number of
+//   axioms) are not indexed again.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SinEIndexUpdate(SinEIndex_p index, GenDistrib_p generality,
+                     PStack_p clause_sets, PStack_p formula_sets)
+{
+   PStackPointer i;
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+   Clause_p      clause;
+   WFormula_p    form;
+
+   assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
+
+   for(i=0; i<PStackGetSP(index->clause_sets); i++)
+   {
+      if(i >= PStackGetSP(clause_sets))
+      {
+         break;
+      }
+      cset = PStackElementP(clause_sets, i);
+      fset = PStackElementP(formula_sets, i);
+      if((cset != PStackElementP(index->clause_sets, i)) ||
+         (fset != PStackElementP(index->formula_sets, i)) ||
+         (ClauseSetCardinality(cset) !=
+          index_set_size(index->clause_set_start, index->clauses, i)) ||
+         (FormulaSetCardinality(fset) !=
+          index_set_size(index->formula_set_start, index->formulas, i)))
+      {
+         break;
+      }
+   }
+   SinEIndexBacktrack(index, i);
+
+   GenDistribSizeAdjust(generality, generality->sig);
+   for(; i<PStackGetSP(clause_sets); i++)
+   {
+      cset = PStackElementP(clause_sets, i);
+      fset = PStackElementP(formula_sets, i);
+      PStackPushP(index->clause_sets, cset);
+      PStackPushP(index->formula_sets, fset);
+      PStackPushInt(index->clause_set_start,
+                    PStackGetSP(index->clauses->axioms));
+      PStackPushInt(index->formula_set_start,
+                    PStackGetSP(index->formulas->axioms));
+
+      for(clause = cset->anchor->succ;
+          clause != cset->anchor;
+          clause = clause->succ)
+      {
+         ClauseAddSymbolDistExist(clause, generality->f_distrib,
+                                  index->clauses->symbols);
+         ax_list_close_axiom(index->clauses, clause,
+                             generality->f_distrib);
+      }
+      for(form = fset->anchor->succ;
+          form != fset->anchor;
+          form = form->succ)
+      {
+         TermAddSymbolDistExist(form->tformula, generality->f_distrib,
+                                index->formulas->symbols);
+         ax_list_close_axiom(index->formulas, form,
+                             generality->f_distrib);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEFiltersShareRelevance()
+//
+//   Return true if the two filters are SinE filters that select
+//   along the same sequence of axioms, i.e. only differ in limits
+//   and in adding axioms without symbols.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool SinEFiltersShareRelevance(AxFilter_p filter1, AxFilter_p filter2)
+{
+   return (filter1->type == AFGSinE) &&
+      (filter2->type == AFGSinE) &&
+      (filter1->gen_measure == filter2->gen_measure) &&
+      (filter1->benevolence == filter2->benevolence) &&
+      (filter1->generosity == filter2->generosity) &&
+      (filter1->use_hypotheses == filter2->use_hypotheses);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexComputeRelevance()
+//
+//   Perform SinE axiom selection on the (up-to-date) index, using
+//   the conjectures (and optionally hypotheses) in the sets starting
+//   at seed_start as seeds, and record the selected axioms with
+//   their recursion levels. filters is a non-empty stack of filters
+//   that all share their relevance. The selection runs until it has
+//   covered the largest limits of all filters in filters (or runs
+//   out of axioms). This computes exactly the same sequence as
+//   building a DRelation for all sets and calling
+//   SelectDefiningAxioms(), but works on the precomputed symbol index
+//   and on axiom numbers, so it does not traverse any terms and
+//   leaves the axioms untouched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SinERelevance_p SinEIndexComputeRelevance(SinEIndex_p   index,
+                                          GenDistrib_p  f_distrib,
+                                          PStackPointer seed_start,
+                                          PStack_p      filters)
+{
+   Sig_p           sig = f_distrib->sig;
+   AxFilter_p      ax_filter = PStackElementP(filters, 0);
+   SinERelevance_p rel = SinERelevanceCellAlloc();
+   SinEDRel_p      clause_rel, formula_rel;
+   SinEAxList_p    list;
+   PQueue_p        selq = PQueueAlloc();
+   BitSet_p        clauses_sel, formulas_sel, activated;
+   long            selected = 0, i, end, limit;
+   int             recursion_level = 0;
+   AxiomType       type;
+   Clause_p        clause;
+   WFormula_p      form;
+   FunCode         f;
+   PStackPointer   set, sp;
+
+   rel->gen_measure        = ax_filter->gen_measure;
+   rel->benevolence        = ax_filter->benevolence;
+   rel->generosity         = ax_filter->generosity;
+   rel->use_hypotheses     = ax_filter->use_hypotheses;
+   rel->seed_start         = seed_start;
+   rel->seeds              = 0;
+   rel->ax_cardinality     = PStackGetSP(index->clauses->axioms)+
+      PStackGetSP(index->formulas->axioms);
+   rel->max_level          = 0;
+   rel->max_selected       = 0;
+   rel->complete           = true;
+   rel->no_symbol_clauses  = PStackAlloc();
+   rel->no_symbol_formulas = PStackAlloc();
+   rel->selected           = PStackAlloc();
+
+   for(set=seed_start; set<PStackGetSP(index->clause_sets); set++)
+   {
+      end = PStackElementInt(index->clause_set_start, set)+
+         index_set_size(index->clause_set_start, index->clauses, set);
+      for(i=PStackElementInt(index->clause_set_start, set); i<end; i++)
+      {
+         clause = PStackElementP(index->clauses->axioms, i);
+         if(ClauseIsConjecture(clause)||
+            (rel->use_hypotheses && ClauseIsHypothesis(clause)))
+         {
+            PQueueStoreInt(selq, ATClause);
+            PQueueStoreInt(selq, i);
+            rel->seeds++;
+         }
+      }
+      end = PStackElementInt(index->formula_set_start, set)+
+         index_set_size(index->formula_set_start, index->formulas, set);
+      for(i=PStackElementInt(index->formula_set_start, set); i<end; i++)
+      {
+         form = PStackElementP(index->formulas->axioms, i);
+         if(FormulaIsConjecture(form)||
+            (rel->use_hypotheses && FormulaIsHypothesis(form)))
+         {
+            PQueueStoreInt(selq, ATFormula);
+            PQueueStoreInt(selq, i);
+            rel->seeds++;
+         }
+      }
+   }
+   VERBOSE(fprintf(stderr, "# Found %ld seed clauses/formulas\n",
+                   rel->seeds););
+   if(!rel->seeds)
+   {
+      /* No goals-> the empty set contains all relevant clauses */
+      PQueueFree(selq);
+      return rel;
+   }
+
+   clause_rel  = d_rel_alloc(index->clauses, f_distrib, ax_filter);
+   formula_rel = d_rel_alloc(index->formulas, f_distrib, ax_filter);
+   d_rel_push_axioms(clause_rel, 0, index->clauses,
+                     rel->no_symbol_clauses);
+   d_rel_push_axioms(formula_rel, 0, index->formulas,
+                     rel->no_symbol_formulas);
+
+   rel->max_selected = LONG_MIN;
+   for(sp=0; sp<PStackGetSP(filters); sp++)
+   {
+      ax_filter = PStackElementP(filters, sp);
+      assert(SinEFiltersShareRelevance(ax_filter,
+                                       PStackElementP(filters, 0)));
+      rel->max_level = MAX(rel->max_level, ax_filter->max_recursion_depth);
+      limit = relevance_selection_limit(rel, ax_filter);
+      rel->max_selected = MAX(rel->max_selected, limit);
+   }
+
+   clauses_sel  = BitSetAlloc(PStackGetSP(index->clauses->axioms));
+   formulas_sel = BitSetAlloc(PStackGetSP(index->formulas->axioms));
+   activated    = BitSetAlloc(sig->f_count+1);
+
+   PQueueStoreInt(selq, ATNoType);
+   while(!PQueueEmpty(selq))
+   {
+      if((selected > rel->max_selected) ||
+         (recursion_level > rel->max_level))
+      {
+         rel->complete = false;
+         break;
+      }
+      type = PQueueGetNextInt(selq);
+      switch(type)
+      {
+      case ATNoType:
+            recursion_level++;
+            if(!PQueueEmpty(selq))
+            {
+               PQueueStoreInt(selq, ATNoType);
+            }
+            continue;
+      case ATClause:
+            i = PQueueGetNextInt(selq);
+            if(BitSetQuery(clauses_sel, i))
+            {
+               continue;
+            }
+            BitSetInsert(clauses_sel, i);
+            list = index->clauses;
+            break;
+      case ATFormula:
+            i = PQueueGetNextInt(selq);
+            if(BitSetQuery(formulas_sel, i))
+            {
+               continue;
+            }
+            BitSetInsert(formulas_sel, i);
+            list = index->formulas;
+            break;
+      default:
+            assert(false && "Unknown axiom type!");
+            continue;
+      }
+      PStackPushInt(rel->selected, type);
+      PStackPushP(rel->selected, PStackElementP(list->axioms, i));
+      PStackPushInt(rel->selected, recursion_level);
+      selected++;
+      for(sp = PStackElementInt(list->start, i);
+          sp < PStackElementInt(list->start, i+1);
+          sp++)
+      {
+         f = PStackElementInt(list->symbols, sp);
+         if((f > sig->internal_symbols) && !BitSetQuery(activated, f))
+         {
+            BitSetInsert(activated, f);
+            d_rel_queue_axioms(clause_rel, f, ATClause, selq);
+            d_rel_queue_axioms(formula_rel, f, ATFormula, selq);
+         }
+      }
+   }
+   BitSetFree(activated);
+   BitSetFree(formulas_sel);
+   BitSetFree(clauses_sel);
+   d_rel_free(formula_rel);
+   d_rel_free(clause_rel);
+   PQueueFree(selq);
+
+   return rel;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinERelevanceFree()
+//
+//   Free a SinERelevance (but not the axioms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SinERelevanceFree(SinERelevance_p junk)
+{
+   PStackFree(junk->no_symbol_clauses);
+   PStackFree(junk->no_symbol_formulas);
+   PStackFree(junk->selected);
+   SinERelevanceCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinERelevanceCovers()
+//
+//   Return true if the selection of ax_filter (with seeds from sets
+//   starting at seed_start) can be derived from rel.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool SinERelevanceCovers(SinERelevance_p rel,
+                         PStackPointer seed_start,
+                         AxFilter_p ax_filter)
+{
+   if((ax_filter->type != AFGSinE) ||
+      (rel->seed_start != seed_start) ||
+      (rel->gen_measure != ax_filter->gen_measure) ||
+      (rel->benevolence != ax_filter->benevolence) ||
+      (rel->generosity != ax_filter->generosity) ||
+      (rel->use_hypotheses != ax_filter->use_hypotheses))
+   {
+      return false;
+   }
+   return rel->complete ||
+      ((ax_filter->max_recursion_depth <= rel->max_level) &&
+       (relevance_selection_limit(rel, ax_filter) <= rel->max_selected));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinERelevancePrefixLength()
+//
+//   Return the number of axioms from the selection sequence of rel
+//   selected by ax_filter (which must be covered by rel).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long SinERelevancePrefixLength(SinERelevance_p rel, AxFilter_p ax_filter)
+{
+   long          limit = relevance_selection_limit(rel, ax_filter);
+   long          res   = 0;
+   PStackPointer sp;
+
+   for(sp = 0; sp < PStackGetSP(rel->selected); sp += 3)
+   {
+      if((res > limit) ||
+         (PStackElementInt(rel->selected, sp+2) >
+          ax_filter->max_recursion_depth))
+      {
+         break;
+      }
+      res++;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinERelevanceFilterExtends()
+//
+//   Return true if the selection of ax_filter is the selection of
+//   base plus a (possibly empty) continuation of the selection
+//   sequence of rel. Both filters must be covered by rel.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool SinERelevanceFilterExtends(SinERelevance_p rel,
+                                AxFilter_p ax_filter,
+                                AxFilter_p base)
+{
+   if(!rel->seeds)
+   {
+      return true;
+   }
+   return (ax_filter->add_no_symbol_axioms == base->add_no_symbol_axioms)&&
+      (SinERelevancePrefixLength(rel, base) <=
+       SinERelevancePrefixLength(rel, ax_filter));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinERelevanceGetAxioms()
+//
+//   Push the axioms selected by ax_filter (which must be covered by
+//   rel) onto res_clauses and res_formulas. If base is given,
+//   ax_filter has to extend it (see above), and only the axioms not
+//   selected by base are pushed. Returns the number of axioms
+//   selected by ax_filter (including those of base).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long SinERelevanceGetAxioms(SinERelevance_p rel,
+                            AxFilter_p ax_filter,
+                            AxFilter_p base,
+                            PStack_p res_clauses,
+                            PStack_p res_formulas)
+{
+   long          len, base_len = 0;
+   PStackPointer sp;
+
+   if(!rel->seeds)
+   {
+      return 0;
+   }
+   assert(!base || SinERelevanceFilterExtends(rel, ax_filter, base));
+
+   if(base)
+   {
+      base_len = SinERelevancePrefixLength(rel, base);
+   }
+   else if(ax_filter->add_no_symbol_axioms)
+   {
+      PStackPushStack(res_clauses, rel->no_symbol_clauses);
+      PStackPushStack(res_formulas, rel->no_symbol_formulas);
+   }
+   len = SinERelevancePrefixLength(rel, ax_filter);
+   for(sp = 3*base_len; sp < 3*len; sp += 3)
+   {
+      if(PStackElementInt(rel->selected, sp) == ATClause)
+      {
+         PStackPushP(res_clauses, PStackElementP(rel->selected, sp+1));
+      }
+      else
+      {
+         PStackPushP(res_formulas, PStackElementP(rel->selected, sp+1));
+      }
+   }
+   return relevance_no_symbol_count(rel, ax_filter)+len;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SinEIndexSelectAxioms()
+//
+//   Perform SinE axiom selection with ax_filter on the (up-to-date)
+//   index (see SinEIndexComputeRelevance()). Selected axioms are
+//   pushed onto res_clauses and res_formulas, the total number of
+//   selected axioms is returned.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long SinEIndexSelectAxioms(SinEIndex_p   index,
+                           GenDistrib_p  f_distrib,
+                           PStackPointer seed_start,
+                           AxFilter_p    ax_filter,
+                           PStack_p      res_clauses,
+                           PStack_p      res_formulas)
+{
+   PStack_p        filters = PStackAlloc();
+   SinERelevance_p rel;
+   long            res;
+
+   PStackPushP(filters, ax_filter);
+   rel = SinEIndexComputeRelevance(index, f_distrib, seed_start, filters);
+   res = SinERelevanceGetAxioms(rel, ax_filter, NULL,
+                                res_clauses, res_formulas);
+   SinERelevanceFree(rel);
+   PStackFree(filters);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SelectAxioms()
@@ -629,7 +1535,7 @@ long SelectDefiningAxioms(DRelation_p drel,
 //
 // Global Variables: -
 //
-// Side Effects    : Many, none expected permanent.
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
@@ -641,81 +1547,15 @@ long SelectAxioms(GenDistrib_p      f_distrib,
                   PStack_p          res_clauses,
                   PStack_p          res_formulas)
 {
-   long          res   = 0;
-   long          seeds = 0;
-   DRelation_p   drel  = DRelationAlloc();
-   PQueue_p      selq  = PQueueAlloc();
-   PStackPointer i;
-   long          ax_cardinality, max_result_size;
+   SinEIndex_p index = SinEIndexAlloc();
+   long        res;
 
    assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
 
-   /* fprintf(GlobalOut, "# Axiom selection starts (%lld)\n",
-      GetSecTimeMod()); */
-   DRelationAddClauseSets(drel, f_distrib,
-                          ax_filter->gen_measure,
-                          ax_filter->benevolence,
-                          ax_filter->generosity,
-                          clause_sets);
-   DRelationAddFormulaSets(drel, f_distrib,
-                           ax_filter->gen_measure,
-                           ax_filter->benevolence,
-                           ax_filter->generosity,
-                           formula_sets);
-   /* fprintf(GlobalOut, "# DRelation constructed (%lld)\n",
-    * GetSecTimeMod()); */
-
-   for(i=seed_start; i<PStackGetSP(clause_sets); i++)
-   {
-      seeds += ClauseSetFindAxSelectionSeeds(PStackElementP(clause_sets, i),
-                                             selq,
-                                             ax_filter->use_hypotheses);
-      seeds += FormulaSetFindAxSelectionSeeds(PStackElementP(formula_sets, i),
-                                              selq,
-                                              ax_filter->use_hypotheses);
-   }
-   /* fprintf(GlobalOut, "# Hypotheses found (%lld)\n",
-      GetSecTimeMod()); */
-   VERBOSE(fprintf(stderr, "# Found %ld seed clauses/formulas\n", seeds););
-   if(!seeds)
-   {
-      /* No goals-> the empty set contains all relevant clauses */
-   }
-   else
-   {
-      ax_cardinality =
-         FormulaSetStackCardinality(formula_sets)+
-         ClauseSetStackCardinality(clause_sets);
-      max_result_size = ax_filter->max_set_fraction*ax_cardinality;
-      if(ax_filter->max_set_size < max_result_size)
-      {
-         max_result_size = ax_filter->max_set_size;
-      }
-      if(true)
-         /* "true" may be exported as an option eventually */
-      {
-         DRel_p no_symbol_axioms = PDArrayElementP(drel->relation, 0);
-         if(no_symbol_axioms && ax_filter->add_no_symbol_axioms)
-         {
-            PStackPushStack(res_clauses,  no_symbol_axioms->d_clauses);
-            PStackPushStack(res_formulas, no_symbol_axioms->d_formulas);
-         }
-         res = PStackGetSP(res_clauses)+PStackGetSP(res_formulas);
-      }
-      res += SelectDefiningAxioms(drel,
-                                 f_distrib->sig,
-                                 ax_filter->max_recursion_depth,
-                                 max_result_size,
-                                 selq,
-                                 res_clauses,
-                                 res_formulas);
-   }
-   PStackFormulaDelProp(res_formulas, CPIsRelevant);
-   PStackClauseDelProp(res_clauses, CPIsRelevant);
-   /* fprintf(GlobalOut, "# Axioms selected (%lld)\n",
-      GetSecTimeMod()); */
-   PQueueFree(selq);
-   DRelationFree(drel);
+   SinEIndexUpdate(index, f_distrib, clause_sets, formula_sets);
+   res = SinEIndexSelectAxioms(index, f_distrib, seed_start, ax_filter,
+                               res_clauses, res_formulas);
+   SinEIndexFree(index);
 
    return res;
 }
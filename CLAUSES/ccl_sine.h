@@ -26,6 +26,7 @@ Changes
 
 #define CCL_SINE
 
+#include <clb_bitsets.h>
 #include <ccl_f_generality.h>
 
 
@@ -63,6 +64,78 @@ typedef enum
 }AxiomType;
 
 
+/* Compact index of the symbols of a sequence of axioms (of one
+   type). The distinct symbols of axiom i are
+   symbols[start[i]...start[i+1]-1], in order of first occurrence in
+   the axiom. */
+
+typedef struct sine_ax_list_cell
+{
+   PStack_p axioms;   /* Clause_p or WFormula_p */
+   PStack_p start;    /* One more element than axioms */
+   PStack_p symbols;
+}SinEAxListCell, *SinEAxList_p;
+
+
+/* Index of the axioms in a stack of clause sets and a (parallel)
+   stack of formula sets, with clauses and formulas numbered
+   separately in order of the sets. The index can be extended by
+   further sets and backtracked to a prefix of the sets, so that it
+   is built once for a shared axiom library and only extended by the
+   problem-specific part. */
+
+typedef struct sine_index_cell
+{
+   PStack_p     clause_sets;  /* Sets in the index */
+   PStack_p     formula_sets;
+   PStack_p     clause_set_start;  /* Number of the first clause... */
+   PStack_p     formula_set_start; /* ...and formula of each set */
+   SinEAxList_p clauses;
+   SinEAxList_p formulas;
+}SinEIndexCell, *SinEIndex_p;
+
+
+/* D-Relation for the axioms of a SinEAxList (for a given filter and
+   generality distribution), as adjacency arrays: The axioms in
+   D-relation with symbol f are axioms[start[f]...start[f+1]-1]
+   (in increasing order). */
+
+typedef struct sine_d_rel_cell
+{
+   FunCode f_count;
+   long    *start;   /* f_count+2 elements */
+   long    size;
+   long    *axioms;  /* size elements */
+}SinEDRelCell, *SinEDRel_p;
+
+
+/* Result of one SinE selection run: The selected axioms in order of
+   selection, each with the recursion level at which it was
+   selected. The run depends only on the D-relation (generality
+   measure, benevolence, generosity) and the seeds (use of
+   hypotheses). All filters that agree on these select a prefix of
+   this sequence (plus, optionally, the axioms without symbols), so
+   one run serves all of them as long as it was not cut off by
+   smaller limits than theirs. */
+
+typedef struct sine_relevance_cell
+{
+   GeneralityMeasure gen_measure;
+   double            benevolence;
+   long              generosity;
+   bool              use_hypotheses;
+   PStackPointer     seed_start;
+   long              seeds;
+   long              ax_cardinality;
+   long              max_level;     /* Limits of the run, irrelevant */
+   long              max_selected;  /* if the run is complete.       */
+   bool              complete;
+   PStack_p          no_symbol_clauses;
+   PStack_p          no_symbol_formulas;
+   PStack_p          selected;      /* Triples (type, axiom, level) */
+}SinERelevanceCell, *SinERelevance_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -123,6 +196,50 @@ void DRelationAddFormulaSets(DRelation_p drel,
                              long generosity,
                              PStack_p sets);
 
+#define SinEAxListCellAlloc() (SinEAxListCell*)SizeMalloc(sizeof(SinEAxListCell))
+#define SinEAxListCellFree(junk) SizeFree(junk, sizeof(SinEAxListCell))
+#define SinEDRelCellAlloc() (SinEDRelCell*)SizeMalloc(sizeof(SinEDRelCell))
+#define SinEDRelCellFree(junk) SizeFree(junk, sizeof(SinEDRelCell))
+#define SinEIndexCellAlloc() (SinEIndexCell*)SizeMalloc(sizeof(SinEIndexCell))
+#define SinEIndexCellFree(junk) SizeFree(junk, sizeof(SinEIndexCell))
+
+SinEIndex_p SinEIndexAlloc(void);
+void        SinEIndexFree(SinEIndex_p junk);
+void        SinEIndexBacktrack(SinEIndex_p index, PStackPointer sets);
+void        SinEIndexUpdate(SinEIndex_p index, GenDistrib_p generality,
+                            PStack_p clause_sets, PStack_p formula_sets);
+
+#define SinERelevanceCellAlloc() (SinERelevanceCell*)SizeMalloc(sizeof(SinERelevanceCell))
+#define SinERelevanceCellFree(junk) SizeFree(junk, sizeof(SinERelevanceCell))
+
+bool            SinEFiltersShareRelevance(AxFilter_p filter1,
+                                          AxFilter_p filter2);
+SinERelevance_p SinEIndexComputeRelevance(SinEIndex_p   index,
+                                          GenDistrib_p  f_distrib,
+                                          PStackPointer seed_start,
+                                          PStack_p      filters);
+void            SinERelevanceFree(SinERelevance_p junk);
+bool            SinERelevanceCovers(SinERelevance_p rel,
+                                    PStackPointer seed_start,
+                                    AxFilter_p ax_filter);
+long            SinERelevancePrefixLength(SinERelevance_p rel,
+                                          AxFilter_p ax_filter);
+bool            SinERelevanceFilterExtends(SinERelevance_p rel,
+                                           AxFilter_p ax_filter,
+                                           AxFilter_p base);
+long            SinERelevanceGetAxioms(SinERelevance_p rel,
+                                       AxFilter_p ax_filter,
+                                       AxFilter_p base,
+                                       PStack_p res_clauses,
+                                       PStack_p res_formulas);
+
+long        SinEIndexSelectAxioms(SinEIndex_p   index,
+                                  GenDistrib_p  f_distrib,
+                                  PStackPointer seed_start,
+                                  AxFilter_p    ax_filter,
+                                  PStack_p      res_clauses,
+                                  PStack_p      res_formulas);
+
 void PQueueStoreClause(PQueue_p axioms, Clause_p clause);
 void PQueueStoreFormula(PQueue_p axioms, WFormula_p form);
 
@@ -1293,6 +1293,34 @@ Clause_p ClauseSetSubsumesFVPackedClause(ClauseSet_p set,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: FVIAnchorSubsumesFVPackedClause()
+//
+//   Return a clause from the feature vector index that subsumes
+//   sub_candidate->clause, or NULL. This allows subsumption checks
+//   against indexed clauses that are not (or not all) members of a
+//   single clause set. All clauses need correct weights!
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+Clause_p FVIAnchorSubsumesFVPackedClause(FVIAnchor_p index,
+                                         FVPackedClause_p sub_candidate)
+{
+   Clause_p res;
+
+   assert(sub_candidate->array);
+   PERF_CTR_ENTRY(SetSubsumeTimer);
+   res = clause_set_subsumes_clause_indexed(index->index, sub_candidate, 0);
+   PERF_CTR_EXIT(SetSubsumeTimer);
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetSubsumesClause()
@@ -66,6 +66,8 @@ Clause_p ClauseSetSubsumesFVPackedClause(ClauseSet_p set,
                 FVPackedClause_p sub_candidate);
 Clause_p ClauseSetSubsumesClause(ClauseSet_p set, Clause_p
              sub_candidate);
+Clause_p FVIAnchorSubsumesFVPackedClause(FVIAnchor_p index,
+                                         FVPackedClause_p sub_candidate);
 Clause_p ClauseSetFindSubsumedClause(ClauseSet_p set, Clause_p
                  set_position, Clause_p
                  subsumer);
@@ -381,6 +381,52 @@ bool tformula_rename_test(TB_p bank, TFormula_p root, int pos,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: tformula_count_shared()
+//
+//   If root|pos would be replicated when clausifying root (with the
+//   given polarity), count this occurrence of root|pos (with
+//   polarity sub_polarity) in counts. In counts, the key is the
+//   entry_no, vals[0] is the number of occurrences, vals[1] the most
+//   general polarity, and vals[2] the subformula.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes counts
+//
+/----------------------------------------------------------------------*/
+
+static void tformula_count_shared(TB_p bank, TFormula_p root, int pos,
+                                  int polarity, int sub_polarity,
+                                  NumXTree_p *counts)
+{
+   TFormula_p form = root->args[pos];
+   NumXTree_p cell;
+
+   if(TFormulaIsLiteral(bank->sig, form) ||
+      !tformula_rename_test(bank, root, pos, polarity, 1))
+   {
+      return;
+   }
+   cell = NumXTreeFind(counts, form->entry_no);
+   if(!cell)
+   {
+      cell = NumXTreeCellAllocEmpty();
+      cell->key = form->entry_no;
+      cell->vals[0].i_val = 0;
+      cell->vals[1].i_val = sub_polarity;
+      cell->vals[2].p_val = form;
+      NumXTreeInsert(counts, cell);
+   }
+   cell->vals[0].i_val++;
+   if(cell->vals[1].i_val != sub_polarity)
+   {
+      cell->vals[1].i_val = 0;
+   }
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -969,6 +1015,67 @@ void TFormulaFindDefs(TB_p bank, TFormula_p form, int polarity,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TFormulaCountSharedDefs()
+//
+//   Count the occurrences of all subformulas of form that would be
+//   replicated by clausification (i.e. the candidates for
+//   TFormulaFindDefs() with a def_limit of 1) in counts (see
+//   tformula_count_shared()). As formulas are shared in the term
+//   bank, calling this for all formulas of a set finds subformulas
+//   that are replicated across the set, even if they never exceed the
+//   limit within a single formula.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes counts
+//
+/----------------------------------------------------------------------*/
+
+void TFormulaCountSharedDefs(TB_p bank, TFormula_p form, int polarity,
+                             NumXTree_p *counts)
+{
+   assert((polarity<=1) && (polarity >=-1));
+
+   if(TFormulaIsLiteral(bank->sig, form))
+   {
+      return;
+   }
+   if((form->f_code == bank->sig->and_code)||
+      (form->f_code == bank->sig->or_code))
+   {
+      TFormulaCountSharedDefs(bank, form->args[0], polarity, counts);
+      tformula_count_shared(bank, form, 0, polarity, polarity, counts);
+   }
+   else if((form->f_code == bank->sig->not_code)||
+           (form->f_code == bank->sig->impl_code))
+   {
+      TFormulaCountSharedDefs(bank, form->args[0], -polarity, counts);
+      tformula_count_shared(bank, form, 0, -polarity, -polarity, counts);
+   }
+   else if(form->f_code == bank->sig->equiv_code)
+   {
+      TFormulaCountSharedDefs(bank, form->args[0], 0, counts);
+      tformula_count_shared(bank, form, 0, polarity, 0, counts);
+   }
+   if((form->f_code == bank->sig->and_code)||
+      (form->f_code == bank->sig->or_code) ||
+      (form->f_code == bank->sig->impl_code)||
+      (form->f_code == bank->sig->qex_code)||
+      (form->f_code == bank->sig->qall_code))
+   {
+      TFormulaCountSharedDefs(bank, form->args[1], polarity, counts);
+      tformula_count_shared(bank, form, 1, polarity, polarity, counts);
+   }
+   else if(form->f_code == bank->sig->equiv_code)
+   {
+      TFormulaCountSharedDefs(bank, form->args[1], 0, counts);
+      tformula_count_shared(bank, form, 1, polarity, 0, counts);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TFormulaCopyDef()
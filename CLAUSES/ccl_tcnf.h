@@ -49,6 +49,8 @@ TFormula_p TFormulaDefRename(TB_p bank, TFormula_p form, int polarity,
 void TFormulaFindDefs(TB_p bank, TFormula_p form, int polarity,
                       long def_limit, NumXTree_p *defs,
                       PStack_p renamed_forms);
+void TFormulaCountSharedDefs(TB_p bank, TFormula_p form, int polarity,
+                             NumXTree_p *counts);
 TFormula_p TFormulaCopyDef(TB_p bank, TFormula_p form, long blocked,
                            NumXTree_p *defs, PStack_p defs_used);
 TFormula_p TFormulaSimplify(TB_p terms, TFormula_p form, bool full_simpl);
@@ -41,6 +41,7 @@ typedef Term_p TFormula_p;
 
 #define TFORM_RENAME_LIMIT          24
 #define TFORM_RENAME_LIMIT_STR     "24"
+#define TFORM_SHARE_LIMIT_STR      "4"
 #define TFORM_MINISCOPE_LIMIT_STR  "2147483648"
 
 #define   TFormulaHasSubForm1(sig, form)\
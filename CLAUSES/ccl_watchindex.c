@@ -0,0 +1,723 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_watchindex.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Watchlist indexing by literal keys and key fingerprints, and
+  tracking of partial matches of watch clauses.
+
+  A literal key combines the sign, the equational-ness and a top
+  symbol. A watch literal is filed under all keys a subsuming
+  literal could require: A predicate literal under its predicate, an
+  equational literal under the generic key for its sign (f_code 0)
+  and under the top symbols of its non-variable sides. A literal of
+  a potential subsumer requires the keys of the top symbols of its
+  non-variable sides (or the generic key if both sides are
+  variables).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 02:31:05 CEST 2026
+    New
+<2> Wed Oct 21 11:02:37 CEST 2026
+    Progress is the matched fraction of the watch clause
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_watchindex.h"
+#include "ccl_subsumption.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define WATCH_KEY(f_code, equational, positive)                 \
+   (((long)(f_code)<<2)|((equational)?2:0)|((positive)?1:0))
+
+#define WATCH_FP_BIT(key) (1UL<<(((key)^((key)>>6))&63))
+
+/* Every literal has at most 3 watch keys and at most 2 required
+   keys */
+
+#define WATCH_MAX_LIT_KEYS 3
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_entry_cmp()
+//
+//   Compare two watch entries by their clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int watch_entry_cmp(const void* e1, const void* e2)
+{
+   const WatchEntry_p entry1 = (const WatchEntry_p)e1;
+   const WatchEntry_p entry2 = (const WatchEntry_p)e2;
+
+   return PCmp(entry1->clause, entry2->clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: long_cmp()
+//
+//   Compare two longs for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int long_cmp(const void* l1, const void* l2)
+{
+   const long *k1 = (const long*)l1;
+   const long *k2 = (const long*)l2;
+
+   return (*k1>*k2)-(*k1<*k2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_entry_free()
+//
+//   Free a watch entry and its key and fingerprint arrays.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void watch_entry_free(WatchEntry_p junk)
+{
+   if(junk->keys)
+   {
+      SizeFree(junk->keys, junk->key_no*sizeof(long));
+   }
+   if(junk->lit_fps)
+   {
+      SizeFree(junk->lit_fps, junk->lit_no*sizeof(unsigned long));
+   }
+   WatchEntryCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_literal_keys()
+//
+//   Store the keys a watch literal is filed under in keys, return
+//   their number.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int watch_literal_keys(Eqn_p lit, long *keys)
+{
+   int  res = 0;
+   bool pos = EqnIsPositive(lit);
+
+   if(!EqnIsEquLit(lit))
+   {
+      keys[res++] = WATCH_KEY(lit->lterm->f_code, false, pos);
+      return res;
+   }
+   keys[res++] = WATCH_KEY(0, true, pos);
+   if(!TermIsVar(lit->lterm))
+   {
+      keys[res++] = WATCH_KEY(lit->lterm->f_code, true, pos);
+   }
+   if(!TermIsVar(lit->rterm))
+   {
+      keys[res++] = WATCH_KEY(lit->rterm->f_code, true, pos);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_required_keys()
+//
+//   Store the keys any watch literal subsumed by lit is filed under
+//   in keys, return their number.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int watch_required_keys(Eqn_p lit, long *keys)
+{
+   int  res = 0;
+   bool pos = EqnIsPositive(lit);
+
+   if(!EqnIsEquLit(lit))
+   {
+      keys[res++] = WATCH_KEY(lit->lterm->f_code, false, pos);
+      return res;
+   }
+   if(!TermIsVar(lit->lterm))
+   {
+      keys[res++] = WATCH_KEY(lit->lterm->f_code, true, pos);
+   }
+   if(!TermIsVar(lit->rterm))
+   {
+      keys[res++] = WATCH_KEY(lit->rterm->f_code, true, pos);
+   }
+   if(!res)
+   {
+      keys[res++] = WATCH_KEY(0, true, pos);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_select_bucket()
+//
+//   Compute the fingerprint masks required by the literals of clause
+//   in masks, and return the smallest non-empty bucket of a required
+//   key (or NULL). *complete is set if all required keys have a
+//   bucket, i.e. if clause can subsume any watch clause at all.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static WatchBucket_p watch_select_bucket(WatchIndex_p index, Clause_p clause,
+                                         unsigned long *masks, bool *complete)
+{
+   WatchBucket_p bucket, res = NULL;
+   Eqn_p         lit;
+   long          keys[WATCH_MAX_LIT_KEYS];
+   int           i, key_no, lit_no = 0;
+
+   *complete = true;
+   for(lit = clause->literals; lit; lit = lit->next)
+   {
+      masks[lit_no] = 0;
+      key_no = watch_required_keys(lit, keys);
+      for(i=0; i<key_no; i++)
+      {
+         masks[lit_no] |= WATCH_FP_BIT(keys[i]);
+         bucket = IntMapGetVal(index->buckets, keys[i]);
+         if(!bucket)
+         {
+            *complete = false;
+         }
+         else if(!res || bucket->count < res->count)
+         {
+            res = bucket;
+         }
+      }
+      lit_no++;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_progress_bound()
+//
+//   Return an upper bound for the fraction of the literals of the
+//   watch clause of entry that are matched by one of the lit_no
+//   literals with the given masks. A watch literal can only be
+//   matched by a literal whose mask is covered by the fingerprint of
+//   the watch literal.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static double watch_progress_bound(unsigned long *masks, int lit_no,
+                                   WatchEntry_p entry)
+{
+   int i, j, res = 0;
+
+   if(!entry->lit_no)
+   {
+      return 0.0;
+   }
+   for(j=0; j<entry->lit_no; j++)
+   {
+      for(i=0; i<lit_no; i++)
+      {
+         if(!(masks[i] & ~entry->lit_fps[j]))
+         {
+            res++;
+            break;
+         }
+      }
+   }
+   return (double)res/entry->lit_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_literal_matches()
+//
+//   Return true if lit matches target (in either orientation for
+//   equations). subst is unchanged afterwards.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool watch_literal_matches(Eqn_p lit, Eqn_p target, Subst_p subst)
+{
+   PStackPointer base = PStackGetSP(subst);
+   bool          res = false;
+
+   if(!EqnIsPositive(lit) != !EqnIsPositive(target) ||
+      !EqnIsEquLit(lit) != !EqnIsEquLit(target))
+   {
+      return false;
+   }
+   if(SubstComputeMatch(lit->lterm, target->lterm, subst) &&
+      SubstComputeMatch(lit->rterm, target->rterm, subst))
+   {
+      res = true;
+   }
+   SubstBacktrackToPos(subst, base);
+   if(!res && EqnIsEquLit(lit) &&
+      SubstComputeMatch(lit->lterm, target->rterm, subst) &&
+      SubstComputeMatch(lit->rterm, target->lterm, subst))
+   {
+      res = true;
+   }
+   SubstBacktrackToPos(subst, base);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_match_degree()
+//
+//   Return the fraction of literals of watch that are (individually)
+//   matched by a literal of clause, i.e. how much of the watch clause
+//   clause covers. A short clause matching one literal of a long
+//   watch clause thus makes little progress on it.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static double watch_match_degree(Clause_p clause, Clause_p watch)
+{
+   Subst_p subst;
+   Eqn_p   lit, target;
+   int     lit_no = ClauseLiteralNumber(watch), matched = 0;
+
+   if(!lit_no)
+   {
+      return 0.0;
+   }
+   subst = SubstAlloc();
+   for(target = watch->literals; target; target = target->next)
+   {
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         if(watch_literal_matches(lit, target, subst))
+         {
+            matched++;
+            break;
+         }
+      }
+   }
+   SubstFree(subst);
+   return (double)matched/lit_no;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexAlloc()
+//
+//   Allocate an empty watch index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+WatchIndex_p WatchIndexAlloc(void)
+{
+   WatchIndex_p handle = WatchIndexCellAlloc();
+
+   handle->buckets    = IntMapAlloc();
+   handle->entries    = NULL;
+   handle->members    = 0;
+   handle->queries    = 0;
+   handle->candidates = 0;
+   handle->sub_tests  = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexFree()
+//
+//   Free a watch index. The clauses are not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void WatchIndexFree(WatchIndex_p junk)
+{
+   IntMapIter_p  iter;
+   WatchBucket_p bucket;
+   WatchEntry_p  entry;
+   long          key;
+
+   iter = IntMapIterAlloc(junk->buckets, 0, LONG_MAX);
+   while((bucket = IntMapIterNext(iter, &key)))
+   {
+      PTreeFree(bucket->entries);
+      WatchBucketCellFree(bucket);
+   }
+   IntMapIterFree(iter);
+   IntMapFree(junk->buckets);
+
+   while(junk->entries)
+   {
+      entry = PTreeObjExtractRootObject(&(junk->entries), watch_entry_cmp);
+      watch_entry_free(entry);
+   }
+   WatchIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexInsert()
+//
+//   Insert a watch clause into the index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+void WatchIndexInsert(WatchIndex_p index, Clause_p clause)
+{
+   WatchEntry_p  entry = WatchEntryCellAlloc();
+   WatchBucket_p bucket;
+   Eqn_p         lit;
+   long          *keys, size;
+   int           i, lit_keys, key_no = 0;
+
+   entry->lit_no  = ClauseLiteralNumber(clause);
+   entry->lit_fps = NULL;
+   if(entry->lit_no)
+   {
+      entry->lit_fps = SizeMalloc(entry->lit_no*sizeof(unsigned long));
+   }
+   size = MAX(entry->lit_no, 1)*WATCH_MAX_LIT_KEYS*sizeof(long);
+   keys = SizeMalloc(size);
+   for(lit = clause->literals, i = 0; lit; lit = lit->next, i++)
+   {
+      lit_keys = watch_literal_keys(lit, keys+key_no);
+      entry->lit_fps[i] = 0;
+      for(; lit_keys; lit_keys--, key_no++)
+      {
+         entry->lit_fps[i] |= WATCH_FP_BIT(keys[key_no]);
+      }
+   }
+   qsort(keys, key_no, sizeof(long), long_cmp);
+
+   entry->clause      = clause;
+   entry->fingerprint = 0;
+   entry->progress    = 0.0;
+   entry->key_no      = 0;
+   for(i=0; i<key_no; i++)
+   {
+      if(i && keys[i] == keys[i-1])
+      {
+         continue;
+      }
+      keys[entry->key_no++] = keys[i];
+      entry->fingerprint |= WATCH_FP_BIT(keys[i]);
+   }
+   entry->keys = NULL;
+   if(entry->key_no)
+   {
+      entry->keys = SizeMalloc(entry->key_no*sizeof(long));
+      memcpy(entry->keys, keys, entry->key_no*sizeof(long));
+   }
+   SizeFree(keys, size);
+
+   for(i=0; i<entry->key_no; i++)
+   {
+      bucket = IntMapGetVal(index->buckets, entry->keys[i]);
+      if(!bucket)
+      {
+         bucket = WatchBucketCellAlloc();
+         bucket->count   = 0;
+         bucket->entries = NULL;
+         IntMapAssign(index->buckets, entry->keys[i], bucket);
+      }
+      PTreeStore(&(bucket->entries), entry);
+      bucket->count++;
+   }
+   PTreeObjStore(&(index->entries), entry, watch_entry_cmp);
+   index->members++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexDelete()
+//
+//   Remove a watch clause from the index. Return true if it was
+//   found.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+bool WatchIndexDelete(WatchIndex_p index, Clause_p clause)
+{
+   WatchEntryCell key;
+   WatchEntry_p   entry;
+   WatchBucket_p  bucket;
+   int            i;
+
+   key.clause = clause;
+   entry = PTreeObjExtractObject(&(index->entries), &key, watch_entry_cmp);
+   if(!entry)
+   {
+      return false;
+   }
+   for(i=0; i<entry->key_no; i++)
+   {
+      bucket = IntMapGetVal(index->buckets, entry->keys[i]);
+      assert(bucket);
+      PTreeDeleteEntry(&(bucket->entries), entry);
+      bucket->count--;
+      if(!bucket->count)
+      {
+         assert(!bucket->entries);
+         IntMapDelKey(index->buckets, entry->keys[i]);
+         WatchBucketCellFree(bucket);
+      }
+   }
+   watch_entry_free(entry);
+   index->members--;
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexFindSubsumed()
+//
+//   Push all watch clauses subsumed by subsumer onto res and return
+//   their number. If record_progress is set, update the progress of
+//   the other watch clauses looked at with their match degree by
+//   subsumer. Requires subsume-ordered literals and correct weights
+//   for all clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes progress of watch clauses
+//
+/----------------------------------------------------------------------*/
+
+long WatchIndexFindSubsumed(WatchIndex_p index, Clause_p subsumer,
+                            PStack_p res, bool record_progress)
+{
+   WatchBucket_p bucket;
+   WatchEntry_p  entry;
+   PStack_p      trav;
+   PTree_p       node;
+   unsigned long *masks, all_mask = 0;
+   int           i, lit_no = ClauseLiteralNumber(subsumer);
+   long          found = 0;
+   bool          complete;
+   double        degree;
+
+   index->queries++;
+   if(!lit_no)
+   {
+      trav = PTreeTraverseInit(index->entries);
+      while((node = PTreeTraverseNext(trav)))
+      {
+         entry = node->key;
+         PStackPushP(res, entry->clause);
+         found++;
+      }
+      PTreeTraverseExit(trav);
+      return found;
+   }
+   masks = SizeMalloc(lit_no*sizeof(unsigned long));
+   bucket = watch_select_bucket(index, subsumer, masks, &complete);
+   if(bucket && (complete || record_progress))
+   {
+      for(i=0; i<lit_no; i++)
+      {
+         all_mask |= masks[i];
+      }
+      trav = PTreeTraverseInit(bucket->entries);
+      while((node = PTreeTraverseNext(trav)))
+      {
+         entry = node->key;
+         index->candidates++;
+         if(complete && !(all_mask & ~entry->fingerprint))
+         {
+            index->sub_tests++;
+            if(ClauseSubsumesClause(subsumer, entry->clause))
+            {
+               PStackPushP(res, entry->clause);
+               found++;
+               continue;
+            }
+         }
+         if(record_progress &&
+            watch_progress_bound(masks, lit_no, entry) > entry->progress)
+         {
+            degree = watch_match_degree(subsumer, entry->clause);
+            entry->progress = MAX(entry->progress, degree);
+         }
+      }
+      PTreeTraverseExit(trav);
+   }
+   SizeFree(masks, lit_no*sizeof(unsigned long));
+   return found;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexProgressGain()
+//
+//   Return the largest improvement (0..1) of the progress of a watch
+//   clause in the bucket selected for clause that clause would
+//   achieve if processed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double WatchIndexProgressGain(WatchIndex_p index, Clause_p clause)
+{
+   WatchBucket_p bucket;
+   WatchEntry_p  entry;
+   PStack_p      trav;
+   PTree_p       node;
+   unsigned long *masks;
+   int           lit_no = ClauseLiteralNumber(clause);
+   bool          complete;
+   double        res = 0.0, degree;
+
+   if(!lit_no)
+   {
+      return index->members?1.0:0.0;
+   }
+   masks = SizeMalloc(lit_no*sizeof(unsigned long));
+   bucket = watch_select_bucket(index, clause, masks, &complete);
+   if(bucket)
+   {
+      trav = PTreeTraverseInit(bucket->entries);
+      while((node = PTreeTraverseNext(trav)))
+      {
+         entry = node->key;
+         if(watch_progress_bound(masks, lit_no, entry)
+            - entry->progress > res)
+         {
+            degree = watch_match_degree(clause, entry->clause);
+            res = MAX(res, degree - entry->progress);
+         }
+      }
+      PTreeTraverseExit(trav);
+   }
+   SizeFree(masks, lit_no*sizeof(unsigned long));
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchIndexPrintStatistics()
+//
+//   Print statistics about the index as comments.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void WatchIndexPrintStatistics(FILE* out, WatchIndex_p index)
+{
+   fprintf(out, "# Watchlist index queries              : %ld\n",
+           index->queries);
+   fprintf(out, "# ...watch clauses looked at           : %ld\n",
+           index->candidates);
+   fprintf(out, "# ...passing the fingerprint test      : %ld\n",
+           index->sub_tests);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
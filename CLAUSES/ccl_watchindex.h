@@ -0,0 +1,108 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_watchindex.h
+
+Author: Stephan Schulz
+
+Contents
+
+  An index for watchlists: Watch clauses are filed under literal
+  keys made from the sign, the equational-ness and the top symbols
+  of their literals, and carry a 64 bit fingerprint of their key
+  set. A query clause only needs to look at the watch clauses in the
+  smallest bucket of its own required keys, and most of those are
+  rejected by the fingerprint before a subsumption test. The index
+  also records, for each watch clause, the best partial match by a
+  processed clause so far, so that clauses making progress on a
+  partially matched watch clause can be preferred.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 02:31:05 CEST 2026
+    New
+<2> Wed Oct 21 11:02:37 CEST 2026
+    Per-literal fingerprints for the progress bound
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_WATCHINDEX
+
+#define CCL_WATCHINDEX
+
+#include <ccl_clauses.h>
+#include <clb_intmap.h>
+#include <clb_objtrees.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* A watch clause with its (duplicate-free) keys, the fingerprints
+   of its individual literals, and the progress made on it, i.e. the
+   largest fraction of literals of the watch clause that are
+   individually matched by a literal of a single processed clause. */
+
+typedef struct watch_entry_cell
+{
+   Clause_p      clause;
+   unsigned long fingerprint;
+   double        progress;
+   int           key_no;
+   long          *keys;
+   int           lit_no;
+   unsigned long *lit_fps;
+}WatchEntryCell, *WatchEntry_p;
+
+typedef struct watch_bucket_cell
+{
+   long    count;
+   PTree_p entries;
+}WatchBucketCell, *WatchBucket_p;
+
+typedef struct watch_index_cell
+{
+   IntMap_p   buckets;    /* Literal key -> WatchBucket_p */
+   PObjTree_p entries;    /* All entries, ordered by clause */
+   long       members;
+   /* Statistics */
+   long       queries;
+   long       candidates; /* Watch clauses looked at */
+   long       sub_tests;  /* ...that passed the fingerprint test */
+}WatchIndexCell, *WatchIndex_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define WatchEntryCellAlloc() (WatchEntryCell*)SizeMalloc(sizeof(WatchEntryCell))
+#define WatchEntryCellFree(junk)            SizeFree(junk, sizeof(WatchEntryCell))
+#define WatchBucketCellAlloc() (WatchBucketCell*)SizeMalloc(sizeof(WatchBucketCell))
+#define WatchBucketCellFree(junk)            SizeFree(junk, sizeof(WatchBucketCell))
+#define WatchIndexCellAlloc() (WatchIndexCell*)SizeMalloc(sizeof(WatchIndexCell))
+#define WatchIndexCellFree(junk)            SizeFree(junk, sizeof(WatchIndexCell))
+
+WatchIndex_p WatchIndexAlloc(void);
+void         WatchIndexFree(WatchIndex_p junk);
+
+void         WatchIndexInsert(WatchIndex_p index, Clause_p clause);
+bool         WatchIndexDelete(WatchIndex_p index, Clause_p clause);
+
+long         WatchIndexFindSubsumed(WatchIndex_p index, Clause_p subsumer,
+                                    PStack_p res, bool record_progress);
+double       WatchIndexProgressGain(WatchIndex_p index, Clause_p clause);
+
+void         WatchIndexPrintStatistics(FILE* out, WatchIndex_p index);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
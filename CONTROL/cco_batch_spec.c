@@ -161,6 +161,39 @@ EPCtrl_p batch_create_runner(StructFOFSpec_p ctrl,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: batch_find_same_problem()
+//
+//   Return a filter from filters that is known to select the same
+//   problem as filter, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+AxFilter_p batch_find_same_problem(StructFOFSpec_p ctrl,
+                                   AxFilter_p filter,
+                                   PStack_p filters)
+{
+   AxFilter_p    handle;
+   PStackPointer i;
+
+   for(i=0; i<PStackGetSP(filters); i++)
+   {
+      handle = PStackElementP(filters, i);
+      if(StructFOFSpecFilterExtends(ctrl, filter, handle) &&
+         StructFOFSpecFilterExtends(ctrl, handle, filter))
+      {
+         return handle;
+      }
+   }
+   return NULL;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: parse_op_line()
@@ -525,6 +558,7 @@ void StructFOFSpecBacktrackToSpec(StructFOFSpec_p ctrl)
    ClauseSet_p clauses;
    FormulaSet_p formulas;
 
+   StructFOFSpecResetRelevance(ctrl);
    GenDistribBacktrackClauseSets(ctrl->f_distrib,
                                  ctrl->clause_sets,
                                  ctrl->shared_ax_sp);
@@ -546,7 +580,8 @@ void StructFOFSpecBacktrackToSpec(StructFOFSpec_p ctrl)
 // Function: StructFOFSpecGetProblem()
 //
 //   Given a prepared StructFOFSpec, get the clauses and formulas
-//   describing the problem.
+//   describing the problem. SinE filters use the precomputed
+//   selections (see StructFOFSpecInitRelevance()) if possible.
 //
 // Global Variables: -
 //
@@ -559,18 +594,32 @@ long StructFOFSpecGetProblem(StructFOFSpec_p ctrl,
                              PStack_p        res_clauses,
                              PStack_p        res_formulas)
 {
-   long res = 0;
+   long            res = 0;
+   SinERelevance_p rel;
 
    switch(ax_filter->type)
    {
    case AFGSinE:
-         res = SelectAxioms(ctrl->f_distrib,
-                            ctrl->clause_sets,
-                            ctrl->formula_sets,
-                            ctrl->shared_ax_sp,
-                            ax_filter,
-                            res_clauses,
-                            res_formulas);
+         rel = StructFOFSpecFindRelevance(ctrl, ax_filter);
+         if(rel)
+         {
+            res = SinERelevanceGetAxioms(rel, ax_filter, NULL,
+                                         res_clauses, res_formulas);
+            break;
+         }
+         /* Problem sets are always indexed anew, the shared sets only
+            if they have changed */
+         SinEIndexBacktrack(ctrl->ax_index, ctrl->shared_ax_sp);
+         SinEIndexUpdate(ctrl->ax_index,
+                         ctrl->f_distrib,
+                         ctrl->clause_sets,
+                         ctrl->formula_sets);
+         res = SinEIndexSelectAxioms(ctrl->ax_index,
+                                     ctrl->f_distrib,
+                                     ctrl->shared_ax_sp,
+                                     ax_filter,
+                                     res_clauses,
+                                     res_formulas);
          break;
    case AFThreshold:
          res = SelectThreshold(ctrl->clause_sets,
@@ -617,6 +666,9 @@ bool BatchProcessProblem(BatchSpec_p spec,
    EPCtrlSet_p procs = EPCtrlSetAlloc();
    long long start, secs, used, now, remaining;
    AxFilterSet_p filters = AxFilterSetCreateInternal(AxFilterDefaultSet);
+   PStack_p batch_filters = PStackAlloc();
+   PStack_p started = PStackAlloc();
+   AxFilter_p filter, base;
    int i;
    char* answers = spec->res_answer==BONone?"":"--conjectures-are-questions";
 
@@ -627,26 +679,45 @@ bool BatchProcessProblem(BatchSpec_p spec,
                           fset);
 
    secs = GetSecTime();
+   for(i=0; BatchFilters[i]; i++)
+   {
+      PStackPushP(batch_filters,
+                  AxFilterSetFindFilter(filters, BatchFilters[i]));
+   }
+   StructFOFSpecInitRelevance(ctrl, batch_filters);
+
+   filter = PStackElementP(batch_filters, 0);
    handle = batch_create_runner(ctrl, spec->executable,
                                 answers,
                                 wct_limit,
-                                AxFilterSetFindFilter(filters,
-                                                      BatchFilters[0]));
-
+                                filter);
    EPCtrlSetAddProc(procs, handle);
+   PStackPushP(started, filter);
 
    i=1;
    while(((used = (GetSecTime()-secs)) < (wct_limit/2)) &&
          BatchFilters[i])
    {
-      handle = batch_create_runner(ctrl, spec->executable,
-                                   answers,
-                                   wct_limit,
-                                   AxFilterSetFindFilter(filters,
-                                                         BatchFilters[i]));
-      EPCtrlSetAddProc(procs, handle);
+      filter = PStackElementP(batch_filters, i);
+      base = batch_find_same_problem(ctrl, filter, started);
+      if(base)
+      {
+         fprintf(GlobalOut, "# Filter %s selects the same problem as %s\n",
+                 filter->name, base->name);
+      }
+      else
+      {
+         handle = batch_create_runner(ctrl, spec->executable,
+                                      answers,
+                                      wct_limit,
+                                      filter);
+         EPCtrlSetAddProc(procs, handle);
+         PStackPushP(started, filter);
+      }
       i++;
    }
+   PStackFree(started);
+   PStackFree(batch_filters);
    AxFilterSetFree(filters);
 
 
@@ -573,6 +573,9 @@ char* unstage_command(InteractiveSpec_p interactive, DStr_p axiom_set)
       {
          GenDistribAddFormulaSet(interactive->ctrl->f_distrib, fhandle, -1);
          GenDistribAddClauseSet(interactive->ctrl->f_distrib, chandle, -1);
+         /* The set may be freed and its memory reused */
+         SinEIndexBacktrack(interactive->ctrl->ax_index,
+                            PStackGetSP(interactive->ctrl->clause_sets));
          found = 1;
          break;
       }
@@ -340,7 +340,8 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
 //
 // Function: ClauseSetReweight()
 //
-//   Re-Evaluate all clauses in set.
+//   Re-Evaluate all clauses in set. The clauses stay in place, the
+//   evaluation indices are rebuilt in bulk afterwards.
 //
 // Global Variables: -
 //
@@ -350,32 +351,129 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
 
 void ClauseSetReweight(HCB_p heuristic, ClauseSet_p set)
 {
-   Clause_p    handle;
-   ClauseSet_p tmp_set;
+   Clause_p handle;
+   int      i;
 
    assert(heuristic);
    assert(set);
    assert(!set->demod_index);
 
-
    ClauseSetRemoveEvaluations(set);
-   tmp_set = ClauseSetAlloc();
 
-   while(!ClauseSetEmpty(set))
+   for(handle = set->anchor->succ; handle!=set->anchor;
+       handle=handle->succ)
+   {
+      HCBClauseEvaluate(heuristic, handle);
+   }
+   if(!ClauseSetEmpty(set))
+   {
+      set->eval_no = MAX(heuristic->wfcb_no, set->eval_no);
+   }
+   for(i=0; i<heuristic->wfcb_no; i++)
    {
-      ClauseSetInsert(tmp_set, ClauseSetExtractFirst(set));
+      ClauseSetRebuildEvalIndex(set, i);
    }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetReweightStateDependent()
+//
+//   Re-evaluate all clauses in set, but only for the state-dependent
+//   evaluations of heuristic, and rebuild the corresponding indices
+//   in bulk. All other evaluations (and indices) are kept. The
+//   clauses must have been evaluated by heuristic.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
 
-   while(!ClauseSetEmpty(tmp_set))
+void ClauseSetReweightStateDependent(HCB_p heuristic, ClauseSet_p set)
+{
+   Clause_p handle;
+   int      i;
+
+   assert(heuristic);
+   assert(set);
+
+   for(i=0; i<heuristic->wfcb_no; i++)
    {
-      handle = ClauseSetExtractFirst(tmp_set);
-      HCBClauseEvaluate(heuristic, handle);
-      ClauseSetInsert(set, handle);
+      if(!HCBEvalIsStateDependent(heuristic, i))
+      {
+         continue;
+      }
+      for(handle = set->anchor->succ; handle!=set->anchor;
+          handle=handle->succ)
+      {
+         HCBClauseReevaluate(heuristic, handle, i);
+      }
+      ClauseSetRebuildEvalIndex(set, i);
    }
-   ClauseSetFree(tmp_set);
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetReweightIncremental()
+//
+//   Re-evaluate (at most) the first count clauses of set for the
+//   state-dependent evaluations of heuristic only, moving each
+//   re-evaluated clause to the end of the set. Calling this
+//   repeatedly with a total of set->members clauses thus reweights
+//   the whole set in small steps. Returns number of clauses
+//   processed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes evaluations and clause order
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetReweightIncremental(HCB_p heuristic, ClauseSet_p set,
+                                  long count)
+{
+   Clause_p handle;
+   long     res;
+   int      i;
+#ifndef NDEBUG
+   Eval_p   test;
+#endif
+
+   assert(heuristic);
+   assert(set);
+
+   count = MIN(count, set->members);
+   for(res = 0; res < count; res++)
+   {
+      handle = ClauseSetRotateFirst(set);
+      assert(handle->evaluations);
+
+      for(i=0; i<heuristic->wfcb_no; i++)
+      {
+         if(!HCBEvalIsStateDependent(heuristic, i))
+         {
+            continue;
+         }
+#ifndef NDEBUG
+         test =
+#endif
+            EvalTreeExtractEntry(ClauseSetEvalIndex(set, i),
+                                 handle->evaluations, i);
+         assert(test);
+         HCBClauseReevaluate(heuristic, handle, i);
+#ifndef NDEBUG
+         test =
+#endif
+            EvalTreeInsert(ClauseSetEvalIndex(set, i),
+                           handle->evaluations, i);
+         assert(!test);
+      }
+   }
+   return res;
+}
 
 
 /*-----------------------------------------------------------------------
@@ -71,6 +71,9 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
              terminate_on_empty);
 
 void     ClauseSetReweight(HCB_p heuristic, ClauseSet_p set);
+void     ClauseSetReweightStateDependent(HCB_p heuristic, ClauseSet_p set);
+long     ClauseSetReweightIncremental(HCB_p heuristic, ClauseSet_p set,
+                                      long count);
 
 Clause_p ForwardContractSetReweight(ProofState_p state, ProofControl_p
                 control, ClauseSet_p set, bool
@@ -0,0 +1,479 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_presat.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Parallel subsumption pre-pass for presaturation interreduction.
+
+  The initial clauses with at most PRESAT_MAX_SUBSUMER_LITS literals
+  are indexed once in a feature vector index, and all clauses are
+  partitioned by the largest literal key (predicate symbol or
+  equality, and sign) of each clause. This key does not depend on
+  literal order or variable names, so all variants of a clause end
+  up in the same partition. Partitions are distributed over worker
+  processes, each of which walks its clauses in order, temporarily
+  removes the clause from its (private, copy-on-write) view of the
+  index and tests whether the remaining indexed clauses subsume
+  it. Restricting subsumers to short clauses keeps the pass cheap -
+  multi-literal subsumption against long clauses backtracks
+  exponentially and is better left to the serial interreduction. Workers
+  report the positions of subsumed clauses back through a pipe.
+
+  Since every deleted clause is subsumed by a clause that is either
+  retained or itself subsumed by a strictly more general one (mutual
+  subsumption only happens between variants, which are handled
+  sequentially by the same worker), the result is equivalent to the
+  original clause set. The serial interreduction that follows
+  catches everything across partitions the workers cannot see
+  (rewriting, subsumption of clauses deleted concurrently).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "cco_presat.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+typedef struct presat_bucket_cell
+{
+   long key;
+   long size;
+}PresatBucketCell, *PresatBucket_p;
+
+#define PRESAT_READ_BUFFER 1024
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_clause_key()
+//
+//   Return the partition key of a clause, i.e. the largest key of
+//   any of its literals. Literal keys encode the predicate symbol (0
+//   for true equations) and the sign.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long presat_clause_key(Clause_p clause)
+{
+   Eqn_p handle;
+   long  key, res = 0;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      key = 2*(EqnIsEquLit(handle)?0:handle->lterm->f_code)+
+         (EqnIsPositive(handle)?1:0);
+      res = MAX(res, key);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_bucket_cmp()
+//
+//   Compare two buckets by decreasing size (and increasing key to make
+//   the assignment deterministic).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int presat_bucket_cmp(const void* b1, const void* b2)
+{
+   const PresatBucketCell *bucket1 = b1;
+   const PresatBucketCell *bucket2 = b2;
+
+   if(bucket1->size != bucket2->size)
+   {
+      return CMP(bucket2->size, bucket1->size);
+   }
+   return CMP(bucket1->key, bucket2->key);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_assign_workers()
+//
+//   Assign each of the count clauses in clauses[] to one of workers
+//   workers, keeping clauses with the same key together and
+//   balancing the number of clauses per worker greedily (largest
+//   partition to least loaded worker). Returns an array of worker
+//   numbers (to be freed by the caller).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static int* presat_assign_workers(Clause_p *clauses, long count,
+                                  long max_key, int workers)
+{
+   long           *key_size = SizeMalloc((max_key+1)*sizeof(long));
+   int            *key_owner = SizeMalloc((max_key+1)*sizeof(int));
+   int            *res = SizeMalloc(count*sizeof(int));
+   long           load[PRESAT_MAX_WORKERS];
+   PresatBucket_p buckets;
+   long           i, bucket_no = 0;
+   int            w, best;
+
+   for(i=0; i<=max_key; i++)
+   {
+      key_size[i] = 0;
+   }
+   for(i=0; i<count; i++)
+   {
+      key_size[presat_clause_key(clauses[i])]++;
+   }
+   buckets = SizeMalloc((max_key+1)*sizeof(PresatBucketCell));
+   for(i=0; i<=max_key; i++)
+   {
+      if(key_size[i])
+      {
+         buckets[bucket_no].key  = i;
+         buckets[bucket_no].size = key_size[i];
+         bucket_no++;
+      }
+   }
+   qsort(buckets, bucket_no, sizeof(PresatBucketCell), presat_bucket_cmp);
+
+   for(w=0; w<workers; w++)
+   {
+      load[w] = 0;
+   }
+   for(i=0; i<bucket_no; i++)
+   {
+      best = 0;
+      for(w=1; w<workers; w++)
+      {
+         if(load[w] < load[best])
+         {
+            best = w;
+         }
+      }
+      key_owner[buckets[i].key] = best;
+      load[best] += buckets[i].size;
+   }
+   for(i=0; i<count; i++)
+   {
+      res[i] = key_owner[presat_clause_key(clauses[i])];
+   }
+   SizeFree(buckets, (max_key+1)*sizeof(PresatBucketCell));
+   SizeFree(key_owner, (max_key+1)*sizeof(int));
+   SizeFree(key_size, (max_key+1)*sizeof(long));
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_find_subsumed()
+//
+//   Check all clauses assigned to worker for subsumption by the
+//   other clauses in index. Subsumed clauses are removed from the
+//   index (if they are in it), and their positions are pushed onto
+//   res.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+static void presat_find_subsumed(FVIAnchor_p index, Clause_p *clauses,
+                                 int *owner, long count, int worker,
+                                 PStack_p res)
+{
+   FVPackedClause_p pclause;
+   bool indexed;
+   long i;
+
+   for(i=0; i<count; i++)
+   {
+      if(owner[i] != worker)
+      {
+         continue;
+      }
+      indexed = ClauseLiteralNumber(clauses[i]) <= PRESAT_MAX_SUBSUMER_LITS;
+      if(indexed)
+      {
+         FVIndexDelete(index, clauses[i]);
+      }
+      pclause = FVIndexPackClause(clauses[i], index);
+      if(FVIAnchorSubsumesFVPackedClause(index, pclause))
+      {
+         PStackPushInt(res, i);
+      }
+      else if(indexed)
+      {
+         FVIndexInsert(index, pclause);
+      }
+      FVUnpackClause(pclause);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_write_indices()
+//
+//   Write the positions on res to fd. Return false on error.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static bool presat_write_indices(int fd, PStack_p res)
+{
+   long    i;
+   long    val;
+   size_t  done;
+   ssize_t written;
+
+   for(i=0; i<PStackGetSP(res); i++)
+   {
+      val  = PStackElementInt(res, i);
+      done = 0;
+      while(done < sizeof(long))
+      {
+         written = write(fd, (char*)&val+done, sizeof(long)-done);
+         if(written < 0)
+         {
+            if(errno == EINTR)
+            {
+               continue;
+            }
+            return false;
+         }
+         done += written;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: presat_read_indices()
+//
+//   Read positions from fd until end of file and push them onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static void presat_read_indices(int fd, PStack_p res)
+{
+   long    buffer[PRESAT_READ_BUFFER];
+   size_t  fill = 0, complete, i;
+   ssize_t got;
+
+   while((got = read(fd, (char*)buffer+fill, sizeof(buffer)-fill)))
+   {
+      if(got < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         TmpErrno = errno;
+         SysError("Cannot read presaturation worker results", SYS_ERROR);
+      }
+      fill += got;
+      complete = fill/sizeof(long);
+      for(i=0; i<complete; i++)
+      {
+         PStackPushInt(res, buffer[i]);
+      }
+      fill -= complete*sizeof(long);
+      memmove(buffer, buffer+complete, fill);
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateParallelSubsume()
+//
+//   Remove clauses subsumed by other clauses from
+//   state->unprocessed, using up to workers processes (including the
+//   current one). Requires initialized feature vector indexing. Return
+//   the number of clauses removed. Results of workers that do not
+//   terminate normally (e.g. because they run out of time) are
+//   ignored.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state->unprocessed, forks, memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+long ProofStateParallelSubsume(ProofState_p state, int workers)
+{
+   FVIAnchor_p      index;
+   FVPackedClause_p pclause;
+   Clause_p         *clauses, handle;
+   int              *owner, w, status;
+   int              fds[PRESAT_MAX_WORKERS];
+   pid_t            pids[PRESAT_MAX_WORKERS];
+   int              pipefd[2];
+   PStack_p         subsumed, res;
+   long             count, i, max_key = 0, removed = 0;
+   struct rlimit    limit;
+   rlim_t           remaining = RLIM_INFINITY;
+
+   workers = MIN(workers, PRESAT_MAX_WORKERS);
+   count   = state->unprocessed->members;
+   if(workers < 2 || count < 2 || !state->processed_non_units->fvindex)
+   {
+      return 0;
+   }
+   index = FVIAnchorAlloc(state->fvi_cspec,
+                          PermVectorCopy(state->processed_non_units->fvindex->perm_vector));
+   clauses = SizeMalloc(count*sizeof(Clause_p));
+   i = 0;
+   for(handle = state->unprocessed->anchor->succ;
+       handle != state->unprocessed->anchor;
+       handle = handle->succ)
+   {
+      ClauseSubsumeOrderSortLits(handle);
+      handle->weight = ClauseStandardWeight(handle);
+      if(ClauseLiteralNumber(handle) <= PRESAT_MAX_SUBSUMER_LITS)
+      {
+         pclause = FVIndexPackClause(handle, index);
+         FVIndexInsert(index, pclause);
+         FVUnpackClause(pclause);
+      }
+      max_key = MAX(max_key, presat_clause_key(handle));
+      clauses[i++] = handle;
+   }
+   owner = presat_assign_workers(clauses, count, max_key, workers);
+
+   if(getrlimit(RLIMIT_CPU, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+   {
+      remaining = limit.rlim_cur - (rlim_t)GetTotalCPUTime();
+      remaining = MAX(remaining, 1);
+   }
+   fflush(GlobalOut);
+   fflush(stdout);
+   for(w=1; w<workers; w++)
+   {
+      if(pipe(pipefd) == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot create pipe for presaturation worker", SYS_ERROR);
+      }
+      pids[w] = fork();
+      if(pids[w] == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot fork presaturation worker", SYS_ERROR);
+      }
+      if(pids[w] == 0)
+      {
+         /* Child: Run silently, die on timeout, never touch the
+            parent's output */
+         close(pipefd[0]);
+         SilentTimeOut = true;
+         signal(SIGXCPU, SIG_DFL);
+         if(remaining != RLIM_INFINITY)
+         {
+            SetSoftRlimit(RLIMIT_CPU, remaining);
+         }
+         res = PStackAlloc();
+         presat_find_subsumed(index, clauses, owner, count, w, res);
+         status = presat_write_indices(pipefd[1], res)?0:OTHER_ERROR;
+         close(pipefd[1]);
+         _exit(status);
+      }
+      close(pipefd[1]);
+      fds[w] = pipefd[0];
+   }
+
+   subsumed = PStackAlloc();
+   presat_find_subsumed(index, clauses, owner, count, 0, subsumed);
+
+   res = PStackAlloc();
+   for(w=1; w<workers; w++)
+   {
+      presat_read_indices(fds[w], res);
+      close(fds[w]);
+      while(waitpid(pids[w], &status, 0) == -1)
+      {
+         if(errno != EINTR)
+         {
+            TmpErrno = errno;
+            SysError("Cannot wait for presaturation worker", SYS_ERROR);
+         }
+      }
+      if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+      {
+         PStackPushStack(subsumed, res);
+      }
+      PStackReset(res);
+   }
+   PStackFree(res);
+   FVIAnchorFree(index);
+
+   while(!PStackEmpty(subsumed))
+   {
+      i = PStackPopInt(subsumed);
+      assert(i >= 0 && i < count);
+      ClauseSetDeleteEntry(clauses[i]);
+      removed++;
+   }
+   PStackFree(subsumed);
+   SizeFree(owner, count*sizeof(int));
+   SizeFree(clauses, count*sizeof(Clause_p));
+
+   return removed;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
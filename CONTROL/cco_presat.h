@@ -0,0 +1,63 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_presat.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Parallel removal of subsumed clauses from the initial clause set
+  before presaturation interreduction. Clauses are partitioned by
+  their dominant literal symbol, and the partitions are checked
+  against a shared (copy-on-write) feature vector index by forked
+  worker processes. The subsequent serial interreduction acts as the
+  final pass over all partitions.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_PRESAT
+
+#define CCO_PRESAT
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <cio_signals.h>
+#include <cco_proofproc.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Upper bound for the number of presaturation worker processes */
+
+#define PRESAT_MAX_WORKERS 64
+
+/* Only clauses with at most this many literals are used as
+   subsumers in the parallel pass */
+
+#define PRESAT_MAX_SUBSUMER_LITS 6
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+long ProofStateParallelSubsume(ProofState_p state, int workers);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
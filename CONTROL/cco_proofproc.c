@@ -18,6 +18,15 @@ Changes
 
 <1> Mon Jun  8 11:47:44 MET DST 1998
     New
+<2> Tue Oct 20 01:46:20 CEST 2026
+    Periodic SAT check of the ground abstraction of the processed
+    clauses.
+<3> Tue Oct 20 02:31:05 CEST 2026
+    Watchlist checks use the watchlist index.
+<4> Tue Oct 20 04:12:38 CEST 2026
+    Phase timers in ProcessClause(), counter dumps on request.
+<5> Wed Oct 21 09:31:05 CEST 2026
+    Handle an empty unsatisfiable core in the SAT check.
 
 -----------------------------------------------------------------------*/
 
@@ -31,6 +40,12 @@ Changes
 
 PERF_CTR_DEFINE(ParamodTimer);
 PERF_CTR_DEFINE(BWRWTimer);
+PERF_CTR_DEFINE(ProcessClauseTimer);
+PERF_CTR_DEFINE(FwdContrTimer);
+PERF_CTR_DEFINE(BWSimplifyTimer);
+PERF_CTR_DEFINE(GenerateTimer);
+PERF_CTR_DEFINE(InsertTimer);
+PERF_CTR_DEFINE(NewClauseCounter);
 
 
 /*---------------------------------------------------------------------*/
@@ -105,27 +120,23 @@ static void check_ac_status(ProofState_p state, ProofControl_p
 
 /*-----------------------------------------------------------------------
 //
-// Function: remove_subsumed()
+// Function: discard_subsumed()
 //
-//   Remove all clauses subsumed by subsumer from set, kill their
-//   children. Return number of removed clauses.
+//   Remove all clauses on stack (which are subsumed by subsumer) from
+//   their sets, kill their children.
 //
 // Global Variables: -
 //
-// Side Effects    : Changes set, memory operations.
+// Side Effects    : Changes sets, memory operations.
 //
 /----------------------------------------------------------------------*/
 
-static long remove_subsumed(GlobalIndices_p indices,
-                            FVPackedClause_p subsumer,
-                            ClauseSet_p set,
-                            ClauseSet_p archive)
+static void discard_subsumed(GlobalIndices_p indices,
+                             Clause_p subsumer,
+                             PStack_p stack,
+                             ClauseSet_p archive)
 {
    Clause_p handle;
-   long     res;
-   PStack_p stack = PStackAlloc();
-
-   res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
 
    while(!PStackEmpty(stack))
    {
@@ -134,13 +145,13 @@ static long remove_subsumed(GlobalIndices_p indices,
       if(ClauseQueryProp(handle, CPWatchOnly))
       {
     DocClauseQuote(GlobalOut, OutputLevel, 6, handle,
-         "extract_wl_subsumed", subsumer->clause);
+         "extract_wl_subsumed", subsumer);
 
       }
       else
       {
     DocClauseQuote(GlobalOut, OutputLevel, 6, handle,
-         "subsumed", subsumer->clause);
+         "subsumed", subsumer);
       }
       ClauseKillChildren(handle);
       GlobalIndicesDeleteClause(indices, handle);
@@ -154,6 +165,32 @@ static long remove_subsumed(GlobalIndices_p indices,
          ClauseSetDeleteEntry(handle);
       }
    }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: remove_subsumed()
+//
+//   Remove all clauses subsumed by subsumer from set, kill their
+//   children. Return number of removed clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, memory operations.
+//
+/----------------------------------------------------------------------*/
+
+static long remove_subsumed(GlobalIndices_p indices,
+                            FVPackedClause_p subsumer,
+                            ClauseSet_p set,
+                            ClauseSet_p archive)
+{
+   long     res;
+   PStack_p stack = PStackAlloc();
+
+   res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
+   discard_subsumed(indices, subsumer->clause, stack, archive);
    PStackFree(stack);
    return res;
 }
@@ -375,7 +412,10 @@ static long eliminate_context_sr_clauses(ProofState_p state,
 // Function: check_watchlist()
 //
 //   Check if a clause subsumes one or more watchlist clauses, if yes,
-//   set appropriate property in clause and remove subsumed clauses.
+//   set appropriate property in clause and remove subsumed
+//   clauses. If record_progress is set (for processed clauses), the
+//   partial matches of clause with watch clauses are recorded in the
+//   watchlist index.
 //
 // Global Variables: -
 //
@@ -384,9 +424,11 @@ static long eliminate_context_sr_clauses(ProofState_p state,
 /----------------------------------------------------------------------*/
 
 void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
-                     Clause_p clause, ClauseSet_p archive)
+                     Clause_p clause, ClauseSet_p archive,
+                     bool record_progress)
 {
-   FVPackedClause_p pclause = FVIndexPackClause(clause, watchlist->fvindex);
+   FVPackedClause_p pclause;
+   PStack_p stack;
    long removed;
 
    // printf("# check_watchlist(%p)...\n", indices);
@@ -394,7 +436,21 @@ void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
    // assert(ClauseIsSubsumeOrdered(clause));
 
    clause->weight = ClauseStandardWeight(clause);
-   if((removed = remove_subsumed(indices, pclause, watchlist, archive)))
+   if(watchlist->watch_index)
+   {
+      stack = PStackAlloc();
+      removed = WatchIndexFindSubsumed(watchlist->watch_index, clause,
+                                       stack, record_progress);
+      discard_subsumed(indices, clause, stack, archive);
+      PStackFree(stack);
+   }
+   else
+   {
+      pclause = FVIndexPackClause(clause, watchlist->fvindex);
+      removed = remove_subsumed(indices, pclause, watchlist, archive);
+      FVUnpackClause(pclause);
+   }
+   if(removed)
    {
       ClauseSetProp(clause, CPSubsumesWatch);
       if(OutputLevel == 1)
@@ -405,7 +461,6 @@ void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
       // ClausePrint(GlobalOut, clause, true); printf("\n");
       DocClauseQuote(GlobalOut, OutputLevel, 6, clause,
            "extract_subsumed_watched", NULL);   }
-   FVUnpackClause(pclause);
    // printf("# ...check_watchlist()\n");
 }
 
@@ -620,7 +675,7 @@ static Clause_p insert_new_clauses(ProofState_p state, ProofControl_p control)
       if(state->watchlist)
       {
     check_watchlist(&(state->wlindices), state->watchlist,
-                         handle, state->archive);
+                         handle, state->archive, false);
       }
       if(ClauseIsEmpty(handle))
       {
@@ -731,6 +786,58 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: reweight_unprocessed_clauses()
+//
+//   Reweight the state-dependent evaluations of the unprocessed
+//   clauses once the set has grown by more than reweight_limit
+//   clauses since the last time. If reweight_batch is non-zero, the
+//   work is spread over several calls, with at most reweight_batch
+//   clauses re-evaluated per call. Otherwise all clauses are
+//   re-evaluated at once and the affected queues rebuilt in bulk.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes evaluations of unprocessed clauses
+//
+/----------------------------------------------------------------------*/
+
+static void reweight_unprocessed_clauses(ProofState_p state,
+                                         ProofControl_p control)
+{
+   long batch = control->heuristic_parms.reweight_batch;
+
+   if(state->reweight_pending)
+   {
+      state->reweight_pending -=
+         ClauseSetReweightIncremental(control->hcb, state->unprocessed,
+                                      MIN(batch, state->reweight_pending));
+      if(ClauseSetEmpty(state->unprocessed))
+      {
+         state->reweight_pending = 0;
+      }
+      return;
+   }
+   state->reweight_base = MIN(state->unprocessed->members,
+                              state->reweight_base);
+   if((state->unprocessed->members - state->reweight_base)
+      > control->heuristic_parms.reweight_limit)
+   {
+      OUTPRINT(1, "# Reweighting unprocessed clauses...\n");
+      if(batch)
+      {
+         state->reweight_pending = state->unprocessed->members;
+      }
+      else
+      {
+         ClauseSetReweightStateDependent(control->hcb, state->unprocessed);
+      }
+      state->reweight_base = state->unprocessed->members;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: cleanup_unprocessed_clauses()
@@ -739,7 +846,7 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 //   on paramters in control:
 //   - Remove copies
 //   - Simplify all unprocessed clauses
-//   - Reweigh all unprocessed clauses
+//   - Reweigh (state-dependent evaluations of) unprocessed clauses
 //   - Delete "bad" clauses to avoid running out of memories.
 //   Simplification can find the empty clause, which is then
 //   returned.
@@ -756,7 +863,6 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
    long long current_storage    = ProofStateStorage(state);
    long long filter_base        = current_storage;
    long long filter_copies_base = current_storage;
-   long long reweight_base      = state->unprocessed->members;
    long tmp;
    Clause_p unsatisfiable = NULL;
 
@@ -802,13 +908,9 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
          return unsatisfiable;
       }
    }
-   reweight_base = MIN(state->unprocessed->members, reweight_base);
-   if((state->unprocessed->members - reweight_base)
-      > control->heuristic_parms.reweight_limit)
+   if(HCBHasStateDependentEvals(control->hcb))
    {
-      OUTPRINT(1, "# Reweighting unprocessed clauses...\n");
-      ClauseSetReweight(control->hcb,  state->unprocessed);
-      reweight_base = state->unprocessed->members;
+      reweight_unprocessed_clauses(state, control);
    }
    tmp = LONG_MAX;
 
@@ -836,6 +938,86 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: check_ground_abstraction()
+//
+//   If at least sat_check_limit clauses have been processed since
+//   the last time, check the ground abstraction of the processed
+//   clauses (built incrementally in ProcessClause()) for
+//   propositional unsatisfiability. Return the empty clause if it is
+//   unsatisfiable, NULL otherwise. With proof objects, the empty
+//   clause is derived from the processed clauses in the unsatisfiable
+//   core (or from all of them if the core is empty). Without any
+//   processed clause to derive it from, it is not created.
+//
+// Global Variables: OutputLevel, GlobalOut
+//
+// Side Effects    : Runs the SAT solver, may create the empty clause
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p check_ground_abstraction(ProofState_p state,
+                                         ProofControl_p control)
+{
+   SatCheck_p    check = control->satcheck;
+   PStack_p      live = NULL, core = NULL;
+   PStackPointer i;
+   Clause_p      empty = NULL;
+   CDCLResult    res;
+
+   if((state->processed_count - check->base) <
+      control->heuristic_parms.sat_check_limit)
+   {
+      return NULL;
+   }
+   check->base = state->processed_count;
+   if(check->use_selectors)
+   {
+      live = PStackAlloc();
+      core = PStackAlloc();
+      ClauseSetPushClauses(live, state->processed_pos_rules);
+      ClauseSetPushClauses(live, state->processed_pos_eqns);
+      ClauseSetPushClauses(live, state->processed_neg_units);
+      ClauseSetPushClauses(live, state->processed_non_units);
+   }
+   res = SatCheckSolve(check, live,
+                       control->heuristic_parms.sat_check_conflicts, core);
+   if(OutputLevel)
+   {
+      fprintf(GlobalOut, "# SAT check of ground abstraction (%ld instances,"
+              " %ld atoms): %s\n", check->instances, check->atom_count,
+              CDCLResultSZSStatus(res));
+   }
+   if(core && res == CDCLUnsatisfiable && PStackEmpty(core))
+   {
+      /* No core reported, derive from all live clauses (if any) */
+      PStackPushStack(core, live);
+   }
+   if(res == CDCLUnsatisfiable && !(core && PStackEmpty(core)))
+   {
+      empty = ClauseAlloc(NULL);
+      if(core)
+      {
+         ClausePushDerivation(empty, DCSatRefutation,
+                              PStackElementP(core, 0), NULL);
+         for(i=1; i<PStackGetSP(core); i++)
+         {
+            ClausePushDerivation(empty, DCCnfAddArg,
+                                 PStackElementP(core, i), NULL);
+         }
+      }
+      PStackPushP(state->extract_roots, empty);
+   }
+   if(live)
+   {
+      PStackFree(live);
+      PStackFree(core);
+   }
+   return empty;
+}
+
+
 #ifdef PRINT_SHARING
 
 /*-----------------------------------------------------------------------
@@ -945,8 +1127,12 @@ void ProofControlInit(ProofState_p state,ProofControl_p control,
    SpecFeaturesCompute(&(control->problem_specs),
              state->axioms,state->signature);
 
+   if(params->auto_table)
+   {
+      control->auto_table = AutoTableLoad(params->auto_table);
+   }
    control->ocb = TOSelectOrdering(state, params,
-               &(control->problem_specs));
+               &(control->problem_specs), control->auto_table);
 
    in = CreateScanner(StreamTypeInternalString,
             DefaultWeightFunctions,
@@ -968,6 +1154,15 @@ void ProofControlInit(ProofState_p state,ProofControl_p control,
    HeuristicDefListParse(control->hcbs, in, control->wfcbs,
           control->ocb, state);
    DestroyScanner(in);
+   if(control->auto_table)
+   {
+      in = CreateScanner(StreamTypeInternalString,
+                         DStrView(control->auto_table->heuristics),
+                         true, NULL);
+      HeuristicDefListParse(control->hcbs, in, control->wfcbs,
+                            control->ocb, state);
+      DestroyScanner(in);
+   }
    for(sp = 0; sp < PStackGetSP(hcb_defs); sp++)
    {
       in = CreateScanner(StreamTypeOptionString,
@@ -1169,12 +1364,6 @@ void fvi_param_init(ProofState_p state, ProofControl_p control)
          FVIAnchorAlloc(cspec, PermVectorCopy(perm));
       state->processed_neg_units->fvindex =
          FVIAnchorAlloc(cspec, PermVectorCopy(perm));
-      if(state->watchlist)
-      {
-         state->watchlist->fvindex =
-            FVIAnchorAlloc(cspec, PermVectorCopy(perm));
-         //ClauseSetNewTerms(state->watchlist, state->terms);
-      }
    }
    state->def_store_cspec = FVCollectAlloc(FVICollectFeatures,
                                            true,
@@ -1239,7 +1428,7 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
       if(state->watchlist)
       {
          check_watchlist(&(state->wlindices), state->watchlist,
-                         new, state->archive);
+                         new, state->archive, false);
       }
       HCBClauseEvaluate(control->hcb, new);
       DocClauseQuoteDefault(6, new, "eval");
@@ -1286,6 +1475,12 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
    {
       fvi_param_init(state, control);
    }
+   if(!control->satcheck && (control->heuristic_parms.sat_check_limit !=
+                             DEFAULT_SAT_CHECK_INTERVAL))
+   {
+      control->satcheck = SatCheckAlloc(state->signature,
+                                        BuildProofObject != PONoObject);
+   }
 }
 
 
@@ -1310,6 +1505,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    FVPackedClause_p pclause;
    SysDate          clausedate;
 
+   PERF_CTR_ENTRY(ProcessClauseTimer);
    clause = control->hcb->hcb_select(control->hcb,
                  state->unprocessed);
    //EvalListPrintComment(GlobalOut, clause->evaluations); printf("\n");
@@ -1333,16 +1529,20 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       arch_copy = ClauseArchive(state->archive, clause);
    }
 
-   if(!(pclause = ForwardContractClause(state, control,
-                                        clause, true,
-                                        control->heuristic_parms.forward_context_sr,
-                                        control->heuristic_parms.condensing,
-                                        FullRewrite)))
+   PERF_CTR_ENTRY(FwdContrTimer);
+   pclause = ForwardContractClause(state, control,
+                                   clause, true,
+                                   control->heuristic_parms.forward_context_sr,
+                                   control->heuristic_parms.condensing,
+                                   FullRewrite);
+   PERF_CTR_EXIT(FwdContrTimer);
+   if(!pclause)
    {
       if(arch_copy)
       {
          ClauseSetDeleteEntry(arch_copy);
       }
+      PERF_CTR_EXIT(ProcessClauseTimer);
       return NULL;
    }
 
@@ -1356,6 +1556,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       {
          clause = FVUnpackClause(pclause);
          ClauseEvaluateAnswerLits(clause);
+         PERF_CTR_EXIT(ProcessClauseTimer);
          return clause;
       }
    }
@@ -1372,16 +1573,18 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       {
          PStackPushP(state->extract_roots, resclause);
       }
+      PERF_CTR_EXIT(ProcessClauseTimer);
       return resclause;
    }
 
    if(state->watchlist)
    {
       check_watchlist(&(state->wlindices), state->watchlist,
-                      pclause->clause, state->archive);
+                      pclause->clause, state->archive, true);
    }
 
    /* Now on to backward simplification. */
+   PERF_CTR_ENTRY(BWSimplifyTimer);
    clausedate = ClauseSetListGetMaxDate(state->demods, FullRewrite);
 
    eliminate_backward_rewritten_clauses(state, control, pclause->clause, &clausedate);
@@ -1389,6 +1592,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    eliminate_unit_simplified_clauses(state, pclause->clause);
    eliminate_context_sr_clauses(state, control, pclause->clause);
    ClauseSetSetProp(state->tmp_store, CPIsIRVictim);
+   PERF_CTR_EXIT(BWSimplifyTimer);
 
    clause = pclause->clause;
 
@@ -1424,6 +1628,10 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       ClauseSetIndexedInsert(state->processed_non_units, pclause);
    }
    GlobalIndicesInsertClause(&(state->gindices), clause);
+   if(control->satcheck)
+   {
+      SatCheckAddClause(control->satcheck, clause);
+   }
 
    FVUnpackClause(pclause);
    ENSURE_NULL(pclause);
@@ -1433,7 +1641,9 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    }
    if(control->heuristic_parms.selection_strategy != SelectNoGeneration)
    {
+      PERF_CTR_ENTRY(GenerateTimer);
       generate_new_clauses(state, control, clause, tmp_copy);
+      PERF_CTR_EXIT(GenerateTimer);
    }
    ClauseFree(tmp_copy);
    if(TermCellStoreNodes(&(state->tmp_terms->term_store))>TMPBANK_GC_LIMIT)
@@ -1450,7 +1660,12 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    {
       ClauseSetSort(state->tmp_store, ClauseCmpByStructWeight);
    }
-   if((empty = insert_new_clauses(state, control)))
+   PERF_CTR_SAMPLE(NewClauseCounter, state->tmp_store->members);
+   PERF_CTR_ENTRY(InsertTimer);
+   empty = insert_new_clauses(state, control);
+   PERF_CTR_EXIT(InsertTimer);
+   PERF_CTR_EXIT(ProcessClauseTimer);
+   if(empty)
    {
       PStackPushP(state->extract_roots, empty);
       return empty;
@@ -1496,6 +1711,10 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
     (!state->watchlist||!ClauseSetEmpty(state->watchlist)))
    {
       count++;
+      if(PerfCtrsDumpRequested)
+      {
+         PerfCtrsDump();
+      }
       unsatisfiable = ProcessClause(state, control, answer_limit);
       if(unsatisfiable)
       {
@@ -1506,6 +1725,14 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
       {
     break;
       }
+      if(control->satcheck)
+      {
+         unsatisfiable = check_ground_abstraction(state, control);
+         if(unsatisfiable)
+         {
+            break;
+         }
+      }
    }
    return unsatisfiable;
 }
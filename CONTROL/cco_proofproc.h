@@ -48,6 +48,12 @@ Changes
 
 PERF_CTR_DECL(ParamodTimer);
 PERF_CTR_DECL(BWRWTimer);
+PERF_CTR_DECL(ProcessClauseTimer);
+PERF_CTR_DECL(FwdContrTimer);
+PERF_CTR_DECL(BWSimplifyTimer);
+PERF_CTR_DECL(GenerateTimer);
+PERF_CTR_DECL(InsertTimer);
+PERF_CTR_DECL(NewClauseCounter);
 
 
 /* Collect term cells from temporary clause copies if their number
@@ -315,6 +315,8 @@ StructFOFSpec_p StructFOFSpecCreate(TB_p terms)
    handle->parsed_includes = NULL;
    handle->f_distrib       = GenDistribAlloc(handle->sig);
    handle->shared_ax_sp    = 0;
+   handle->ax_index        = SinEIndexAlloc();
+   handle->relevance       = PStackAlloc();
 
    return handle;
 }
@@ -402,6 +404,9 @@ void StructFOFSpecFree(StructFOFSpec_p ctrl)
    }
    StrTreeFree(ctrl->parsed_includes);
    GenDistribFree(ctrl->f_distrib);
+   SinEIndexFree(ctrl->ax_index);
+   StructFOFSpecResetRelevance(ctrl);
+   PStackFree(ctrl->relevance);
 
    StructFOFSpecCellFree(ctrl);
 }
@@ -475,9 +480,9 @@ long StructFOFSpecParseAxioms(StructFOFSpec_p ctrl, PStack_p axfiles,
          fprintf(GlobalOut, "# Parsing %s\n", iname);
          cset = ClauseSetAlloc();
          fset = FormulaSetAlloc();
-         res += FormulaAndClauseSetParse(in, cset, fset, ctrl->terms,
-                                         NULL,
-                                         &(ctrl->parsed_includes));
+         res += FormulaAndClauseSetParseCached(in, cset, fset,
+                                               ctrl->terms, NULL,
+                                               &(ctrl->parsed_includes));
          assert(ClauseSetCardinality(cset)==0);
          PStackPushP(ctrl->clause_sets, cset);
          PStackPushP(ctrl->formula_sets, fset);
@@ -513,6 +518,170 @@ void StructFOFSpecInitDistrib(StructFOFSpec_p ctrl)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecResetRelevance()
+//
+//   Drop all precomputed SinE selections.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StructFOFSpecResetRelevance(StructFOFSpec_p ctrl)
+{
+   while(!PStackEmpty(ctrl->relevance))
+   {
+      SinERelevanceFree(PStackPopP(ctrl->relevance));
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecInitRelevance()
+//
+//   Compute the SinE selections for the current problem for all
+//   filters on the stack filters at once. Filters that share a D-relation and
+//   seeds share a single selection run (covering the largest of
+//   their limits), and StructFOFSpecGetProblem() derives their
+//   axiom sets from it. The precomputed selections stay valid until
+//   StructFOFSpecResetRelevance() or StructFOFSpecBacktrackToSpec()
+//   is called, so the problem (including clause and formula types)
+//   must not be changed in between.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StructFOFSpecInitRelevance(StructFOFSpec_p ctrl, PStack_p filters)
+{
+   PStack_p      group = PStackAlloc();
+   AxFilter_p    filter;
+   PStackPointer i, j;
+
+   StructFOFSpecResetRelevance(ctrl);
+   SinEIndexBacktrack(ctrl->ax_index, ctrl->shared_ax_sp);
+   SinEIndexUpdate(ctrl->ax_index,
+                   ctrl->f_distrib,
+                   ctrl->clause_sets,
+                   ctrl->formula_sets);
+
+   for(i=0; i<PStackGetSP(filters); i++)
+   {
+      filter = PStackElementP(filters, i);
+      if(filter->type != AFGSinE ||
+         StructFOFSpecFindRelevance(ctrl, filter))
+      {
+         continue;
+      }
+      for(j=i; j<PStackGetSP(filters); j++)
+      {
+         if(SinEFiltersShareRelevance(filter, PStackElementP(filters, j)))
+         {
+            PStackPushP(group, PStackElementP(filters, j));
+         }
+      }
+      PStackPushP(ctrl->relevance,
+                  SinEIndexComputeRelevance(ctrl->ax_index,
+                                            ctrl->f_distrib,
+                                            ctrl->shared_ax_sp,
+                                            group));
+      PStackReset(group);
+   }
+   PStackFree(group);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecFindRelevance()
+//
+//   Return a precomputed SinE selection from which the axioms
+//   selected by filter can be derived, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+SinERelevance_p StructFOFSpecFindRelevance(StructFOFSpec_p ctrl,
+                                           AxFilter_p filter)
+{
+   SinERelevance_p rel;
+   PStackPointer   i;
+
+   for(i=0; i<PStackGetSP(ctrl->relevance); i++)
+   {
+      rel = PStackElementP(ctrl->relevance, i);
+      if(SinERelevanceCovers(rel, ctrl->shared_ax_sp, filter))
+      {
+         return rel;
+      }
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecFilterExtends()
+//
+//   Return true if the problem selected by filter is known to consist
+//   of the problem selected by base plus some additional axioms
+//   (i.e. both are derived from the same precomputed selection).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool StructFOFSpecFilterExtends(StructFOFSpec_p ctrl,
+                                AxFilter_p filter,
+                                AxFilter_p base)
+{
+   SinERelevance_p rel = StructFOFSpecFindRelevance(ctrl, filter);
+
+   return rel &&
+      SinERelevanceCovers(rel, ctrl->shared_ax_sp, base) &&
+      SinERelevanceFilterExtends(rel, filter, base);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecGetProblemDiff()
+//
+//   Push the axioms selected by filter, but not by base, onto
+//   res_clauses and res_formulas. filter has to extend base (see
+//   above). Returns the total number of axioms selected by filter.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long StructFOFSpecGetProblemDiff(StructFOFSpec_p ctrl,
+                                 AxFilter_p filter,
+                                 AxFilter_p base,
+                                 PStack_p res_clauses,
+                                 PStack_p res_formulas)
+{
+   assert(StructFOFSpecFilterExtends(ctrl, filter, base));
+
+   return SinERelevanceGetAxioms(StructFOFSpecFindRelevance(ctrl, filter),
+                                 filter, base,
+                                 res_clauses, res_formulas);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ProofStateSinE()
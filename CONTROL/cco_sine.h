@@ -47,6 +47,10 @@ typedef struct strtuctured_FOF_spec_cell
    StrTree_p     parsed_includes;
    PStackPointer shared_ax_sp;
    GenDistrib_p  f_distrib;
+   SinEIndex_p   ax_index;  /* Symbols of the axioms, kept across
+                               problems for the shared sets */
+   PStack_p      relevance; /* Precomputed SinE selections for the
+                               current problem */
 }StructFOFSpecCell, *StructFOFSpec_p;
 
 
@@ -82,6 +86,19 @@ long StructFOFSpecGetProblem(StructFOFSpec_p ctrl,
                              PStack_p res_clauses,
                              PStack_p res_formulas);
 
+void StructFOFSpecResetRelevance(StructFOFSpec_p ctrl);
+void StructFOFSpecInitRelevance(StructFOFSpec_p ctrl, PStack_p filters);
+SinERelevance_p StructFOFSpecFindRelevance(StructFOFSpec_p ctrl,
+                                           AxFilter_p filter);
+bool StructFOFSpecFilterExtends(StructFOFSpec_p ctrl,
+                                AxFilter_p filter,
+                                AxFilter_p base);
+long StructFOFSpecGetProblemDiff(StructFOFSpec_p ctrl,
+                                 AxFilter_p filter,
+                                 AxFilter_p base,
+                                 PStack_p res_clauses,
+                                 PStack_p res_formulas);
+
 long ProofStateSinE(ProofState_p state, char* filter);
 
 #endif
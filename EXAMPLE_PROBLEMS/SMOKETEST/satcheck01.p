@@ -0,0 +1,5 @@
+% Satisfiable. Run with --satcheck-proc-interval=1: the ground
+% abstraction must keep the atoms h(t(c),s(c,c))=c and c=c_Suc(c) (c
+% the fresh constant) apart and never report Unsatisfiable.
+cnf(a,axiom,h(t(X1),s(X2,X1))=X2).
+cnf(b,axiom,X1!=c_Suc(X1)).
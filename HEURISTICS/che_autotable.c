@@ -0,0 +1,907 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotable.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Parsing and interpretation of auto mode tables.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 10:12:31 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_autotable.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+typedef bool (*AutoPredFun)(SpecFeature_p spec);
+
+typedef struct auto_pred_cell
+{
+   char*       name;
+   AutoPredFun pred;
+}AutoPredCell;
+
+/* The class predicates from che_clausesetfeatures.h are macros, so we
+   need a function for each of them. */
+
+#define AUTO_PRED(name) \
+   static bool pred_##name(SpecFeature_p spec) {return Spec##name(spec);}
+
+AUTO_PRED(AxiomsAreUnit)
+AUTO_PRED(AxiomsAreHorn)
+AUTO_PRED(AxiomsAreNonUnitHorn)
+AUTO_PRED(AxiomsAreGeneral)
+AUTO_PRED(GoalsAreUnit)
+AUTO_PRED(GoalsAreHorn)
+AUTO_PRED(GoalsAreGround)
+AUTO_PRED(GoalsHaveVars)
+AUTO_PRED(PureEq)
+AUTO_PRED(SomeEq)
+AUTO_PRED(NoEq)
+AUTO_PRED(FewNGPosUnits)
+AUTO_PRED(SomeNGPosUnits)
+AUTO_PRED(ManyNGPosUnits)
+AUTO_PRED(FewGroundPos)
+AUTO_PRED(SomeGroundPos)
+AUTO_PRED(ManyGroundPos)
+AUTO_PRED(FewAxioms)
+AUTO_PRED(SomeAxioms)
+AUTO_PRED(ManyAxioms)
+AUTO_PRED(FewLiterals)
+AUTO_PRED(SomeLiterals)
+AUTO_PRED(ManyLiterals)
+AUTO_PRED(SmallTerms)
+AUTO_PRED(MediumTerms)
+AUTO_PRED(LargeTerms)
+AUTO_PRED(MaxFArity0)
+AUTO_PRED(MaxFArity1)
+AUTO_PRED(MaxFArity2)
+AUTO_PRED(MaxFArity3Plus)
+AUTO_PRED(AvgFArity0)
+AUTO_PRED(AvgFArity1)
+AUTO_PRED(AvgFArity2)
+AUTO_PRED(AvgFArity3Plus)
+AUTO_PRED(SmallFArSum)
+AUTO_PRED(MediumFArSum)
+AUTO_PRED(LargeFArSum)
+AUTO_PRED(ShallowMaxDepth)
+AUTO_PRED(MediumMaxDepth)
+AUTO_PRED(DeepMaxDepth)
+
+#define AUTO_PRED_ENTRY(name) {#name, pred_##name}
+
+static AutoPredCell pred_table[] =
+{
+   AUTO_PRED_ENTRY(AxiomsAreUnit),
+   AUTO_PRED_ENTRY(AxiomsAreHorn),
+   AUTO_PRED_ENTRY(AxiomsAreNonUnitHorn),
+   AUTO_PRED_ENTRY(AxiomsAreGeneral),
+   AUTO_PRED_ENTRY(GoalsAreUnit),
+   AUTO_PRED_ENTRY(GoalsAreHorn),
+   AUTO_PRED_ENTRY(GoalsAreGround),
+   AUTO_PRED_ENTRY(GoalsHaveVars),
+   AUTO_PRED_ENTRY(PureEq),
+   AUTO_PRED_ENTRY(SomeEq),
+   AUTO_PRED_ENTRY(NoEq),
+   AUTO_PRED_ENTRY(FewNGPosUnits),
+   AUTO_PRED_ENTRY(SomeNGPosUnits),
+   AUTO_PRED_ENTRY(ManyNGPosUnits),
+   AUTO_PRED_ENTRY(FewGroundPos),
+   AUTO_PRED_ENTRY(SomeGroundPos),
+   AUTO_PRED_ENTRY(ManyGroundPos),
+   AUTO_PRED_ENTRY(FewAxioms),
+   AUTO_PRED_ENTRY(SomeAxioms),
+   AUTO_PRED_ENTRY(ManyAxioms),
+   AUTO_PRED_ENTRY(FewLiterals),
+   AUTO_PRED_ENTRY(SomeLiterals),
+   AUTO_PRED_ENTRY(ManyLiterals),
+   AUTO_PRED_ENTRY(SmallTerms),
+   AUTO_PRED_ENTRY(MediumTerms),
+   AUTO_PRED_ENTRY(LargeTerms),
+   AUTO_PRED_ENTRY(MaxFArity0),
+   AUTO_PRED_ENTRY(MaxFArity1),
+   AUTO_PRED_ENTRY(MaxFArity2),
+   AUTO_PRED_ENTRY(MaxFArity3Plus),
+   AUTO_PRED_ENTRY(AvgFArity0),
+   AUTO_PRED_ENTRY(AvgFArity1),
+   AUTO_PRED_ENTRY(AvgFArity2),
+   AUTO_PRED_ENTRY(AvgFArity3Plus),
+   AUTO_PRED_ENTRY(SmallFArSum),
+   AUTO_PRED_ENTRY(MediumFArSum),
+   AUTO_PRED_ENTRY(LargeFArSum),
+   AUTO_PRED_ENTRY(ShallowMaxDepth),
+   AUTO_PRED_ENTRY(MediumMaxDepth),
+   AUTO_PRED_ENTRY(DeepMaxDepth),
+   {NULL, NULL}
+};
+
+
+/* Parameters that can be set by a table. The order of the enum and
+   of setting_table has to agree. */
+
+typedef enum
+{
+   ASPreferInitialClauses,
+   ASSelectionStrategy,
+   ASSelectOnProcOnly,
+   ASPmType,
+   ASForwardContextSR,
+   ASForwardDemod,
+   ASPreferGeneral,
+   ASCondensing,
+   ASERVarlitDestructive,
+   ASERStrongDestructive,
+   ASERAggressive,
+   ASSplitClauses,
+   ASSplitAggressive,
+   ASSplitFreshDefs,
+   ASUseTPTPSoS,
+   ASPresatInterreduction,
+   ASOrderType,
+   ASToWeightGen,
+   ASToPrecGen,
+   ASToConstWeight
+}AutoSetting;
+
+typedef enum
+{
+   ASBool,
+   ASInt,
+   ASLitSel,
+   ASParamod,
+   ASOrdering,
+   ASWeightGen,
+   ASPrecGen
+}AutoValueType;
+
+typedef struct auto_setting_cell
+{
+   char*           name;
+   AutoValueType   type;
+   AutoSettingPart part;
+}AutoSettingCell;
+
+static AutoSettingCell setting_table[] =
+{
+   {"prefer_initial_clauses", ASBool,      ASHeuristicPart},
+   {"selection_strategy",     ASLitSel,    ASHeuristicPart},
+   {"select_on_proc_only",    ASBool,      ASHeuristicPart},
+   {"pm_type",                ASParamod,   ASHeuristicPart},
+   {"forward_context_sr",     ASBool,      ASHeuristicPart},
+   {"forward_demod",          ASInt,       ASHeuristicPart},
+   {"prefer_general",         ASBool,      ASHeuristicPart},
+   {"condensing",             ASBool,      ASHeuristicPart},
+   {"er_varlit_destructive",  ASBool,      ASHeuristicPart},
+   {"er_strong_destructive",  ASBool,      ASHeuristicPart},
+   {"er_aggressive",          ASBool,      ASHeuristicPart},
+   {"split_clauses",          ASInt,       ASHeuristicPart},
+   {"split_aggressive",       ASBool,      ASHeuristicPart},
+   {"split_fresh_defs",       ASBool,      ASHeuristicPart},
+   {"use_tptp_sos",           ASBool,      ASHeuristicPart},
+   {"presat_interreduction",  ASBool,      ASHeuristicPart},
+   {"ordertype",              ASOrdering,  ASOrderingPart},
+   {"to_weight_gen",          ASWeightGen, ASOrderingPart},
+   {"to_prec_gen",            ASPrecGen,   ASOrderingPart},
+   {"to_const_weight",        ASInt,       ASOrderingPart},
+   {NULL,                     ASBool,      ASHeuristicPart}
+};
+
+/* Names for ParamodulationType, in enum order */
+
+static char* paramod_names[] =
+{
+   "ParamodPlain",
+   "ParamodAlwaysSim",
+   "ParamodOrientedSim",
+   NULL
+};
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_name_index()
+//
+//   Parse an identifier and return its index in names. Print an
+//   error message (with descr describing what was expected) if it is
+//   not found.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, may terminate program
+//
+/----------------------------------------------------------------------*/
+
+static int parse_name_index(Scanner_p in, char* names[], char* descr)
+{
+   int    res;
+   DStr_p err;
+
+   CheckInpTok(in, Identifier);
+   res = StringIndex(DStrView(AktToken(in)->literal), names);
+   if(res == -1)
+   {
+      err = DStrAlloc();
+      DStrAppendStr(err, "Unknown ");
+      DStrAppendStr(err, descr);
+      AktTokenError(in, DStrView(err), false);
+      DStrFree(err);
+   }
+   NextToken(in);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_bool()
+//
+//   Parse true or false.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static bool parse_bool(Scanner_p in)
+{
+   bool res = TestInpId(in, "true");
+
+   AcceptInpId(in, "true|false");
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_limits()
+//
+//   Parse a list of limit settings into limits.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes limits
+//
+/----------------------------------------------------------------------*/
+
+static void parse_limits(Scanner_p in, SpecLimits_p limits)
+{
+   char* id;
+
+   AcceptInpId(in, "limits");
+   AcceptInpTok(in, OpenBracket);
+   while(!TestInpTok(in, CloseBracket))
+   {
+      CheckInpTok(in, Identifier);
+      id = DStrCopy(AktToken(in)->literal);
+      NextToken(in);
+      AcceptInpTok(in, EqualSign);
+      if(strcmp(id, "ngu_absolute")==0)
+      {
+         limits->ngu_absolute = parse_bool(in);
+      }
+      else if(strcmp(id, "ngu_few_limit")==0)
+      {
+         limits->ngu_few_limit = ParseFloat(in);
+      }
+      else if(strcmp(id, "ngu_many_limit")==0)
+      {
+         limits->ngu_many_limit = ParseFloat(in);
+      }
+      else if(strcmp(id, "gpc_absolute")==0)
+      {
+         limits->gpc_absolute = parse_bool(in);
+      }
+      else if(strcmp(id, "gpc_few_limit")==0)
+      {
+         limits->gpc_few_limit = ParseFloat(in);
+      }
+      else if(strcmp(id, "gpc_many_limit")==0)
+      {
+         limits->gpc_many_limit = ParseFloat(in);
+      }
+      else if(strcmp(id, "ax_some_limit")==0)
+      {
+         limits->ax_some_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "ax_many_limit")==0)
+      {
+         limits->ax_many_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "lit_some_limit")==0)
+      {
+         limits->lit_some_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "lit_many_limit")==0)
+      {
+         limits->lit_many_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "term_medium_limit")==0)
+      {
+         limits->term_medium_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "term_large_limit")==0)
+      {
+         limits->term_large_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "far_sum_medium_limit")==0)
+      {
+         limits->far_sum_medium_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "far_sum_large_limit")==0)
+      {
+         limits->far_sum_large_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "depth_medium_limit")==0)
+      {
+         limits->depth_medium_limit = ParseInt(in);
+      }
+      else if(strcmp(id, "depth_deep_limit")==0)
+      {
+         limits->depth_deep_limit = ParseInt(in);
+      }
+      else
+      {
+         AktTokenError(in, "Unknown limit (preceeding this token)", false);
+      }
+      FREE(id);
+      if(!TestInpTok(in, CloseBracket))
+      {
+         AcceptInpTok(in, Comma);
+      }
+   }
+   AcceptInpTok(in, CloseBracket);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_setting_index()
+//
+//   Parse the name of a setting and return its index in
+//   setting_table. Settings must belong to part.
+//
+// Global Variables: setting_table
+//
+// Side Effects    : Input, may terminate program
+//
+/----------------------------------------------------------------------*/
+
+static int parse_setting_index(Scanner_p in, AutoSettingPart part)
+{
+   int i;
+
+   CheckInpTok(in, Identifier);
+   for(i=0; setting_table[i].name; i++)
+   {
+      if(strcmp(DStrView(AktToken(in)->literal), setting_table[i].name)==0)
+      {
+         if(setting_table[i].part != part)
+         {
+            AktTokenError(in, (part == ASOrderingPart)?
+                          "Not an ordering setting (use 'set')":
+                          "Not a heuristic setting (use 'order')",
+                          false);
+         }
+         NextToken(in);
+         return i;
+      }
+   }
+   AktTokenError(in, "Unknown setting", false);
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_settings()
+//
+//   Parse a comma-separated list of settings for part and push them
+//   onto settings.
+//
+// Global Variables: setting_table, paramod_names, TONames,
+//                   TOWeightGenNames, TOPrecGenNames
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void parse_settings(Scanner_p in, PStack_p settings,
+                           AutoSettingPart part)
+{
+   int                 setting;
+   LiteralSelectionFun sel;
+
+   while(true)
+   {
+      setting = parse_setting_index(in, part);
+      AcceptInpTok(in, EqualSign);
+      PStackPushInt(settings, setting);
+      switch(setting_table[setting].type)
+      {
+      case ASBool:
+            PStackPushInt(settings, parse_bool(in));
+            break;
+      case ASInt:
+            PStackPushInt(settings, ParseInt(in));
+            break;
+      case ASLitSel:
+            CheckInpTok(in, Identifier);
+            sel = GetLitSelFun(DStrView(AktToken(in)->literal));
+            if(!sel)
+            {
+               AktTokenError(in, "Unknown literal selection function",
+                             false);
+            }
+            PStackPushP(settings, sel);
+            NextToken(in);
+            break;
+      case ASParamod:
+            PStackPushInt(settings,
+                          parse_name_index(in, paramod_names,
+                                           "paramodulation type"));
+            break;
+      case ASOrdering:
+            PStackPushInt(settings,
+                          parse_name_index(in, TONames, "term ordering"));
+            if(PStackTopInt(settings) < KBO)
+            {
+               Error("Auto tables need a concrete term ordering",
+                     USAGE_ERROR);
+            }
+            break;
+      case ASWeightGen:
+            PStackPushInt(settings,
+                          parse_name_index(in, TOWeightGenNames,
+                                           "weight generation scheme"));
+            break;
+      case ASPrecGen:
+            PStackPushInt(settings,
+                          parse_name_index(in, TOPrecGenNames,
+                                           "precedence generation scheme"));
+            break;
+      default:
+            assert(false && "Unknown setting type");
+            break;
+      }
+      if(!TestInpTok(in, Comma))
+      {
+         break;
+      }
+      NextToken(in);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_case_parse()
+//
+//   Parse the body of a case (everything after the keyword) and
+//   return it.
+//
+// Global Variables: pred_table
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoCase_p auto_case_parse(Scanner_p in)
+{
+   AutoCase_p handle = AutoCaseCellAlloc();
+   char       *tmp;
+   int        i;
+
+   CheckInpTok(in, Name);
+   tmp = DStrCopy(AktToken(in)->literal);
+   if(TestInpTok(in, String))
+   {
+      tmp[strlen(tmp)-1] = '\0';
+      handle->heuristic = SecureStrdup(tmp+1);
+      FREE(tmp);
+   }
+   else
+   {
+      handle->heuristic = tmp;
+   }
+   NextToken(in);
+   handle->conditions = PStackAlloc();
+   handle->settings   = PStackAlloc();
+
+   while(TestInpId(in, "if"))
+   {
+      NextToken(in);
+      while(true)
+      {
+         CheckInpTok(in, Identifier);
+         for(i=0; pred_table[i].name; i++)
+         {
+            if(strcmp(DStrView(AktToken(in)->literal),
+                      pred_table[i].name)==0)
+            {
+               break;
+            }
+         }
+         if(!pred_table[i].name)
+         {
+            AktTokenError(in, "Unknown problem class predicate", false);
+         }
+         PStackPushInt(handle->conditions, i);
+         NextToken(in);
+         if(!TestInpTok(in, Ampersand))
+         {
+            break;
+         }
+         NextToken(in);
+      }
+      PStackPushInt(handle->conditions, -1);
+   }
+   if(TestInpId(in, "set"))
+   {
+      NextToken(in);
+      parse_settings(in, handle->settings, ASHeuristicPart);
+   }
+   if(TestInpId(in, "order"))
+   {
+      NextToken(in);
+      parse_settings(in, handle->settings, ASOrderingPart);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_case_free()
+//
+//   Free a case.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void auto_case_free(AutoCase_p junk)
+{
+   FREE(junk->heuristic);
+   PStackFree(junk->conditions);
+   PStackFree(junk->settings);
+   AutoCaseCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_case_matches()
+//
+//   Return true if one of the conjunctions in the condition of
+//   handle is true under the predicate values in preds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool auto_case_matches(AutoCase_p handle, bool *preds)
+{
+   PStackPointer i;
+   long          pred;
+   bool          res = true;
+
+   for(i=0; i<PStackGetSP(handle->conditions); i++)
+   {
+      pred = PStackElementInt(handle->conditions, i);
+      if(pred == -1)
+      {
+         if(res)
+         {
+            return true;
+         }
+         res = true;
+      }
+      else
+      {
+         res = res && preds[pred];
+      }
+   }
+   return false;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableAlloc()
+//
+//   Allocate an empty auto table with the default limits.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableAlloc(void)
+{
+   AutoTable_p handle = AutoTableCellAlloc();
+
+   handle->limits     = CreateDefaultSpecLimits();
+   handle->heuristics = DStrAlloc();
+   handle->cases      = PStackAlloc();
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableFree()
+//
+//   Free an auto table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTableFree(AutoTable_p junk)
+{
+   assert(junk);
+
+   SpecLimitsCellFree(junk->limits);
+   DStrFree(junk->heuristics);
+   while(!PStackEmpty(junk->cases))
+   {
+      auto_case_free(PStackPopP(junk->cases));
+   }
+   PStackFree(junk->cases);
+   AutoTableCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableParse()
+//
+//   Parse an auto table (see che_autotable.h for the syntax).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableParse(Scanner_p in)
+{
+   AutoTable_p handle = AutoTableAlloc();
+   char        *tmp;
+
+   if(TestInpId(in, "limits"))
+   {
+      parse_limits(in, handle->limits);
+   }
+   while(TestInpId(in, "heuristic"))
+   {
+      NextToken(in);
+      CheckInpTok(in, String);
+      tmp = DStrCopy(AktToken(in)->literal);
+      tmp[strlen(tmp)-1] = '\0';
+      DStrAppendStr(handle->heuristics, tmp+1);
+      DStrAppendChar(handle->heuristics, '\n');
+      FREE(tmp);
+      NextToken(in);
+   }
+   while(TestInpId(in, "case"))
+   {
+      NextToken(in);
+      PStackPushP(handle->cases, auto_case_parse(in));
+   }
+   AcceptInpId(in, "default");
+   PStackPushP(handle->cases, auto_case_parse(in));
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableLoad()
+//
+//   Parse the auto table in file.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableLoad(char* file)
+{
+   Scanner_p   in;
+   AutoTable_p res;
+
+   in = CreateScanner(StreamTypeFile, file, true, NULL);
+   res = AutoTableParse(in);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableSelectCase()
+//
+//   Classify spec with the limits of the table and return the first
+//   case with a satisfied condition (or the default case).
+//
+// Global Variables: pred_table, OutputLevel, GlobalOut
+//
+// Side Effects    : Changes the cheap parts of spec, output
+//
+/----------------------------------------------------------------------*/
+
+AutoCase_p AutoTableSelectCase(AutoTable_p table, SpecFeature_p spec)
+{
+   bool          preds[sizeof(pred_table)/sizeof(AutoPredCell)];
+   PStackPointer i;
+   AutoCase_p    handle;
+
+   SpecFeaturesAddEval(spec, table->limits);
+   if(OutputLevel)
+   {
+      fprintf(GlobalOut, "# Problem is type ");
+      SpecTypePrint(GlobalOut, spec, DEFAULT_CLASS_MASK);
+      fputc('\n', GlobalOut);
+   }
+   for(i=0; pred_table[i].name; i++)
+   {
+      preds[i] = pred_table[i].pred(spec);
+   }
+   assert(!PStackEmpty(table->cases));
+   for(i=0; i<PStackGetSP(table->cases)-1; i++)
+   {
+      handle = PStackElementP(table->cases, i);
+      if(auto_case_matches(handle, preds))
+      {
+         return handle;
+      }
+   }
+   return PStackTopP(table->cases);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoCaseApply()
+//
+//   Apply the settings of handle that belong to part to parms.
+//
+// Global Variables: setting_table
+//
+// Side Effects    : Changes parms
+//
+/----------------------------------------------------------------------*/
+
+void AutoCaseApply(AutoCase_p handle, HeuristicParms_p parms,
+                   AutoSettingPart part)
+{
+   PStackPointer i;
+   int           setting;
+   IntOrP        value;
+
+   for(i=0; i<PStackGetSP(handle->settings); i+=2)
+   {
+      setting = PStackElementInt(handle->settings, i);
+      value   = handle->settings->stack[i+1];
+      if(setting_table[setting].part != part)
+      {
+         continue;
+      }
+      switch(setting)
+      {
+      case ASPreferInitialClauses:
+            parms->prefer_initial_clauses = value.i_val;
+            break;
+      case ASSelectionStrategy:
+            parms->selection_strategy = (LiteralSelectionFun)value.p_val;
+            break;
+      case ASSelectOnProcOnly:
+            parms->select_on_proc_only = value.i_val;
+            break;
+      case ASPmType:
+            parms->pm_type = value.i_val;
+            break;
+      case ASForwardContextSR:
+            parms->forward_context_sr = value.i_val;
+            break;
+      case ASForwardDemod:
+            parms->forward_demod = value.i_val;
+            break;
+      case ASPreferGeneral:
+            parms->prefer_general = value.i_val;
+            break;
+      case ASCondensing:
+            parms->condensing = value.i_val;
+            break;
+      case ASERVarlitDestructive:
+            parms->er_varlit_destructive = value.i_val;
+            break;
+      case ASERStrongDestructive:
+            parms->er_strong_destructive = value.i_val;
+            break;
+      case ASERAggressive:
+            parms->er_aggressive = value.i_val;
+            break;
+      case ASSplitClauses:
+            parms->split_clauses = value.i_val;
+            break;
+      case ASSplitAggressive:
+            parms->split_aggressive = value.i_val;
+            break;
+      case ASSplitFreshDefs:
+            parms->split_fresh_defs = value.i_val;
+            break;
+      case ASUseTPTPSoS:
+            parms->use_tptp_sos = value.i_val;
+            break;
+      case ASPresatInterreduction:
+            parms->presat_interreduction = value.i_val;
+            break;
+      case ASOrderType:
+            parms->ordertype = value.i_val;
+            break;
+      case ASToWeightGen:
+            parms->to_weight_gen = value.i_val;
+            break;
+      case ASToPrecGen:
+            parms->to_prec_gen = value.i_val;
+            break;
+      case ASToConstWeight:
+            parms->to_const_weight = value.i_val;
+            break;
+      default:
+            assert(false && "Unknown setting");
+            break;
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,109 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotable.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Table-driven auto mode. An auto table is a list of problem classes
+  (each a disjunction of conjunctions of the class predicates from
+  che_clausesetfeatures.h), each with a heuristic and the parameter
+  settings for the search and the term ordering. Tables are read at
+  run time and interpreted over the SpecFeatures of the problem, so
+  that a new auto mode does not require regenerating and recompiling
+  the che_X_*.c case distinctions.
+
+  Syntax (whitespace is irrelevant, # starts a comment):
+
+  <table>     ::= [limits(<setting>{,<setting>})]
+                  {heuristic <string>}
+                  {case <case>}
+                  default <case>
+  <case>      ::= <name> {if <pred>{&<pred>}}
+                  [set <setting>{,<setting>}]
+                  [order <setting>{,<setting>}]
+  <setting>   ::= <identifier>=<value>
+
+  The heuristic strings are heuristic definitions as in
+  DefaultHeuristics. The first case with a satisfied condition wins,
+  the default case is used if none matches.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 10:12:31 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_AUTOTABLE
+
+#define CHE_AUTOTABLE
+
+#include <che_hcb.h>
+#include <che_clausesetfeatures.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Which parameters a setting belongs to - heuristic parameters are
+   set by the heuristic selection, ordering parameters by the ordering
+   selection. */
+
+typedef enum
+{
+   ASHeuristicPart,
+   ASOrderingPart
+}AutoSettingPart;
+
+
+typedef struct auto_case_cell
+{
+   char*    heuristic;  /* Name or definition for GetHeuristic() */
+   PStack_p conditions; /* Predicate indices, each conjunction
+                           terminated by -1 */
+   PStack_p settings;   /* Pairs of setting index and value */
+}AutoCaseCell, *AutoCase_p;
+
+
+typedef struct auto_table_cell
+{
+   SpecLimits_p limits;
+   DStr_p       heuristics; /* Heuristic definitions */
+   PStack_p     cases;      /* Default case is last */
+}AutoTableCell, *AutoTable_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define AutoCaseCellAlloc() (AutoCaseCell*)SizeMalloc(sizeof(AutoCaseCell))
+#define AutoCaseCellFree(junk) SizeFree(junk, sizeof(AutoCaseCell))
+#define AutoTableCellAlloc() \
+   (AutoTableCell*)SizeMalloc(sizeof(AutoTableCell))
+#define AutoTableCellFree(junk) SizeFree(junk, sizeof(AutoTableCell))
+
+AutoTable_p AutoTableAlloc(void);
+void        AutoTableFree(AutoTable_p junk);
+
+AutoTable_p AutoTableParse(Scanner_p in);
+AutoTable_p AutoTableLoad(char* file);
+
+AutoCase_p  AutoTableSelectCase(AutoTable_p table, SpecFeature_p spec);
+void        AutoCaseApply(AutoCase_p handle, HeuristicParms_p parms,
+                          AutoSettingPart part);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
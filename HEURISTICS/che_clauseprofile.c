@@ -0,0 +1,481 @@
+/*-----------------------------------------------------------------------
+
+File  : che_clauseprofile.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Computation of clause profiles and of the standard weight functions
+  based on them.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 23:40:12 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_clauseprofile.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+PERF_CTR_DEFINE(ClauseProfileTimer);
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_count_symbols()
+//
+//   Set *fcount and *vcount to the number of function symbol and
+//   variable occurrences in term. Shared terms have the values
+//   cached.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void term_count_symbols(Term_p term, long *fcount, long *vcount)
+{
+   if(TermIsShared(term))
+   {
+      *fcount = term->f_count;
+      *vcount = term->v_count;
+   }
+   else
+   {
+      *fcount = TermWeightCompute(term, 0, 1);
+      *vcount = TermWeightCompute(term, 1, 0);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_collect_fcodes()
+//
+//   Push the f_codes of all non-variable subterm occurrences of term
+//   onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : Pushes onto res
+//
+/----------------------------------------------------------------------*/
+
+static void term_collect_fcodes(Term_p term, PStack_p res)
+{
+   int i;
+
+   if(!TermIsVar(term))
+   {
+      PStackPushInt(res, term->f_code);
+      for(i=0; i<term->arity; i++)
+      {
+         term_collect_fcodes(term->args[i], res);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fcodes_weight()
+//
+//   Return the sum of the weights of the f_codes stored in
+//   profile->fcodes between start (inclusive) and end (exclusive).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fcodes_weight(ClauseProfile_p profile,
+                          PStackPointer start, PStackPointer end,
+                          long flimit, long *fweights,
+                          long default_fweight)
+{
+   long res = 0, f_code;
+   PStackPointer i;
+
+   for(i=start; i<end; i++)
+   {
+      f_code = PStackElementInt(profile->fcodes, i);
+      res += (f_code < flimit)? fweights[f_code]:default_fweight;
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileAlloc()
+//
+//   Allocate an empty clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ClauseProfile_p ClauseProfileAlloc(void)
+{
+   ClauseProfile_p handle = ClauseProfileCellAlloc();
+
+   handle->clause      = NULL;
+   handle->lit_no      = 0;
+   handle->size        = CLAUSE_PROFILE_DEFAULT_SIZE;
+   handle->lits        = SizeMalloc(handle->size*sizeof(LitProfileCell));
+   handle->with_fcodes = false;
+   handle->fcodes      = PStackAlloc();
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileFree()
+//
+//   Free a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseProfileFree(ClauseProfile_p junk)
+{
+   assert(junk);
+
+   SizeFree(junk->lits, junk->size*sizeof(LitProfileCell));
+   PStackFree(junk->fcodes);
+   ClauseProfileCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileCompute()
+//
+//   (Re-)compute profile for clause in a single traversal. If
+//   with_fcodes is true, also collect the function symbol
+//   occurrences of all terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes profile, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseProfileCompute(ClauseProfile_p profile, Clause_p clause,
+                          bool with_fcodes)
+{
+   Eqn_p        handle;
+   LitProfile_p lp;
+   long         lit_no = ClauseLiteralNumber(clause);
+
+   PERF_CTR_ENTRY(ClauseProfileTimer);
+   if(lit_no > profile->size)
+   {
+      SizeFree(profile->lits, profile->size*sizeof(LitProfileCell));
+      while(profile->size < lit_no)
+      {
+         profile->size *= 2;
+      }
+      profile->lits = SizeMalloc(profile->size*sizeof(LitProfileCell));
+   }
+   profile->clause      = clause;
+   profile->lit_no      = lit_no;
+   profile->with_fcodes = with_fcodes;
+   PStackReset(profile->fcodes);
+
+   for(handle = clause->literals, lp = profile->lits;
+       handle;
+       handle = handle->next, lp++)
+   {
+      lp->lit = handle;
+      term_count_symbols(handle->lterm, &(lp->lterm_fcount),
+                         &(lp->lterm_vcount));
+      term_count_symbols(handle->rterm, &(lp->rterm_fcount),
+                         &(lp->rterm_vcount));
+      lp->lterm_fcodes = PStackGetSP(profile->fcodes);
+      if(with_fcodes)
+      {
+         term_collect_fcodes(handle->lterm, profile->fcodes);
+      }
+      lp->rterm_fcodes = PStackGetSP(profile->fcodes);
+      if(with_fcodes)
+      {
+         term_collect_fcodes(handle->rterm, profile->fcodes);
+      }
+      lp->fcodes_end = PStackGetSP(profile->fcodes);
+   }
+   PERF_CTR_EXIT(ClauseProfileTimer);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitProfileWeight()
+//
+//   Return the weight of a profiled literal, exactly as
+//   LiteralWeight() does for the literal itself.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double LitProfileWeight(LitProfile_p lp, double max_term_multiplier,
+                        double max_literal_multiplier,
+                        double pos_multiplier,
+                        long vweight, long fweight,
+                        bool count_eq_encoding)
+{
+   double res;
+   Eqn_p  eq = lp->lit;
+
+   if(count_eq_encoding || EqnIsEquLit(eq))
+   {
+      res = (double)LitProfileTermWeight(lp, rterm, vweight, fweight);
+      if(!EqnIsOriented(eq))
+      {
+         res = res * max_term_multiplier;
+      }
+      if(!count_eq_encoding)
+      {
+         res += fweight; /* Count the equal-predicate */
+      }
+   }
+   else
+   {
+      res = 0;
+   }
+   res += ((double)LitProfileTermWeight(lp, lterm, vweight, fweight) *
+           max_term_multiplier);
+
+   if(EqnIsMaximal(eq))
+   {
+      res = res*max_literal_multiplier;
+   }
+   if(EqnIsPositive(eq))
+   {
+      res = res*pos_multiplier;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitProfileMaxWeight()
+//
+//   Return the weight of the heavier side of a profiled literal (see
+//   EqnMaxWeight()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double LitProfileMaxWeight(LitProfile_p lp, long vweight, long fweight)
+{
+   double lweight = LitProfileTermWeight(lp, lterm, vweight, fweight);
+   double rweight = LitProfileTermWeight(lp, rterm, vweight, fweight);
+
+   return MAX(lweight, rweight);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileWeight()
+//
+//   Compute ClauseWeight() for the profiled clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseProfileWeight(ClauseProfile_p profile,
+                           double max_term_multiplier,
+                           double max_literal_multiplier,
+                           double pos_multiplier,
+                           long vweight, long fweight,
+                           bool count_eq_encoding)
+{
+   double res = 0;
+   long   i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      res += LitProfileWeight(&(profile->lits[i]), max_term_multiplier,
+                              max_literal_multiplier, pos_multiplier,
+                              vweight, fweight, count_eq_encoding);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileOrientWeight()
+//
+//   Compute ClauseOrientWeight() for the profiled clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseProfileOrientWeight(ClauseProfile_p profile,
+                                 double unorientable_literal_multiplier,
+                                 double max_literal_multiplier,
+                                 double pos_multiplier,
+                                 long vweight, long fweight,
+                                 bool count_eq_encoding)
+{
+   double       res = 0, tmp;
+   LitProfile_p lp;
+   long         i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      lp = &(profile->lits[i]);
+      tmp = LitProfileWeight(lp, 1, max_literal_multiplier,
+                             pos_multiplier, vweight, fweight,
+                             count_eq_encoding);
+      if(!EqnIsOriented(lp->lit))
+      {
+         tmp = tmp*unorientable_literal_multiplier;
+      }
+      res += tmp;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileFunWeight()
+//
+//   Compute ClauseFunWeight() for the profiled clause. The profile
+//   has to be computed with_fcodes.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseProfileFunWeight(ClauseProfile_p profile,
+                              double max_term_multiplier,
+                              double max_literal_multiplier,
+                              double pos_multiplier,
+                              long vweight, long flimit,
+                              long *fweights, long default_fweight)
+{
+   double       res = 0, tmp;
+   LitProfile_p lp;
+   long         i;
+
+   assert(profile->with_fcodes);
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      lp = &(profile->lits[i]);
+      tmp = (double)(lp->rterm_vcount*vweight +
+                     fcodes_weight(profile, lp->rterm_fcodes,
+                                   lp->fcodes_end, flimit,
+                                   fweights, default_fweight));
+      if(!EqnIsOriented(lp->lit))
+      {
+         tmp *= max_term_multiplier;
+      }
+      tmp += (double)(lp->lterm_vcount*vweight +
+                      fcodes_weight(profile, lp->lterm_fcodes,
+                                    lp->rterm_fcodes, flimit,
+                                    fweights, default_fweight))
+         * max_term_multiplier;
+
+      if(EqnIsMaximal(lp->lit))
+      {
+         tmp = tmp*max_literal_multiplier;
+      }
+      if(EqnIsPositive(lp->lit))
+      {
+         tmp = tmp*pos_multiplier;
+      }
+      res += tmp;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseProfileStandardWeight()
+//
+//   Compute ClauseStandardWeight() for the profiled clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseProfileStandardWeight(ClauseProfile_p profile)
+{
+   double       res = 0;
+   LitProfile_p lp;
+   long         i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      lp = &(profile->lits[i]);
+      res += (LitProfileTermWeight(lp, lterm, DEFAULT_VWEIGHT, DEFAULT_FWEIGHT)+
+              LitProfileTermWeight(lp, rterm, DEFAULT_VWEIGHT, DEFAULT_FWEIGHT));
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,123 @@
+/*-----------------------------------------------------------------------
+
+File  : che_clauseprofile.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Clause profiles: Per-literal summaries (symbol and variable counts
+  of both sides, optionally the function symbol occurrences) that are
+  computed once per clause and shared by all weight functions of a
+  heuristic that can work from them. The profile functions here
+  mirror ClauseWeight(), ClauseFunWeight() and friends exactly, they
+  only avoid re-traversing the clause for every evaluation.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 23:40:12 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_CLAUSEPROFILE
+
+#define CHE_CLAUSEPROFILE
+
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Summary of a single literal. The f_code ranges refer to
+   profile->fcodes and are only valid if the profile has been
+   computed with_fcodes. */
+
+typedef struct lit_profile_cell
+{
+   Eqn_p         lit;
+   long          lterm_fcount;
+   long          lterm_vcount;
+   long          rterm_fcount;
+   long          rterm_vcount;
+   PStackPointer lterm_fcodes;
+   PStackPointer rterm_fcodes;
+   PStackPointer fcodes_end;
+}LitProfileCell, *LitProfile_p;
+
+
+typedef struct clause_profile_cell
+{
+   Clause_p       clause;
+   long           lit_no;
+   long           size;     /* Allocated literal cells */
+   LitProfileCell *lits;
+   bool           with_fcodes;
+   PStack_p       fcodes;   /* f_codes of all non-variable subterm
+                               occurrences, literal by literal */
+}ClauseProfileCell, *ClauseProfile_p;
+
+#define CLAUSE_PROFILE_DEFAULT_SIZE 16
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+PERF_CTR_DECL(ClauseProfileTimer);
+
+#define ClauseProfileCellAlloc() \
+   (ClauseProfileCell*)SizeMalloc(sizeof(ClauseProfileCell))
+#define ClauseProfileCellFree(junk) \
+   SizeFree(junk, sizeof(ClauseProfileCell))
+
+ClauseProfile_p ClauseProfileAlloc(void);
+void            ClauseProfileFree(ClauseProfile_p junk);
+
+void            ClauseProfileCompute(ClauseProfile_p profile,
+                                     Clause_p clause,
+                                     bool with_fcodes);
+
+#define LitProfileTermWeight(lp, side, vweight, fweight) \
+   ((lp)->side##_vcount*(vweight) + (lp)->side##_fcount*(fweight))
+
+double LitProfileWeight(LitProfile_p lp, double max_term_multiplier,
+                        double max_literal_multiplier,
+                        double pos_multiplier,
+                        long vweight, long fweight,
+                        bool count_eq_encoding);
+double LitProfileMaxWeight(LitProfile_p lp, long vweight, long fweight);
+
+double ClauseProfileWeight(ClauseProfile_p profile,
+                           double max_term_multiplier,
+                           double max_literal_multiplier,
+                           double pos_multiplier,
+                           long vweight, long fweight,
+                           bool count_eq_encoding);
+double ClauseProfileOrientWeight(ClauseProfile_p profile,
+                                 double unorientable_literal_multiplier,
+                                 double max_literal_multiplier,
+                                 double pos_multiplier,
+                                 long vweight, long fweight,
+                                 bool count_eq_encoding);
+double ClauseProfileFunWeight(ClauseProfile_p profile,
+                              double max_term_multiplier,
+                              double max_literal_multiplier,
+                              double pos_multiplier,
+                              long vweight, long flimit,
+                              long *fweights, long default_fweight);
+double ClauseProfileStandardWeight(ClauseProfile_p profile);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -114,13 +114,16 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
          vweight, double pos_multiplier)
 {
    WeightParam_p data = WeightParamCellAlloc();
+   WFCB_p        res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
    data->pos_multiplier         = pos_multiplier;
 
-   return WFCBAlloc(ClauseWeightCompute, prio_fun,
-          ClauseWeightExit, data);
+   res = WFCBAlloc(ClauseWeightCompute, prio_fun,
+                   ClauseWeightExit, data);
+   WFCBSetProfileEval(res, ClauseWeightProfileCompute, NULL, false);
+   return res;
 }
 
 
@@ -180,6 +183,29 @@ double ClauseWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseWeightProfileCompute()
+//
+//   As ClauseWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   WeightParam_p local = data;
+   return ClauseProfileWeight(profile, 1, 1,
+                              local->pos_multiplier,
+                              local->vweight,
+                              local->fweight,
+                              false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: LMaxWeightInit()
@@ -196,13 +222,16 @@ WFCB_p LMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
          vweight, double pos_multiplier)
 {
    WeightParam_p data = WeightParamCellAlloc();
+   WFCB_p        res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
    data->pos_multiplier         = pos_multiplier;
 
-   return WFCBAlloc(LMaxWeightCompute, prio_fun,
-          ClauseWeightExit, data);
+   res = WFCBAlloc(LMaxWeightCompute, prio_fun,
+                   ClauseWeightExit, data);
+   WFCBSetProfileEval(res, LMaxWeightProfileCompute, NULL, false);
+   return res;
 }
 
 
@@ -271,6 +300,38 @@ double LMaxWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: LMaxWeightProfileCompute()
+//
+//   As LMaxWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double LMaxWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   WeightParam_p local = data;
+   double res = 0, tmp;
+   long   i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      tmp = LitProfileMaxWeight(&(profile->lits[i]),
+                                local->vweight, local->fweight);
+      if(EqnIsPositive(profile->lits[i].lit))
+      {
+         tmp = tmp*local->pos_multiplier;
+      }
+      res += tmp;
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: CMaxWeightInit()
@@ -287,13 +348,16 @@ WFCB_p CMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
          vweight, double pos_multiplier)
 {
    WeightParam_p data = WeightParamCellAlloc();
+   WFCB_p        res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
    data->pos_multiplier         = pos_multiplier;
 
-   return WFCBAlloc(CMaxWeightCompute, prio_fun,
-          ClauseWeightExit, data);
+   res = WFCBAlloc(CMaxWeightCompute, prio_fun,
+                   ClauseWeightExit, data);
+   WFCBSetProfileEval(res, CMaxWeightProfileCompute, NULL, false);
+   return res;
 }
 
 
@@ -359,6 +423,35 @@ double CMaxWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: CMaxWeightProfileCompute()
+//
+//   As CMaxWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double CMaxWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   WeightParam_p local = data;
+   double res = 0, tmp;
+   long   i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      tmp = LitProfileMaxWeight(&(profile->lits[i]),
+                                local->vweight, local->fweight);
+      res = MAX(res,tmp);
+   }
+   return profile->clause->pos_lit_no*res*local->pos_multiplier +
+      profile->clause->neg_lit_no*res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseWeightExit()
@@ -462,8 +555,10 @@ double UniqWeightCompute(void* data, Clause_p clause)
 
 WFCB_p DefaultWeightInit(ClausePrioFun prio_fun)
 {
-   return WFCBAlloc(DefaultWeightCompute, prio_fun,
-          TrivialWeightExit, NULL);
+   WFCB_p res = WFCBAlloc(DefaultWeightCompute, prio_fun,
+                          TrivialWeightExit, NULL);
+   WFCBSetProfileEval(res, DefaultWeightProfileCompute, NULL, false);
+   return res;
 }
 
 
@@ -507,6 +602,24 @@ double DefaultWeightCompute(void* data, Clause_p clause)
    return ClauseStandardWeight(clause);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: DefaultWeightProfileCompute()
+//
+//   As DefaultWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double DefaultWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   return ClauseProfileStandardWeight(profile);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: TrivialWeightExit()
@@ -59,6 +59,7 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
 WFCB_p ClauseWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
 
 double ClauseWeightCompute(void* data, Clause_p clause);
+double ClauseWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 WFCB_p LMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
              vweight, double pos_multiplier);
@@ -66,6 +67,7 @@ WFCB_p LMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
 WFCB_p LMaxWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
 
 double LMaxWeightCompute(void* data, Clause_p clause);
+double LMaxWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 WFCB_p CMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
              vweight, double pos_multiplier);
@@ -73,6 +75,7 @@ WFCB_p CMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
 WFCB_p CMaxWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
 
 double CMaxWeightCompute(void* data, Clause_p clause);
+double CMaxWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 void   ClauseWeightExit(void* data);
 
@@ -89,6 +92,7 @@ WFCB_p DefaultWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
            state);
 
 double DefaultWeightCompute(void* data, Clause_p clause);
+double DefaultWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 
 void TrivialWeightExit(void* data);
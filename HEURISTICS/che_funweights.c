@@ -409,6 +409,7 @@ WFCB_p ConjectureSymbolWeightInit(ClausePrioFun prio_fun,
                                   long   conj_pweight)
 {
    FunWeightParam_p data = FunWeightParamAlloc();
+   WFCB_p           res;
 
    data->init_fun               = init_conj_vector;
    data->ocb                    = ocb;
@@ -430,8 +431,10 @@ WFCB_p ConjectureSymbolWeightInit(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead is many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   res = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                   GenericFunWeightExit, data);
+   WFCBSetProfileEval(res, GenericFunWeightProfileCompute, ocb, true);
+   return res;
 }
 
 
@@ -467,6 +470,7 @@ WFCB_p RelevanceLevelWeightInit(ClausePrioFun prio_fun,
 
 {
    FunWeightParam_p data = FunWeightParamAlloc();
+   WFCB_p           res;
 
    data->init_fun               = init_relevance_vector;
    data->ocb                    = ocb;
@@ -489,8 +493,10 @@ WFCB_p RelevanceLevelWeightInit(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead is many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   res = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                   GenericFunWeightExit, data);
+   WFCBSetProfileEval(res, GenericFunWeightProfileCompute, ocb, true);
+   return res;
 }
 
 /*-----------------------------------------------------------------------
@@ -522,6 +528,7 @@ WFCB_p RelevanceLevelWeightInit2(ClausePrioFun prio_fun,
                                  long   default_level_penalty)
 {
    FunWeightParam_p data = FunWeightParamAlloc();
+   WFCB_p           res;
 
    data->init_fun               = init_relevance_vector2;
    data->ocb                    = ocb;
@@ -544,8 +551,10 @@ WFCB_p RelevanceLevelWeightInit2(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead if many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   res = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                   GenericFunWeightExit, data);
+   WFCBSetProfileEval(res, GenericFunWeightProfileCompute, ocb, true);
+   return res;
 }
 
 
@@ -927,6 +936,7 @@ WFCB_p FunWeightInit(ClausePrioFun prio_fun,
                      PStack_p fweights)
 {
    FunWeightParam_p data = FunWeightParamAlloc();
+   WFCB_p           res;
 
    data->init_fun               = init_fun_weights;
    data->ocb                    = ocb;
@@ -939,8 +949,10 @@ WFCB_p FunWeightInit(ClausePrioFun prio_fun,
    data->fweight                = fweight;
    data->weight_stack           = fweights;
 
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   res = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                   GenericFunWeightExit, data);
+   WFCBSetProfileEval(res, GenericFunWeightProfileCompute, ocb, true);
+   return res;
 
 }
 
@@ -1145,6 +1157,35 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GenericFunWeightProfileCompute()
+//
+//   As GenericFunWeightCompute(), but work on a clause profile with
+//   function symbol occurrences.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double GenericFunWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   FunWeightParam_p local = data;
+
+   local->init_fun(data);
+   return ClauseProfileFunWeight(profile,
+                                 local->max_term_multiplier,
+                                 local->max_literal_multiplier,
+                                 local->pos_multiplier,
+                                 local->vweight,
+                                 local->flimit,
+                                 local->fweights,
+                                 local->fweight);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SymOffsetWeightCompute()
@@ -150,6 +150,7 @@ WFCB_p SymOffsetWeightParse(Scanner_p in, OCB_p ocb,
                             ProofState_p state);
 
 double GenericFunWeightCompute(void* data, Clause_p clause);
+double GenericFunWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 double SymOffsetWeightCompute(void* data, Clause_p clause);
 
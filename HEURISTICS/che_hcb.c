@@ -91,6 +91,7 @@ void default_exit_fun(void* data)
 void HeuristicParmsInitialize(HeuristicParms_p handle)
 {
    handle->heuristic_name                = HCB_DEFAULT_HEURISTIC;
+   handle->auto_table                    = NULL;
    handle->prefer_initial_clauses        = false;
 
    handle->ordertype                     = KBO6;
@@ -148,6 +149,9 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->filter_limit                  = DEFAULT_FILTER_LIMIT;
    handle->filter_copies_limit           = DEFAULT_FILTER_COPIES_LIMIT;
    handle->reweight_limit                = DEFAULT_REWEIGHT_INTERVAL;
+   handle->reweight_batch                = DEFAULT_REWEIGHT_BATCH;
+   handle->sat_check_limit               = DEFAULT_SAT_CHECK_INTERVAL;
+   handle->sat_check_conflicts           = DEFAULT_SAT_CHECK_CONFLICTS;
    handle->delete_bad_limit              = DEFAULT_DELETE_BAD_LIMIT;
    handle->mem_limit                     = 0;
    handle->watchlist_simplify            = true;
@@ -222,6 +226,10 @@ HCB_p HCBAlloc(void)
 
    handle->wfcb_list     = PDArrayAlloc(4,4);
    handle->wfcb_no       = 0;
+   handle->profile_users = 0;
+   handle->profile_fcodes= false;
+   handle->profile       = NULL;
+   handle->state_dependent_no = 0;
    handle->current_eval  = 0;
    handle->select_switch = PDArrayAlloc(4,4);
    handle->select_count  = 0;
@@ -252,6 +260,10 @@ void HCBFree(HCB_p junk)
       anyways! */
    PDArrayFree(junk->wfcb_list);
    PDArrayFree(junk->select_switch);
+   if(junk->profile)
+   {
+      ClauseProfileFree(junk->profile);
+   }
    if(junk->data)
    {
       junk->hcb_exit(junk->data);
@@ -287,6 +299,20 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
    PDArrayAssignInt(hcb->select_switch, hcb->wfcb_no, steps);
    hcb->wfcb_no++;
 
+   if(wfcb->wfcb_state_dependent)
+   {
+      hcb->state_dependent_no++;
+   }
+   if(wfcb->wfcb_profile_eval)
+   {
+      hcb->profile_users++;
+      hcb->profile_fcodes = hcb->profile_fcodes || wfcb->wfcb_profile_fcodes;
+      if(!hcb->profile)
+      {
+         hcb->profile = ClauseProfileAlloc();
+      }
+   }
+
    hcb->hcb_select = (hcb->wfcb_no != 1) ?
       HCBStandardClauseSelect : HCBSingleWeightClauseSelect;
 
@@ -299,7 +325,11 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
 //
 // Function: HCBClauseEvaluate()
 //
-//   Giben a HCB-Block, add evaluations to the given clause.
+//   Giben a HCB-Block, add evaluations to the given clause. If
+//   enough weight functions support it, the clause is profiled once
+//   (just before the first of these is needed, so that the order of
+//   side effects like marking maximal terms is preserved) and all of
+//   them are evaluated from the shared profile.
 //
 // Global Variables: -
 //
@@ -309,22 +339,68 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
 
 void HCBClauseEvaluate(HCB_p hcb, Clause_p clause)
 {
-   long i;
-   bool empty;
+   long   i;
+   bool   empty, use_profile, profiled = false, oriented = false;
+   WFCB_p wfcb;
 
    PERF_CTR_ENTRY(ClauseEvalTimer);
    assert(clause->evaluations == NULL);
    ClauseAddEvalCell(clause, EvalsAlloc(hcb->wfcb_no));
 
    empty = ClauseIsSemFalse(clause);
+   use_profile = (hcb->profile_users >= HCB_PROFILE_MIN_USERS);
    for(i=0; i< hcb->wfcb_no; i++)
    {
-      ClauseAddEvaluation(PDArrayElementP(hcb->wfcb_list, i), clause, i, empty);
+      wfcb = PDArrayElementP(hcb->wfcb_list, i);
+      if(use_profile && wfcb->wfcb_profile_eval)
+      {
+         /* Orienting may swap sides, so a profile of an unoriented
+            clause is recomputed if maximal terms are needed. */
+         if(!profiled || (wfcb->wfcb_profile_ocb && !oriented))
+         {
+            if(wfcb->wfcb_profile_ocb)
+            {
+               ClauseCondMarkMaximalTerms(wfcb->wfcb_profile_ocb, clause);
+            }
+            ClauseProfileCompute(hcb->profile, clause, hcb->profile_fcodes);
+            profiled = true;
+            oriented = ClauseQueryProp(clause, CPIsOriented);
+         }
+         ClauseAddProfileEvaluation(wfcb, hcb->profile, i, empty);
+      }
+      else
+      {
+         ClauseAddEvaluation(wfcb, clause, i, empty);
+      }
    }
    PERF_CTR_EXIT(ClauseEvalTimer);
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: HCBClauseReevaluate()
+//
+//   Recompute the evaluation at pos of an already evaluated
+//   clause. The clause must not be in the evaluation index for pos.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes evaluation, by eval functions
+//
+/----------------------------------------------------------------------*/
+
+void HCBClauseReevaluate(HCB_p hcb, Clause_p clause, int pos)
+{
+   PERF_CTR_ENTRY(ClauseEvalTimer);
+   assert(clause->evaluations);
+   assert(pos < hcb->wfcb_no);
+   ClauseAddEvaluation(PDArrayElementP(hcb->wfcb_list, pos), clause, pos,
+                       ClauseIsSemFalse(clause));
+   PERF_CTR_EXIT(ClauseEvalTimer);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: HCBStandardClauseSelect()
@@ -61,6 +61,7 @@ typedef struct heuristic_parms_cell
 {
    /* Clause selection elements */
    char                *heuristic_name;
+   char                *auto_table; /* File name or NULL */
    bool                prefer_initial_clauses;
 
    /* Ordering elements */
@@ -124,6 +125,9 @@ typedef struct heuristic_parms_cell
    long                filter_limit;
    long                filter_copies_limit;
    long                reweight_limit;
+   long                reweight_batch;
+   long                sat_check_limit;
+   long                sat_check_conflicts;
    long long           delete_bad_limit;
    rlim_t              mem_limit;
    bool                watchlist_simplify;
@@ -150,6 +154,18 @@ typedef struct hcb_cell
    PDArray_p       wfcb_list;
    int             wfcb_no;
 
+   /* Weight functions that can be evaluated from a shared clause
+      profile (see che_clauseprofile.h). If there are at least
+      HCB_PROFILE_MIN_USERS of them, the profile is computed once
+      per clause and reused by all of them. */
+   int             profile_users;
+   bool            profile_fcodes;
+   ClauseProfile_p profile;
+
+   /* Number of weight functions whose evaluations may change over
+      time (see che_wfcb.h). Only their queues need reweighting. */
+   int             state_dependent_no;
+
    /* Evaluation currently used for selection. This refers to the
       order of evaluations in the clause. See above!       */
    int             current_eval;
@@ -178,12 +194,17 @@ typedef struct hcb_cell
 #define DEFAULT_FILTER_LIMIT LONG_MAX
 #define DEFAULT_FILTER_COPIES_LIMIT LONG_MAX
 #define DEFAULT_REWEIGHT_INTERVAL LONG_MAX
+#define DEFAULT_REWEIGHT_BATCH 1000
+#define DEFAULT_SAT_CHECK_INTERVAL LONG_MAX
+#define DEFAULT_SAT_CHECK_CONFLICTS 10000
 #define DEFAULT_DELETE_BAD_LIMIT LONG_MAX
 
 #define DEFAULT_RW_BW_INDEX_NAME "FP7"
 #define DEFAULT_PM_FROM_INDEX_NAME "FP7"
 #define DEFAULT_PM_INTO_INDEX_NAME "FP7"
 
+#define HCB_PROFILE_MIN_USERS 2
+
 typedef Clause_p (*ClauseSelectFun)(HCB_p hcb, ClauseSet_p set);
 
 
@@ -210,6 +231,10 @@ HCB_p    HCBAlloc(void);
 void     HCBFree(HCB_p junk);
 long     HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps);
 void     HCBClauseEvaluate(HCB_p hcb, Clause_p clause);
+void     HCBClauseReevaluate(HCB_p hcb, Clause_p clause, int pos);
+#define  HCBHasStateDependentEvals(hcb) ((hcb)->state_dependent_no > 0)
+#define  HCBEvalIsStateDependent(hcb, pos) \
+         (((WFCB_p)PDArrayElementP((hcb)->wfcb_list, (pos)))->wfcb_state_dependent)
 Clause_p HCBStandardClauseSelect(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBSingleWeightClauseSelect(HCB_p hcb, ClauseSet_p set);
 
@@ -44,6 +44,7 @@ HeuristicAssocCell HeuristicsTable[]=
    {HEU_AUTO_SCHED5,    "AutoSched5", HCBAutoSched5Create},
    {HEU_AUTO_SCHED6,    "AutoSched6", HCBAutoSched6Create},
    {HEU_AUTO_SCHED7,    "AutoSched7", HCBAutoSched7Create},
+   {HEU_AUTO_TABLE,     "AutoTable",  HCBAutoTableCreate},
    {HEU_NO_HEURISTIC, NULL,           (HCBCreateFun)NULL}
 };
 
@@ -556,10 +557,42 @@ HCB_p HCBAutoSched7Create(HCBARGUMENTS)
 GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED7
 
+#undef CHE_HEURISTICS_INTERNAL
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: HCBAutoTableCreate()
+//
+//   Analyse the proof problem and return the heuristic selected by
+//   the auto table loaded into control.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations.
+//
+/----------------------------------------------------------------------*/
 
-#undef CHE_HEURISTICS_INTERNAL
+HCB_p HCBAutoTableCreate(HCBARGUMENTS)
+{
+   SpecFeature_p spec = &(control->problem_specs);
+   AutoCase_p    handle;
+
+   if(!control->auto_table)
+   {
+      Error("Heuristic AutoTable requires an auto table (--auto-table)",
+            USAGE_ERROR);
+   }
+   control->heuristic_parms.selection_strategy = SelectNoLiterals;
+   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
+   handle = AutoTableSelectCase(control->auto_table, spec);
+   AutoCaseApply(handle, &(control->heuristic_parms), ASHeuristicPart);
+
+   finalize_auto_parms("AutoTable-Mode", handle->heuristic, control,
+                       parms, spec);
+
+   return GetHeuristic(handle->heuristic, state, control, parms);
+}
 
 
 /*---------------------------------------------------------------------*/
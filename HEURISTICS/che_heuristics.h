@@ -48,7 +48,8 @@ typedef enum
    HEU_AUTO_SCHED4,
    HEU_AUTO_SCHED5,
    HEU_AUTO_SCHED6,
-   HEU_AUTO_SCHED7
+   HEU_AUTO_SCHED7,
+   HEU_AUTO_TABLE
 }Heuristic;
 
 typedef struct heuristic_assoc_cell
@@ -82,6 +83,8 @@ HCB_p HCBAutoSched5Create(HCBARGUMENTS);
 HCB_p HCBAutoSched6Create(HCBARGUMENTS);
 HCB_p HCBAutoSched7Create(HCBARGUMENTS);
 
+HCB_p HCBAutoTableCreate(HCBARGUMENTS);
+
 #endif
 
 /*---------------------------------------------------------------------*/
@@ -18,6 +18,10 @@ Changes
 
 <1> Mon Aug 30 20:31:22 MET DST 1999
     New
+<2> Tue Oct 20 03:12:48 CEST 2026
+    Cache TSM evaluations of clauses.
+<3> Wed Oct 21 11:40:07 CEST 2026
+    Key the cache by the pattern encoding.
 
 -----------------------------------------------------------------------*/
 
@@ -101,6 +105,71 @@ static TSMParam_p tsm_param_init(ClausePrioFun prio_fun, int fweight,
    return local;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: tsm_clause_factor()
+//
+//   Return the normalized TSM evaluation of clause. The TSM is
+//   built from the knowledge base on first use. Evaluations are
+//   cached in the TSM admin, keyed by the term encoding of the
+//   clause pattern (which determines the pattern substitution), so
+//   that the TSM traversal happens only once per distinct pattern.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, may build the TSM
+//
+/----------------------------------------------------------------------*/
+
+static double tsm_clause_factor(TSMParam_p local, Clause_p clause)
+{
+   Term_p   clauserep;
+   PStack_p listrep;
+   double   factor;
+
+   if(!local->tsmadmin)
+   {
+      local->tsmadmin = TSMFromKB(local->flat_clauses,
+              local->e_weights,
+              local->kb,
+              local->state->terms->sig,
+              local->state->axioms,
+              local->sel_no, local->set_part,
+              local->dist_part,
+              local->indextype, local->tsmtype,
+              local->depth);
+      local->pat_subst = PatternDefaultSubstAlloc(local->state->terms->sig);
+      /* TSMPrintRek(stdout, local->tsmadmin, local->tsmadmin->tsm,
+    0);*/
+   }
+
+   listrep = PStackAlloc();
+   PatternSubstBacktrack(local->pat_subst, 0); /* Make sure everything
+                                                  is at 0 */
+   if(PatternClauseCompute(clause, &(local->pat_subst), &listrep))
+   {
+      clauserep = local->flat_clauses?
+         FlatEncodeClauseListRep(local->state->terms, listrep):
+         RecEncodeClauseListRep(local->state->terms, listrep);
+      if(!TSMEvalCacheFind(local->tsmadmin, clauserep->entry_no, &factor))
+      {
+         factor = TSMEvalTerm(local->tsmadmin, clauserep,
+                              local->pat_subst);
+         TSMEvalCacheStore(local->tsmadmin, clauserep->entry_no, factor);
+      }
+   }
+   else
+   {
+      factor = local->tsmadmin->limit;
+   }
+   PStackFree(listrep);
+   factor = factor - local->eval_base;
+   factor = factor / local->eval_scale;
+
+   return factor;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -259,60 +328,9 @@ WFCB_p TSMWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state)
 double TSMWeightCompute(void* data, Clause_p clause)
 {
    TSMParam_p local = data;
-   Term_p clauserep;
-   PStack_p listrep;
-   double   factor, res;
+   double     factor, res;
 
-   if(!local->tsmadmin)
-   {
-      local->tsmadmin = TSMFromKB(local->flat_clauses,
-              local->e_weights,
-              local->kb,
-              local->state->terms->sig,
-              local->state->axioms,
-              local->sel_no, local->set_part,
-              local->dist_part,
-              local->indextype, local->tsmtype,
-              local->depth);
-      local->pat_subst = PatternDefaultSubstAlloc(local->state->terms->sig);
-      /* TSMPrintRek(stdout, local->tsmadmin, local->tsmadmin->tsm,
-    0);*/
-   }
-
-   listrep = PStackAlloc();
-   PatternSubstBacktrack(local->pat_subst, 0); /* Make sure everything
-                    is at 0 */
-   if(PatternClauseCompute(clause, &(local->pat_subst), &listrep))
-   {
-      clauserep = local->flat_clauses?
-    FlatEncodeClauseListRep(local->state->terms, listrep):
-    RecEncodeClauseListRep(local->state->terms, listrep);
-
-      factor = TSMEvalTerm(local->tsmadmin, clauserep,
-            local->pat_subst);
-
-      factor = factor - local->eval_base;
-      factor = factor / local->eval_scale;
-
-      /* printf("Factor: %f -- ", factor);
-      ClausePrint(stdout, clause, 1);
-      printf(" <=> ");
-      PatternTermPrint(stdout, local->pat_subst, clauserep,
-             local->state->terms->sig);
-             printf("\n");*/
-      /* TBDelete(local->state->terms, clauserep); */
-      /* factor = (factor == 1)?1:0; */
-   }
-   else
-   {
-      factor = local->tsmadmin->limit;
-      factor = factor - local->eval_base;
-      factor = factor / local->eval_scale;
-      /* printf("Default: %f -- ", factor);
-      ClausePrint(stdout, clause, 1);
-      printf("\n");*/
-   }
-   PStackFree(listrep);
+   factor = tsm_clause_factor(local, clause);
    res = ((local->learnweight*factor)+1)*
       ClauseWeight(clause, 1, 1, 1, local->vweight,
          local->fweight, false);
@@ -490,60 +508,9 @@ WFCB_p TSMRWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state)
 double TSMRWeightCompute(void* data, Clause_p clause)
 {
    TSMParam_p local = data;
-   Term_p clauserep;
-   PStack_p listrep;
-   double   factor, res;
-
-   if(!local->tsmadmin)
-   {
-      local->tsmadmin = TSMFromKB(local->flat_clauses,
-              local->e_weights,
-              local->kb,
-              local->state->terms->sig,
-              local->state->axioms,
-              local->sel_no, local->set_part,
-              local->dist_part,
-              local->indextype, local->tsmtype,
-              local->depth);
-      local->pat_subst = PatternDefaultSubstAlloc(local->state->terms->sig);
-      /* TSMPrintRek(stdout, local->tsmadmin, local->tsmadmin->tsm,
-    0);*/
-   }
+   double     factor, res;
 
-   listrep = PStackAlloc();
-   PatternSubstBacktrack(local->pat_subst, 0); /* Make sure everything
-                    is at 0 */
-   if(PatternClauseCompute(clause, &(local->pat_subst), &listrep))
-   {
-      clauserep = local->flat_clauses?
-    FlatEncodeClauseListRep(local->state->terms, listrep):
-    RecEncodeClauseListRep(local->state->terms, listrep);
-
-      factor = TSMEvalTerm(local->tsmadmin, clauserep,
-            local->pat_subst);
-
-      factor = factor - local->eval_base;
-      factor = factor / local->eval_scale;
-
-      /* printf("Factor: %f -- ", factor);
-      ClausePrint(stdout, clause, 1);
-      printf(" <=> ");
-      PatternTermPrint(stdout, local->pat_subst, clauserep,
-             local->state->terms->sig);
-             printf("\n");*/
-      /* TBDelete(local->state->terms, clauserep); */
-      /* factor = (factor == 1)?1:0; */
-   }
-   else
-   {
-      factor = local->tsmadmin->limit;
-      factor = factor - local->eval_base;
-      factor = factor / local->eval_scale;
-      /* printf("Default: %f -- ", factor);
-      ClausePrint(stdout, clause, 1);
-      printf("\n");*/
-   }
-   PStackFree(listrep);
+   factor = tsm_clause_factor(local, clause);
    res = ((local->learnweight*factor)+1)*
       ClauseWeight(clause, local->max_term_multiplier,
          local->max_literal_multiplier,
@@ -203,10 +203,14 @@ static long literal_weight_counter=0;
 
 /*-----------------------------------------------------------------------
 //
-// Function: find_maxlcomplex_literal()
+// Function: find_lcomplex_candidate()
 //
-//   Find a maximal negative literal to select (see
-//   SelectMaxLComplex() below.
+//   Find a negative literal with EqnIsMaximal() equal to maximal to
+//   select, with the following priority: The first pure variable
+//   literal, the first ground literal with largest
+//   lit_sel_diff_weight, the first literal with largest
+//   lit_sel_diff_weight. All three candidates are collected in a
+//   single traversal, with the weight computed once per literal.
 //
 // Global Variables: -
 //
@@ -214,65 +218,53 @@ static long literal_weight_counter=0;
 //
 /----------------------------------------------------------------------*/
 
-static Eqn_p find_maxlcomplex_literal(Clause_p clause)
+static Eqn_p find_lcomplex_candidate(Clause_p clause, bool maximal)
 {
-   Eqn_p handle = clause->literals, selected = NULL;
-   long select_weight, weight;
+   Eqn_p handle, ground_sel = NULL, any_sel = NULL;
+   long  ground_weight = -1, any_weight = -1, weight;
 
-   while(handle)
+   for(handle = clause->literals; handle; handle = handle->next)
    {
-      if(EqnIsNegative(handle)&&
-    EqnIsMaximal(handle) &&
-    TermIsVar(handle->lterm) &&
-    TermIsVar(handle->rterm))
+      if(!EqnIsNegative(handle) || (EqnIsMaximal(handle) != maximal))
       {
-    selected = handle;
-    break;
+         continue;
       }
-      handle = handle->next;
-   }
-   if(selected)
-   {
-      return selected;
-   }
-   select_weight = -1;
-   handle = clause->literals;
-
-   while(handle)
-   {
-      if(EqnIsNegative(handle) && EqnIsMaximal(handle)&&
-    EqnIsGround(handle))
+      if(EqnIsPureVar(handle))
       {
-    weight = lit_sel_diff_weight(handle);
-    if(weight > select_weight)
-    {
-       select_weight = weight;
-       selected = handle;
-         }
+         return handle;
       }
-      handle = handle->next;
-   }
-   if(selected)
-   {
-      return selected;
-   }
-   select_weight = -1;
-   handle = clause->literals;
-
-   while(handle)
-   {
-      if(EqnIsNegative(handle) && EqnIsMaximal(handle))
+      weight = lit_sel_diff_weight(handle);
+      if(weight > ground_weight && EqnIsGround(handle))
       {
-    weight = lit_sel_diff_weight(handle);
-    if(weight > select_weight)
-    {
-       select_weight = weight;
-       selected = handle;
-    }
+         ground_weight = weight;
+         ground_sel = handle;
+      }
+      if(weight > any_weight)
+      {
+         any_weight = weight;
+         any_sel = handle;
       }
-      handle = handle->next;
    }
-   return selected;
+   return ground_sel?ground_sel:any_sel;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: find_maxlcomplex_literal()
+//
+//   Find a maximal negative literal to select (see
+//   SelectMaxLComplex() below.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static Eqn_p find_maxlcomplex_literal(Clause_p clause)
+{
+   return find_lcomplex_candidate(clause, true);
 }
 
 
@@ -291,64 +283,7 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
 
 static Eqn_p find_lcomplex_literal(Clause_p clause)
 {
-   Eqn_p handle = clause->literals, selected = NULL;
-   long select_weight, weight;
-
-   while(handle)
-   {
-      if(EqnIsNegative(handle)&&
-    !EqnIsMaximal(handle) &&
-    TermIsVar(handle->lterm) &&
-    TermIsVar(handle->rterm))
-      {
-    selected = handle;
-    break;
-      }
-      handle = handle->next;
-   }
-   if(selected)
-   {
-      return selected;
-   }
-
-   select_weight = -1;
-   handle = clause->literals;
-
-   while(handle)
-   {
-      if(EqnIsNegative(handle)&&!EqnIsMaximal(handle)&&EqnIsGround(handle))
-      {
-    weight = lit_sel_diff_weight(handle);
-    if(weight > select_weight)
-    {
-       select_weight = weight;
-       selected = handle;
-    }
-      }
-      handle = handle->next;
-   }
-   if(selected)
-   {
-      return selected;
-   }
-
-   select_weight = -1;
-   handle = clause->literals;
-
-   while(handle)
-   {
-      if(EqnIsNegative(handle)&&!EqnIsMaximal(handle))
-      {
-    weight = lit_sel_diff_weight(handle);
-    if(weight > select_weight)
-    {
-       select_weight = weight;
-       selected = handle;
-    }
-      }
-      handle = handle->next;
-   }
-   return selected;
+   return find_lcomplex_candidate(clause, false);
 }
 
 
@@ -539,6 +474,33 @@ static void clause_select_pos(Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: lit_eval_features_compute()
+//
+//   Fill in the literal features of lit (see LitEvalCell). Term
+//   weights are looked up only once per side.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void lit_eval_features_compute(LitEval_p lit)
+{
+   Eqn_p eq = lit->literal;
+   long  lweight = TermStandardWeight(eq->lterm);
+   long  rweight = TermStandardWeight(eq->rterm);
+
+   lit->ground      = EqnIsGround(eq);
+   lit->pure_var    = EqnIsPureVar(eq);
+   lit->std_weight  = lweight+rweight;
+   lit->diff_weight = 100*(MAX(lweight,rweight)-MIN(lweight,rweight))
+      +lit->std_weight;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: lit_eval_compare()
@@ -584,7 +546,10 @@ int lit_eval_compare(const void* le1, const void* le2)
 //
 //   Function implementing generic weight-based selection for cases
 //   where at most one negative literal is selected (the one which is
-//   assigned minimal weight by weight_fun).
+//   assigned minimal weight by weight_fun). The literal features are
+//   computed once for each literal and stored in a single array of
+//   LitEvalCells, weight functions should use them instead of
+//   re-examining the literal.
 //
 // Global Variables: -
 //
@@ -617,7 +582,7 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
       lits[i].literal = handle;
       tmp = &(lits[i]);
       LitEvalInit(tmp);
-      assert(clause);
+      lit_eval_features_compute(tmp);
       weight_fun(tmp, clause, data);
    }
    cand = 0;
@@ -1317,15 +1282,16 @@ void MSelectSmallestOrientableLiteral(OCB_p ocb, Clause_p clause)
 void SelectDiffNegativeLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
       if(EqnIsNegative(handle))
       {
-         if(lit_sel_diff_weight(handle) > select_weight)
+         weight = lit_sel_diff_weight(handle);
+         if(weight > select_weight)
          {
-            select_weight = lit_sel_diff_weight(handle);
+            select_weight = weight;
             selected = handle;
          }
       }
@@ -1352,7 +1318,7 @@ void SelectDiffNegativeLiteral(OCB_p ocb, Clause_p clause)
 void PSelectDiffNegativeLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
@@ -1362,9 +1328,10 @@ void PSelectDiffNegativeLiteral(OCB_p ocb, Clause_p clause)
       }
       else
       {
-         if(lit_sel_diff_weight(handle) > select_weight)
+         weight = lit_sel_diff_weight(handle);
+         if(weight > select_weight)
          {
-            select_weight = lit_sel_diff_weight(handle);
+            select_weight = weight;
             selected = handle;
          }
       }
@@ -1391,15 +1358,16 @@ void PSelectDiffNegativeLiteral(OCB_p ocb, Clause_p clause)
 void SelectGroundNegativeLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
       if(EqnIsNegative(handle) && EqnIsGround(handle))
       {
-         if(lit_sel_diff_weight(handle) > select_weight)
+         weight = lit_sel_diff_weight(handle);
+         if(weight > select_weight)
          {
-            select_weight = lit_sel_diff_weight(handle);
+            select_weight = weight;
             selected = handle;
          }
       }
@@ -1428,7 +1396,7 @@ void SelectGroundNegativeLiteral(OCB_p ocb, Clause_p clause)
 void PSelectGroundNegativeLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
@@ -1436,9 +1404,10 @@ void PSelectGroundNegativeLiteral(OCB_p ocb, Clause_p clause)
       {
          if(EqnIsGround(handle))
          {
-            if(lit_sel_diff_weight(handle) > select_weight)
+            weight = lit_sel_diff_weight(handle);
+            if(weight > select_weight)
             {
-               select_weight = lit_sel_diff_weight(handle);
+               select_weight = weight;
                selected = handle;
             }
          }
@@ -1478,15 +1447,16 @@ void PSelectGroundNegativeLiteral(OCB_p ocb, Clause_p clause)
 void SelectOptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
       if(EqnIsNegative(handle) && EqnIsGround(handle))
       {
-         if(lit_sel_diff_weight(handle) > select_weight)
+         weight = lit_sel_diff_weight(handle);
+         if(weight > select_weight)
          {
-            select_weight = lit_sel_diff_weight(handle);
+            select_weight = weight;
             selected = handle;
          }
       }
@@ -1521,15 +1491,16 @@ void SelectOptimalLiteral(OCB_p ocb, Clause_p clause)
 void PSelectOptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
-   long  select_weight = -1;
+   long  select_weight = -1, weight;
 
    while(handle)
    {
       if(EqnIsNegative(handle) && EqnIsGround(handle))
       {
-         if(lit_sel_diff_weight(handle) > select_weight)
+         weight = lit_sel_diff_weight(handle);
+         if(weight > select_weight)
          {
-            select_weight = lit_sel_diff_weight(handle);
+            select_weight = weight;
             selected = handle;
          }
       }
@@ -4510,15 +4481,15 @@ static void maxlcomplex_weight(LitEval_p lit, Clause_p clause, void *dummy)
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -lit->diff_weight;
       lit->w3 = literal_weight_counter % clause->neg_lit_no;
    }
    literal_weight_counter++;
@@ -4589,15 +4560,15 @@ static void maxlcomplexavoidpred_weight(LitEval_p lit, Clause_p clause,
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -lit->diff_weight;
       if(EqnIsEquLit(lit->literal))
       {
          lit->w3 = PDArrayElementInt(pd, 0);
@@ -4689,15 +4660,15 @@ static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
             lit->w1=100;
          }
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -lit->diff_weight;
       if(EqnIsEquLit(lit->literal))
       {
          lit->w3 = PDArrayElementInt(pd, 0);
@@ -4877,19 +4848,19 @@ static void complex_weight(LitEval_p lit, Clause_p clause,
 {
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(lit->pure_var)
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = lit->std_weight;
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -lit->diff_weight;
       }
    }
 }
@@ -4938,19 +4909,19 @@ static void complex_weight_ahp(LitEval_p lit, Clause_p clause,
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(lit->pure_var)
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = lit->std_weight;
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -lit->diff_weight;
       }
    }
    lit->w3 = 0;
@@ -5045,7 +5016,7 @@ static void new_complex_notp_ahp(LitEval_p lit, Clause_p clause,
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsGround(lit->literal))
+      if(lit->ground)
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
@@ -5312,7 +5283,7 @@ static void new_complex_notp_ahp_ns(LitEval_p lit, Clause_p clause,
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
@@ -5464,7 +5435,7 @@ static void select_cq_ar_eql_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArEqLast(OCB_p ocb, Clause_p clause)
@@ -5509,7 +5480,7 @@ static void select_cq_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArEqFirst(OCB_p ocb, Clause_p clause)
@@ -5553,7 +5524,7 @@ static void select_cq_iar_eql_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArEqLast(OCB_p ocb, Clause_p clause)
@@ -5598,7 +5569,7 @@ static void select_cq_iar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArEqFirst(OCB_p ocb, Clause_p clause)
@@ -5647,7 +5618,7 @@ static void select_cq_ar_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQAr(OCB_p ocb, Clause_p clause)
@@ -5695,7 +5666,7 @@ static void select_cq_iar_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 
@@ -5746,7 +5717,7 @@ static void select_cq_arnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 
@@ -5798,7 +5769,7 @@ static void select_cq_iarnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -5843,8 +5814,8 @@ static void select_grcq_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
-   if(EqnIsGround(l))
+   lit->w3 = lit->diff_weight;
+   if(lit->ground)
    {
       lit->w1 -= 2000000;
    }
@@ -5893,8 +5864,8 @@ static void select_cqgr_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
-   if(EqnIsGround(l))
+   lit->w3 = lit->diff_weight;
+   if(lit->ground)
    {
       lit->w2 -= 2000000;
    }
@@ -5947,7 +5918,7 @@ static void select_cq_arnt_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNTEqFirst(OCB_p ocb, Clause_p clause)
@@ -5997,7 +5968,7 @@ static void select_cq_iarnt_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6048,7 +6019,7 @@ static void select_cq_arntnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNTNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -6099,7 +6070,7 @@ static void select_cq_iarntnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNTNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -6149,7 +6120,7 @@ static void select_cq_arnxt_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNXTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6200,7 +6171,7 @@ static void select_cq_iarnxt_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNXTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6252,7 +6223,7 @@ static void select_cq_arntnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNTNp(OCB_p ocb, Clause_p clause)
@@ -6303,7 +6274,7 @@ static void select_cq_iarntnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNTNp(OCB_p ocb, Clause_p clause)
@@ -6353,7 +6324,7 @@ static void select_cq_arnt_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNT(OCB_p ocb, Clause_p clause)
@@ -6403,7 +6374,7 @@ static void select_cq_iarnt_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNT(OCB_p ocb, Clause_p clause)
@@ -6453,7 +6424,7 @@ static void select_cq_arnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQArNp(OCB_p ocb, Clause_p clause)
@@ -6504,7 +6475,7 @@ static void select_cq_iarnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIArNp(OCB_p ocb, Clause_p clause)
@@ -6669,7 +6640,7 @@ static void select_cq_precw_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = OCBFunPrecWeight(ocb, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQPrecW(OCB_p ocb, Clause_p clause)
@@ -6715,7 +6686,7 @@ static void select_cq_iprecw_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -OCBFunPrecWeight(ocb, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIPrecW(OCB_p ocb, Clause_p clause)
@@ -6770,7 +6741,7 @@ static void select_cq_precwntnp_weight(LitEval_p lit, Clause_p clause,
          lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQPrecWNTNp(OCB_p ocb, Clause_p clause)
@@ -6825,7 +6796,7 @@ static void select_cq_iprecwntnp_weight(LitEval_p lit, Clause_p clause,
          lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 = lit->diff_weight;
 }
 
 void SelectCQIPrecWNTNp(OCB_p ocb, Clause_p clause)
@@ -49,6 +49,13 @@ typedef struct lit_eval_cell
    int   w1; /* Lexicographically compared weights */
    int   w2;
    int   w3;
+   /* Literal features, computed once before the weight function is
+      called, so that weight functions need not traverse the literal
+      again. */
+   bool  ground;
+   bool  pure_var;
+   long  std_weight;  /* EqnStandardWeight() */
+   long  diff_weight; /* 100*EqnStandardDiff()+EqnStandardWeight() */
 }LitEvalCell, *LitEval_p;
 
 typedef void LitWeightFun(LitEval_p, Clause_p, void*);
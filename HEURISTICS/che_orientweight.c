@@ -64,6 +64,7 @@ WFCB_p ClauseOrientWeightInit(ClausePrioFun prio_fun, int fweight,
                 pos_multiplier)
 {
    OrientWeightParam_p data = OrientWeightParamCellAlloc();
+   WFCB_p              res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -72,8 +73,10 @@ WFCB_p ClauseOrientWeightInit(ClausePrioFun prio_fun, int fweight,
    data->max_literal_multiplier = max_literal_multiplier;
    data->ocb                    = ocb;
 
-   return WFCBAlloc(ClauseOrientWeightCompute, prio_fun,
-          ClauseOrientWeightExit, data);
+   res = WFCBAlloc(ClauseOrientWeightCompute, prio_fun,
+                   ClauseOrientWeightExit, data);
+   WFCBSetProfileEval(res, ClauseOrientWeightProfileCompute, ocb, false);
+   return res;
 }
 
 
@@ -144,6 +147,32 @@ double ClauseOrientWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseOrientWeightProfileCompute()
+//
+//   As ClauseOrientWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseOrientWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   OrientWeightParam_p local = data;
+
+   return ClauseProfileOrientWeight(profile,
+                                    local->unorientable_literal_multiplier,
+                                    local->max_literal_multiplier,
+                                    local->pos_multiplier,
+                                    local->vweight,
+                                    local->fweight,
+                                    false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: OrientLMaxWeightInit()
@@ -163,6 +192,7 @@ WFCB_p OrientLMaxWeightInit(ClausePrioFun prio_fun, int fweight,
                 pos_multiplier)
 {
    OrientWeightParam_p data = OrientWeightParamCellAlloc();
+   WFCB_p              res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -171,8 +201,10 @@ WFCB_p OrientLMaxWeightInit(ClausePrioFun prio_fun, int fweight,
    data->max_literal_multiplier = max_literal_multiplier;
    data->ocb                    = ocb;
 
-   return WFCBAlloc(OrientLMaxWeightCompute, prio_fun,
-          ClauseOrientWeightExit, data);
+   res = WFCBAlloc(OrientLMaxWeightCompute, prio_fun,
+                   ClauseOrientWeightExit, data);
+   WFCBSetProfileEval(res, OrientLMaxWeightProfileCompute, ocb, false);
+   return res;
 }
 
 
@@ -256,6 +288,47 @@ double OrientLMaxWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: OrientLMaxWeightProfileCompute()
+//
+//   As OrientLMaxWeightCompute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double OrientLMaxWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   OrientWeightParam_p local = data;
+   double              res = 0, tmp;
+   LitProfile_p        lp;
+   long                i;
+
+   for(i=0; i<profile->lit_no; i++)
+   {
+      lp = &(profile->lits[i]);
+      tmp = LitProfileMaxWeight(lp, local->vweight, local->fweight);
+      if(EqnIsPositive(lp->lit))
+      {
+         tmp = tmp*local->pos_multiplier;
+      }
+      if(EqnIsMaximal(lp->lit))
+      {
+         tmp = tmp*local->max_literal_multiplier;
+      }
+      if(!EqnIsOriented(lp->lit))
+      {
+         tmp = tmp*local->unorientable_literal_multiplier;
+      }
+      res += tmp;
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseOrientWeightExit()
@@ -65,6 +65,7 @@ WFCB_p ClauseOrientWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseOrientWeightCompute(void* data, Clause_p clause);
+double ClauseOrientWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 WFCB_p OrientLMaxWeightInit(ClausePrioFun prio_fun, int fweight,
              int vweight, OCB_p ocb, double
@@ -76,6 +77,7 @@ WFCB_p OrientLMaxWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
               state);
 
 double OrientLMaxWeightCompute(void* data, Clause_p clause);
+double OrientLMaxWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 void   ClauseOrientWeightExit(void* data);
 
@@ -146,6 +146,29 @@ ClausePrioFun GetPrioFun(char* name)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: PrioFunIsStateDependent()
+//
+//   Return true if the priority assigned by fun may change while a
+//   clause is waiting in the unprocessed set, i.e. if it depends on
+//   properties that are changed by the proof procedure.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool PrioFunIsStateDependent(ClausePrioFun fun)
+{
+   return (fun == PrioFunPreferProcessed) ||
+      (fun == PrioFunPreferNew) ||
+      (fun == PrioFunPreferWatchlist) ||
+      (fun == PrioFunDeferWatchlist);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ParsePrioFun()
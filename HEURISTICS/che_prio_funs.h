@@ -42,6 +42,7 @@ typedef EvalPriority (*ClausePrioFun)(Clause_p clause);
 extern char* PrioFunNames[];
 
 ClausePrioFun GetPrioFun(char* name);
+bool          PrioFunIsStateDependent(ClausePrioFun fun);
 ClausePrioFun ParsePrioFun(Scanner_p in);
 
 EvalPriority PrioFunPreferGroundGoals(Clause_p clause);
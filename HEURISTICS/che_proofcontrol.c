@@ -181,7 +181,9 @@ ProofControl_p ProofControlAlloc(void)
    handle->wfcbs                         = WFCBAdminAlloc();
    handle->hcbs                          = HCBAdminAlloc();
    handle->hcb                           = NULL;
+   handle->auto_table                    = NULL;
    handle->ac_handling_active            = false;
+   handle->satcheck                      = NULL;
    HeuristicParmsInitialize(&handle->heuristic_parms);
 
    return handle;
@@ -209,6 +211,14 @@ void ProofControlFree(ProofControl_p junk)
    }
    WFCBAdminFree(junk->wfcbs);
    HCBAdminFree(junk->hcbs);
+   if(junk->auto_table)
+   {
+      AutoTableFree(junk->auto_table);
+   }
+   if(junk->satcheck)
+   {
+      SatCheckFree(junk->satcheck);
+   }
    /* hcb is always freed in junk->hcbs */
    ProofControlCellFree(junk);
 }
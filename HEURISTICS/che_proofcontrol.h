@@ -30,6 +30,8 @@ Changes
 #include <che_hcbadmin.h>
 #include <che_to_weightgen.h>
 #include <che_to_precgen.h>
+#include <che_autotable.h>
+#include <cpr_satcheck.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -42,10 +44,13 @@ typedef struct proofcontrolcell
    HCB_p               hcb;
    WFCBAdmin_p         wfcbs;
    HCBAdmin_p          hcbs;
+   AutoTable_p         auto_table;
    bool                ac_handling_active;
    HeuristicParmsCell  heuristic_parms;
    FVIndexParmsCell    fvi_parms;
    SpecFeatureCell     problem_specs;
+   SatCheck_p          satcheck;  /* Ground abstraction of the
+                                     processed clauses, if enabled */
 }ProofControlCell, *ProofControl_p;
 
 #define HCBARGUMENTS ProofState_p state, ProofControl_p control, \
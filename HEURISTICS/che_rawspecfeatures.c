@@ -39,6 +39,129 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_set_add_raw_features()
+//
+//   Add the standard weight and the conjecture and hypothesis counts
+//   of the clauses in set to features in a single pass.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void clause_set_add_raw_features(RawSpecFeature_p features,
+                                        ClauseSet_p set)
+{
+   Clause_p handle;
+
+   features->sentence_no += ClauseSetCardinality(set);
+   for(handle = set->anchor->succ;
+       handle != set->anchor;
+       handle = handle->succ)
+   {
+      features->term_size += ClauseStandardWeight(handle);
+      if(ClauseIsConjecture(handle))
+      {
+         features->conjecture_count++;
+      }
+      if(ClauseIsHypothesis(handle))
+      {
+         features->hypothesis_count++;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: formula_set_add_raw_features()
+//
+//   Add the standard weight and the conjecture and hypothesis counts
+//   of the formulas in set to features in a single pass.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void formula_set_add_raw_features(RawSpecFeature_p features,
+                                         FormulaSet_p set)
+{
+   WFormula_p handle;
+
+   features->sentence_no += FormulaSetCardinality(set);
+   for(handle = set->anchor->succ;
+       handle != set->anchor;
+       handle = handle->succ)
+   {
+      features->term_size += WFormulaStandardWeight(handle);
+      if(FormulaIsConjecture(handle))
+      {
+         features->conjecture_count++;
+      }
+      if(FormulaIsHypothesis(handle))
+      {
+         features->hypothesis_count++;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sig_add_raw_features()
+//
+//   Compute the signature features in a single pass over the
+//   signature. Symbol counts are as in SigCountSymbols(), constant
+//   counts as in SigCountAritySymbols().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void sig_add_raw_features(RawSpecFeature_p features, Sig_p sig)
+{
+   FunCode i;
+   int     preds = 0, funs = 0;
+
+   features->predc_size = 0;
+   features->func_size  = 0;
+   for(i=sig->internal_symbols+1; i<=sig->f_count; i++)
+   {
+      if(SigIsSpecial(sig,i))
+      {
+         continue;
+      }
+      if(SigIsPredicate(sig, i))
+      {
+         preds++;
+         if(SigFindArity(sig,i)==0)
+         {
+            features->predc_size++;
+         }
+      }
+      else
+      {
+         if(SigIsFunction(sig, i))
+         {
+            funs++;
+         }
+         if(SigFindArity(sig,i)==0)
+         {
+            features->func_size++;
+         }
+      }
+   }
+   features->sig_size  = preds+funs;
+   features->pred_size = preds-features->predc_size;
+   features->fun_size  = funs-features->func_size;
+}
 
 
 /*---------------------------------------------------------------------*/
@@ -49,7 +172,8 @@ Changes
 //
 // Function: RawSpecFeaturesCompute()
 //
-//   Compute the raw features of state.
+//   Compute the raw features of state, with one pass over each of
+//   the clauses, the formulas and the signature.
 //
 // Global Variables: -
 //
@@ -59,29 +183,14 @@ Changes
 
 void RawSpecFeaturesCompute(RawSpecFeature_p features, ProofState_p state)
 {
-   features->sentence_no = ClauseSetCardinality(state->axioms)+
-      ClauseSetCardinality(state->f_axioms);
-   features->term_size   = ClauseSetStandardWeight(state->axioms)+
-      FormulaSetStandardWeight(state->f_axioms);
+   features->sentence_no      = 0;
+   features->term_size        = 0;
    features->hypothesis_count = 0;
    features->conjecture_count = 0;
-   features->conjecture_count +=
-      ClauseSetCountConjectures(state->axioms,
-                                &(features->hypothesis_count));
-   features->conjecture_count +=
-      FormulaSetCountConjectures(state->f_axioms,
-                                 &(features->hypothesis_count));
-
-   features->sig_size    = SigCountSymbols(state->terms->sig, true)+
-      SigCountSymbols(state->terms->sig,false);
-
-   features->predc_size = SigCountAritySymbols(state->terms->sig, 0, true);
-   features->func_size  = SigCountAritySymbols(state->terms->sig, 0, false);
-   features->pred_size = SigCountSymbols(state->terms->sig, true)-
-      SigCountAritySymbols(state->terms->sig, 0, true);
-   features->fun_size  = SigCountSymbols(state->terms->sig, false)-
-      SigCountAritySymbols(state->terms->sig, 0, false);
 
+   clause_set_add_raw_features(features, state->axioms);
+   formula_set_add_raw_features(features, state->f_axioms);
+   sig_add_raw_features(features, state->terms->sig);
 
    features->class[0] = '\0';
 }
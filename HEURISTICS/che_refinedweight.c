@@ -64,6 +64,7 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
                 pos_multiplier)
 {
    RefinedWeightParam_p data = RefinedWeightParamCellAlloc();
+   WFCB_p               res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -72,8 +73,10 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
    data->max_literal_multiplier = max_literal_multiplier;
    data->ocb                    = ocb;
 
-   return WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
-          ClauseRefinedWeightExit, data);
+   res = WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
+                   ClauseRefinedWeightExit, data);
+   WFCBSetProfileEval(res, ClauseRefinedWeightProfileCompute, ocb, false);
+   return res;
 }
 
 
@@ -145,6 +148,33 @@ double ClauseRefinedWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeightProfileCompute()
+//
+//   As ClauseRefinedWeightCompute(), but work on a clause profile
+//   (maximal terms are marked by the caller).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseRefinedWeightProfileCompute(void* data, ClauseProfile_p profile)
+{
+   RefinedWeightParam_p local = data;
+
+   return ClauseProfileWeight(profile,
+                              local->max_term_multiplier,
+                              local->max_literal_multiplier,
+                              local->pos_multiplier,
+                              local->vweight,
+                              local->fweight,
+                              false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeight2Parse()
@@ -164,6 +194,7 @@ WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
 
    tmp = ClauseRefinedWeightParse(in, ocb, state);
    tmp->wfcb_eval = ClauseRefinedWeight2Compute;
+   tmp->wfcb_profile_eval = ClauseRefinedWeight2ProfileCompute;
 
    return tmp;
 }
@@ -195,6 +226,32 @@ double ClauseRefinedWeight2Compute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeight2ProfileCompute()
+//
+//   As ClauseRefinedWeight2Compute(), but work on a clause profile.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseRefinedWeight2ProfileCompute(void* data, ClauseProfile_p profile)
+{
+   RefinedWeightParam_p local = data;
+
+   return ClauseProfileWeight(profile,
+                              local->max_term_multiplier,
+                              local->max_literal_multiplier,
+                              local->pos_multiplier,
+                              local->vweight,
+                              local->fweight,
+                              true);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeightExit()
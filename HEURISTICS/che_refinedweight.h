@@ -65,11 +65,13 @@ WFCB_p ClauseRefinedWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeightCompute(void* data, Clause_p clause);
+double ClauseRefinedWeightProfileCompute(void* data, ClauseProfile_p profile);
 
 WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeight2Compute(void* data, Clause_p clause);
+double ClauseRefinedWeight2ProfileCompute(void* data, ClauseProfile_p profile);
 
 void   ClauseRefinedWeightExit(void* data);
 
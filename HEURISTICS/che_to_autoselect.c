@@ -466,6 +466,42 @@ GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED67
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: generate_table_ordering()
+//
+//   Generate a term ordering for the problem using the ordering
+//   settings of the matching case of an auto table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, calls SpecFeaturesAddEval()
+//                   and changes cheap parts of specs.
+//
+/----------------------------------------------------------------------*/
+
+OCB_p generate_table_ordering(ProofState_p state, SpecFeature_p spec,
+                              AutoTable_p table)
+{
+   OrderParmsCell     oparms;
+   HeuristicParmsCell tmp;
+
+   if(!table)
+   {
+      Error("Term ordering AutoTable requires an auto table "
+            "(--auto-table)", USAGE_ERROR);
+   }
+   init_oparms(&oparms);
+   OUTPRINT(1, "\n# Auto-Ordering is analysing problem.\n");
+   HeuristicParmsInitialize(&tmp);
+   HeuristicParmsUpdate(&oparms, &tmp);
+   AutoCaseApply(AutoTableSelectCase(table, spec), &tmp, ASOrderingPart);
+   OrderParmsInitialize(&tmp, &oparms);
+   print_oparms(&oparms);
+   return TOCreateOrdering(state, &oparms, NULL, NULL);
+}
+
+
 
 
 /*---------------------------------------------------------------------*/
@@ -817,7 +853,8 @@ OCB_p OrderFindOptimal(OrderParms_p mask, OrderEvaluationFun eval_fun,
 // Function: TOSelectOrdering()
 //
 //   Given a proof state, select a (hopefully suitable) ordering for
-//   it and return the corresponding OCB.
+//   it and return the corresponding OCB. table is the auto table (if
+//   any) for ordering type AUTOTABLE.
 //
 // Global Variables: -
 //
@@ -826,7 +863,7 @@ OCB_p OrderFindOptimal(OrderParms_p mask, OrderEvaluationFun eval_fun,
 /----------------------------------------------------------------------*/
 
 OCB_p TOSelectOrdering(ProofState_p state, HeuristicParms_p params,
-             SpecFeature_p specs)
+             SpecFeature_p specs, AutoTable_p table)
 {
    OrderParmsCell tmp;
    OCB_p          result;
@@ -883,6 +920,10 @@ OCB_p TOSelectOrdering(ProofState_p state, HeuristicParms_p params,
    {
       result = generate_autosched7_ordering(state, specs);
    }
+   else if(tmp.ordertype == AUTOTABLE)
+   {
+      result = generate_table_ordering(state, specs, table);
+   }
    else
    {
       if(tmp.ordertype == NoOrdering)
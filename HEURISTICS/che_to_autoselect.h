@@ -82,7 +82,7 @@ OCB_p  OrderFindOptimal(OrderParms_p mask, OrderEvaluationFun
          params);
 
 OCB_p  TOSelectOrdering(ProofState_p state, HeuristicParms_p params,
-         SpecFeature_p specs);
+         SpecFeature_p specs, AutoTable_p table);
 OCB_p  TOCreateOrdering(ProofState_p state, OrderParms_p params, char*
          pre_precedence, char* pre_weights);
 
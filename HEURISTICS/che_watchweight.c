@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------
+
+File  : che_watchweight.c
+
+Author: Stephan Schulz
+
+Contents
+
+  WatchProgressWeight: The standard clause weight, divided by
+  (1 + progress_factor * gain), where gain is the largest
+  improvement of the progress of a watchlist clause that processing
+  the clause would achieve (see ccl_watchindex.c). Without a
+  watchlist, this is just Clauseweight.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 02:31:05 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_watchweight.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchProgressWeightInit()
+//
+//   Return an initialized WFCB for WatchProgressWeight
+//   evaluation. The watchlist is taken from state at evaluation time.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+WFCB_p WatchProgressWeightInit(ClausePrioFun prio_fun, ProofState_p state,
+                               int fweight, int vweight,
+                               double pos_multiplier,
+                               double progress_factor)
+{
+   WatchWeightParam_p data = WatchWeightParamCellAlloc();
+
+   data->state           = state;
+   data->fweight         = fweight;
+   data->vweight         = vweight;
+   data->pos_multiplier  = pos_multiplier;
+   data->progress_factor = progress_factor;
+
+   return WFCBAlloc(WatchProgressWeightCompute, prio_fun,
+                    WatchProgressWeightExit, data);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchProgressWeightParse()
+//
+//   Parse a WatchProgressWeight-definition of the form
+//   (prio, fweight, vweight, pos_mult, progress_factor).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, Input
+//
+/----------------------------------------------------------------------*/
+
+WFCB_p WatchProgressWeightParse(Scanner_p in, OCB_p ocb,
+                                ProofState_p state)
+{
+   ClausePrioFun prio_fun;
+   int fweight, vweight;
+   double pos_multiplier, progress_factor;
+
+   AcceptInpTok(in, OpenBracket);
+   prio_fun = ParsePrioFun(in);
+   AcceptInpTok(in, Comma);
+   fweight = ParseInt(in);
+   AcceptInpTok(in, Comma);
+   vweight = ParseInt(in);
+   AcceptInpTok(in, Comma);
+   pos_multiplier = ParseFloat(in);
+   AcceptInpTok(in, Comma);
+   progress_factor = ParseFloat(in);
+   AcceptInpTok(in, CloseBracket);
+
+   return WatchProgressWeightInit(prio_fun, state, fweight, vweight,
+                                  pos_multiplier, progress_factor);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchProgressWeightCompute()
+//
+//   Compute an evaluation for a clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double WatchProgressWeightCompute(void* data, Clause_p clause)
+{
+   WatchWeightParam_p local = data;
+   ClauseSet_p        watchlist = local->state->watchlist;
+   double             res, gain = 0.0;
+
+   res = ClauseWeight(clause, 1, 1,
+                      local->pos_multiplier,
+                      local->vweight,
+                      local->fweight,
+                      false);
+   if(watchlist && watchlist->watch_index)
+   {
+      gain = WatchIndexProgressGain(watchlist->watch_index, clause);
+   }
+   return res/(1.0+local->progress_factor*gain);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchProgressWeightExit()
+//
+//   Free the data entry in a WatchProgressWeight WFCB.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void WatchProgressWeightExit(void* data)
+{
+   WatchWeightParamCellFree(data);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
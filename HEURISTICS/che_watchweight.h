@@ -0,0 +1,70 @@
+/*-----------------------------------------------------------------------
+
+File  : che_watchweight.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Clause weights discounted by the progress a clause would make on
+  partially matched watchlist clauses.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 02:31:05 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_WATCHWEIGHT
+
+#define CHE_WATCHWEIGHT
+
+#include <che_clauseweight.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct watchweightparamcell
+{
+   ProofState_p state;
+   double       pos_multiplier;
+   long         vweight;
+   long         fweight;
+   double       progress_factor;
+}WatchWeightParamCell, *WatchWeightParam_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define WatchWeightParamCellAlloc() (WatchWeightParamCell*) \
+        SizeMalloc(sizeof(WatchWeightParamCell))
+#define WatchWeightParamCellFree(junk) \
+        SizeFree(junk, sizeof(WatchWeightParamCell))
+
+WFCB_p WatchProgressWeightInit(ClausePrioFun prio_fun, ProofState_p state,
+                               int fweight, int vweight,
+                               double pos_multiplier,
+                               double progress_factor);
+
+WFCB_p WatchProgressWeightParse(Scanner_p in, OCB_p ocb,
+                                ProofState_p state);
+
+double WatchProgressWeightCompute(void* data, Clause_p clause);
+
+void   WatchProgressWeightExit(void* data);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
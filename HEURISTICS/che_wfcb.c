@@ -66,6 +66,10 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
    handle->wfcb_priority = prio_fun;
    handle->wfcb_exit = wfcb_exit;
    handle->data = data;
+   handle->wfcb_profile_eval = NULL;
+   handle->wfcb_profile_ocb = NULL;
+   handle->wfcb_profile_fcodes = false;
+   handle->wfcb_state_dependent = true;
 
    return handle;
 }
@@ -95,6 +99,30 @@ void WFCBFree(WFCB_p junk)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: WFCBSetProfileEval()
+//
+//   Register a profile-based evaluation function with the WFCB. If
+//   ocb is non-NULL, maximal terms and literals of the clause are
+//   marked with it before the profile is computed. If needs_fcodes is
+//   true, the profile includes the function symbol occurrences.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes wfcb
+//
+/----------------------------------------------------------------------*/
+
+void WFCBSetProfileEval(WFCB_p wfcb, ClauseProfileEvalFun profile_eval,
+                        OCB_p ocb, bool needs_fcodes)
+{
+   wfcb->wfcb_profile_eval   = profile_eval;
+   wfcb->wfcb_profile_ocb    = ocb;
+   wfcb->wfcb_profile_fcodes = needs_fcodes;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseAddEvaluation()
@@ -120,6 +148,39 @@ void ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty)
    }
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseAddProfileEvaluation()
+//
+//   As ClauseAddEvaluation(), but use the profile evaluation function
+//   of wfcb on the (already computed) profile of the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Adds evaluation
+//
+/----------------------------------------------------------------------*/
+
+void ClauseAddProfileEvaluation(WFCB_p wfcb, ClauseProfile_p profile,
+                                int pos, bool empty)
+{
+   Clause_p clause = profile->clause;
+
+   assert(clause->evaluations);
+   assert(wfcb->wfcb_profile_eval);
+   clause->evaluations->evals[pos].heuristic =
+      wfcb->wfcb_profile_eval(wfcb->data, profile);
+   if(empty)
+   {
+      clause->evaluations->evals[pos].priority = PrioBest;
+   }
+   else
+   {
+      clause->evaluations->evals[pos].priority  = wfcb->wfcb_priority(clause);
+   }
+}
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
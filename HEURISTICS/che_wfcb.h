@@ -37,6 +37,21 @@ Contents
      This function is responsible for freeing data, before the WFCB is
      deleted.
 
+  Optionally, an evaluation function can also register
+
+     double <eval>ProfileCompute(void *data, ClauseProfile_p profile)
+
+     via WFCBSetProfileEval(). It has to return exactly the same
+     value as <eval>Compute(), but works from a clause profile that
+     is computed once and shared by all such functions of a
+     heuristic (see che_clauseprofile.h).
+
+  WFCBs are conservatively assumed to be state-dependent, i.e. the
+  evaluation of an unchanged clause may change over time. Weight
+  functions whose value only depends on the clause (and data fixed at
+  initialization) are marked via wfcb_state_dependent = false, so that
+  reweighting can skip their queues.
+
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -58,6 +73,7 @@ Changes
 #include <cio_output.h>
 #include <ccl_proofstate.h>
 #include <che_prio_funs.h>
+#include <che_clauseprofile.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -69,6 +85,9 @@ Changes
 typedef double (*ClauseEvalFun)(void* data, Clause_p
             clause);
 
+typedef double (*ClauseProfileEvalFun)(void* data, ClauseProfile_p
+                                       profile);
+
 typedef struct wfcb_cell
 {
    ClauseEvalFun     wfcb_eval;     /* Compute a clauses evaluation */
@@ -78,6 +97,15 @@ typedef struct wfcb_cell
    void*             data;          /* WFCB-Data...each set of
                    evaluation functions is
                    responsible for cleaning up...*/
+   ClauseProfileEvalFun wfcb_profile_eval; /* Optional, compute the
+                   same evaluation from a shared clause profile */
+   OCB_p             wfcb_profile_ocb; /* Ordering the profile
+                   evaluation needs maximal terms marked with */
+   bool              wfcb_profile_fcodes; /* Profile evaluation needs
+                   function symbol occurrences */
+   bool              wfcb_state_dependent; /* Evaluation of a clause
+                   may change while it is unprocessed, so the
+                   queue needs reweighting */
 }WFCBCell, *WFCB_p;
 
 typedef WFCB_p (*WeightFunParseFun)(Scanner_p in, OCB_p ocb,
@@ -94,8 +122,12 @@ typedef WFCB_p (*WeightFunParseFun)(Scanner_p in, OCB_p ocb,
 WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
        GenericExitFun wfcb_exit, void* data);
 void   WFCBFree(WFCB_p junk);
+void   WFCBSetProfileEval(WFCB_p wfcb, ClauseProfileEvalFun profile_eval,
+                          OCB_p ocb, bool needs_fcodes);
 
 void   ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty);
+void   ClauseAddProfileEvaluation(WFCB_p wfcb, ClauseProfile_p profile,
+                                  int pos, bool empty);
 
 #endif
 
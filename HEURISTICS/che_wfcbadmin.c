@@ -62,6 +62,7 @@ char* WeightFunParseFunNames[]=
    "RelevanceLevelWeight2",
    "FunWeight",
    "SymOffsetWeight",
+   "WatchProgressWeight",
    NULL
 };
 
@@ -98,10 +99,53 @@ static WeightFunParseFun parse_fun_array[]=
    RelevanceLevelWeightParse2,
    FunWeightParse,
    SymOffsetWeightParse,
+   WatchProgressWeightParse,
    (WeightFunParseFun)NULL
 };
 
 
+/* Evaluations that may change for an unchanged clause (and hence
+   require reweighting of the unprocessed queue). Parallel to
+   WeightFunParseFunNames. */
+
+static bool state_dependent_array[]=
+{
+   false, /* Clauseweight */
+   false, /* ClauseLMaxWeight */
+   false, /* ClauseCMaxWeight */
+   false, /* Uniqweight */
+   false, /* Defaultweight */
+   false, /* Refinedweight */
+   false, /* Refinedweight2 */
+   false, /* PNRefinedweight */
+   false, /* TPTPTypeweight */
+   false, /* Sigweight */
+   false, /* NLweight */
+   false, /* SymbolTypeweight */
+   false, /* Depthweight */
+   false, /* WLessDWeight */
+   false, /* Proofweight */
+   false, /* Orientweight */
+   false, /* OrientLMaxWeight */
+   false, /* Simweight */
+   false, /* FIFOWeight */
+   false, /* LIFOWeight */
+   false, /* StaggeredWeight */
+   false, /* ClauseWeightAge */
+   true,  /* TSMWeight */
+   true,  /* TSMRWeight */
+   false, /* ConjectureSymbolWeight */
+   false, /* ConjectureGeneralSymbolWeight */
+   false, /* ConjectureRelativeSymbolWeight */
+   false, /* RelevanceLevelWeight */
+   false, /* RelevanceLevelWeight2 */
+   false, /* FunWeight */
+   false, /* SymOffsetWeight */
+   true,  /* WatchProgressWeight */
+   false
+};
+
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -277,9 +321,10 @@ WeightFunParseFun GetWeightFunParseFun(char* name)
 //
 // Function: WeightFunParse()
 //
-//   Parse a weight function.
+//   Parse a weight function and record whether its evaluations are
+//   state-dependent.
 //
-// Global Variables: -
+// Global Variables: WeightFunParseFunNames
 //
 // Side Effects    : -
 //
@@ -287,19 +332,23 @@ WeightFunParseFun GetWeightFunParseFun(char* name)
 
 WFCB_p WeightFunParse(Scanner_p in, OCB_p ocb, ProofState_p state)
 {
-   WeightFunParseFun parse_fun;
+   int    index;
+   WFCB_p res;
 
    CheckInpTok(in, Identifier);
-   parse_fun = GetWeightFunParseFun(DStrView(AktToken(in)->literal));
+   index = StringIndex(DStrView(AktToken(in)->literal),
+                       WeightFunParseFunNames);
 
-   if(!parse_fun)
+   if(index < 0)
    {
       AktTokenError(in, "Not a valid weight function specifier",
           false);
    }
    NextToken(in);
-   assert(parse_fun);
-   return parse_fun(in, ocb, state);
+   res = parse_fun_array[index](in, ocb, state);
+   res->wfcb_state_dependent = state_dependent_array[index] ||
+      PrioFunIsStateDependent(res->wfcb_priority);
+   return res;
 }
 
 
@@ -33,6 +33,7 @@ Changes
 #include <che_fifo.h>
 #include <che_lifo.h>
 #include <che_learning.h>
+#include <che_watchweight.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -74,6 +74,29 @@ void OpenGlobalOut(char* outname)
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: OutSetBuffer()
+//
+//   If out is not a terminal, make it fully buffered with a buffer of
+//   OUTPUT_BUFFER_SIZE bytes. Must be called before any output to
+//   out.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes buffering of out
+//
+/----------------------------------------------------------------------*/
+
+void OutSetBuffer(FILE* out)
+{
+   if(!isatty(fileno(out)))
+   {
+      setvbuf(out, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: OutOpen()
@@ -103,6 +126,7 @@ FILE* OutOpen(char* name)
     sprintf(ErrStr, "Cannot open file %s", name);
          SysError(ErrStr, FILE_ERROR);
       }
+      OutSetBuffer(out);
    }
    else
    {
@@ -150,6 +174,40 @@ void OutClose(FILE* file)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: OutLong()
+//
+//   Print value in decimal (as "%ld" would), without going through
+//   the printf() format interpreter. Used for the numbers in clause
+//   and inference output.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void OutLong(FILE* out, long value)
+{
+   char          buffer[24];
+   char          *pos = buffer+sizeof(buffer);
+   unsigned long uval;
+
+   uval = (value<0)?-(unsigned long)value:(unsigned long)value;
+   do
+   {
+      *--pos = '0'+uval%10;
+      uval /= 10;
+   }while(uval);
+   if(value<0)
+   {
+      *--pos = '-';
+   }
+   fwrite(pos, 1, buffer+sizeof(buffer)-pos, out);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: PrintDashedStatuses()
@@ -38,6 +38,11 @@ Changes
 #define OUTPRINT(level, message)\
     if(level<= OutputLevel){fprintf(GlobalOut, message);}
 
+/* Buffer size for output streams not connected to a terminal. Large
+   proof objects and PCL protocols are written in few big chunks. */
+
+#define OUTPUT_BUFFER_SIZE (1024*1024)
+
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
@@ -47,10 +52,13 @@ extern long  OutputLevel;
 extern FILE* GlobalOut;
 extern int   GlobalOutFD;
 
-#define      InitOutput() GlobalOut=stdout;GlobalOutFD=STDOUT_FILENO
+#define      InitOutput() do{GlobalOut=stdout;GlobalOutFD=STDOUT_FILENO;\
+                             OutSetBuffer(stdout);}while(0)
 void         OpenGlobalOut(char* outname);
+void         OutSetBuffer(FILE* out);
 FILE*        OutOpen(char* name);
 void         OutClose(FILE* file);
+void         OutLong(FILE* out, long value);
 void         PrintDashedStatuses(FILE* out, char *stat1, char *stat2, char *fallback);
 
 #endif
@@ -18,6 +18,8 @@ Changes
 
 <1> Sun Aug 31 13:31:42 MET DST 1997
     New
+<2> Tue Oct 20 05:02:11 CEST 2026
+    CreateScannerFromStream().
 
 -----------------------------------------------------------------------*/
 
@@ -85,6 +87,56 @@ static TokenRepCell token_print_rep[] =
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+static bool is_white_char(int ch)
+{
+   return isspace(ch);
+}
+
+static bool is_digit_char(int ch)
+{
+   return isdigit(ch);
+}
+
+static bool is_line_comment_char(int ch)
+{
+   return (ch != '\n') && (ch != EOF);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: append_span()
+//
+//   Append the longest sequence of characters in in_class starting at
+//   the current character to the current token and consume it. The
+//   characters are taken directly from the stream window, a block at
+//   a time.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void append_span(Scanner_p in, bool (*in_class)(int))
+{
+   unsigned char *ptr;
+   long          avail, n;
+
+   while(in_class(CurrChar(in)))
+   {
+      ptr   = (unsigned char*)StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(n=0; (n<avail) && in_class(ptr[n]); n++)
+      {
+         /* Just count */
+      }
+      DStrAppendBuffer(AktToken(in)->literal, (char*)ptr, n);
+      StreamSkip(in->source, n);
+   }
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -102,11 +154,7 @@ static TokenRepCell token_print_rep[] =
 static void scan_white(Scanner_p in)
 {
    AktToken(in)->tok = WhiteSpace;
-   while(isspace(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   append_span(in, is_white_char);
 }
 
 
@@ -126,20 +174,26 @@ static void scan_white(Scanner_p in)
 static void scan_ident(Scanner_p in)
 {
    long numstart = 0,
-        i;
+        i = 0, n, avail;
+   unsigned char *ptr;
 
-   for(i=0; isidchar(CurrChar(in)); i++)
+   while(isidchar(CurrChar(in)))
    {
-      if(!numstart && isdigit(CurrChar(in)))
-      {
-    numstart = i;
-      }
-      else if(!isdigit(CurrChar(in)))
+      ptr   = (unsigned char*)StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(n=0; (n<avail) && isidchar(ptr[n]); n++, i++)
       {
-    numstart = 0;
+         if(!numstart && isdigit(ptr[n]))
+         {
+            numstart = i;
+         }
+         else if(!isdigit(ptr[n]))
+         {
+            numstart = 0;
+         }
       }
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      DStrAppendBuffer(AktToken(in)->literal, (char*)ptr, n);
+      StreamSkip(in->source, n);
    }
    if(numstart)
    {
@@ -176,11 +230,7 @@ static void scan_int(Scanner_p in)
 {
    AktToken(in)->tok = PosInt;
 
-   while(isdigit(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   append_span(in, is_digit_char);
    errno = 0;
    AktToken(in)->numval =
       strtol(DStrView(AktToken(in)->literal), NULL, 10);
@@ -213,11 +263,7 @@ static void scan_line_comment(Scanner_p in)
 {
    AktToken(in)->tok = Comment;
 
-   while((CurrChar(in)) != '\n' && (CurrChar(in)!=EOF))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   append_span(in, is_line_comment_char);
    DStrAppendChar(AktToken(in)->literal, '\n');
    NextChar(in); /* Should be harmless even at EOF */
 }
@@ -267,6 +313,8 @@ static void scan_C_comment(Scanner_p in)
 static void scan_string(Scanner_p in, char delim)
 {
    bool escape = false;
+   unsigned char *ptr;
+   long          avail, n;
 
    AktToken(in)->tok = (delim=='\'')?SQString:String;
 
@@ -280,16 +328,25 @@ static void scan_string(Scanner_p in, char delim)
              "Non-printable character in string constant",
              false);
       }
-      if(CurrChar(in)=='\\')
-      {
-         escape = !escape;
-      }
-      else
+      ptr   = (unsigned char*)StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(n=0; n<avail; n++)
       {
-         escape = false;
+         if((!escape && (ptr[n] == delim)) || !isprint(ptr[n]))
+         {
+            break;
+         }
+         if(ptr[n]=='\\')
+         {
+            escape = !escape;
+         }
+         else
+         {
+            escape = false;
+         }
       }
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      DStrAppendBuffer(AktToken(in)->literal, (char*)ptr, n);
+      StreamSkip(in->source, n);
    }
    DStrAppendChar(AktToken(in)->literal, CurrChar(in));
    NextChar(in);
@@ -644,6 +701,36 @@ bool str_n_element(char* str, char* ids, int len)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: scanner_fill_lookahead()
+//
+//   Initialize the token lookahead of a new scanner by reading the
+//   first tokens.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void scanner_fill_lookahead(Scanner_p handle)
+{
+   for(handle->current = 0; handle->current < MAXTOKENLOOKAHEAD;
+     handle->current++)
+   {
+      handle->tok_sequence[handle->current].tok = NoToken;
+      handle->tok_sequence[handle->current].literal = DStrAlloc();
+      handle->tok_sequence[handle->current].comment = DStrAlloc();
+      handle->tok_sequence[handle->current].source      = NULL;
+      handle->tok_sequence[handle->current].stream_type = NULL;
+      scan_real_token(handle);
+   }
+   handle->current = 0;
+   handle->include_pos = NULL;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -869,18 +956,38 @@ Scanner_p CreateScanner(StreamType type, char *name, bool
       }
    }
 
-   for(handle->current = 0; handle->current < MAXTOKENLOOKAHEAD;
-     handle->current++)
-   {
-      handle->tok_sequence[handle->current].tok = NoToken;
-      handle->tok_sequence[handle->current].literal = DStrAlloc();
-      handle->tok_sequence[handle->current].comment = DStrAlloc();
-      handle->tok_sequence[handle->current].source      = NULL;
-      handle->tok_sequence[handle->current].stream_type = NULL;
-      scan_real_token(handle);
-   }
-   handle->current = 0;
-   handle->include_pos = NULL;
+   scanner_fill_lookahead(handle);
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CreateScannerFromStream()
+//
+//   Create a new, initialized scanner reading from stream (which is
+//   taken over by the scanner).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, reads input.
+//
+/----------------------------------------------------------------------*/
+
+Scanner_p CreateScannerFromStream(Stream_p stream, bool ignore_comments)
+{
+   Scanner_p handle;
+
+   handle = ScannerCellAlloc();
+   handle->source = stream;
+   stream->next = NULL;
+   handle->default_dir = DStrAlloc();
+   handle->accu = DStrAlloc();
+   handle->ignore_comments = ignore_comments;
+   handle->include_key = NULL;
+   handle->format = LOPFormat;
+
+   scanner_fill_lookahead(handle);
    return handle;
 }
 
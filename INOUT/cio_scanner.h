@@ -184,6 +184,7 @@ void      PrintToken(FILE* out, Token_p token);
 
 Scanner_p CreateScanner(StreamType type, char *name, bool
          ignore_comments, char *default_dir);
+Scanner_p CreateScannerFromStream(Stream_p stream, bool ignore_comments);
 void      DestroyScanner(Scanner_p  junk);
 
 void      ScannerSetFormat(Scanner_p scanner, IOFormat fmt);
@@ -18,9 +18,16 @@ Changes
 
 <1> Sat Jul  5 02:28:25 MET DST 1997
     New
+<2> Tue Oct 20 05:02:11 CEST 2026
+    Streams on parts of files already in memory.
+<3> Wed Oct 21 12:25:44 CEST 2026
+    Map files from the current offset.
 
 -----------------------------------------------------------------------*/
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "cio_streams.h"
 
 
@@ -54,50 +61,103 @@ const StreamType StreamTypeOptionString =
 
 /*-----------------------------------------------------------------------
 //
-// Function: read_char()
+// Function: stream_fill()
 //
-//   Read a character and return it. Return an infinite sequence of
-//   EOFs after the end of file.
+//   Move the rest of the window to the start of the buffer and read
+//   more input until at least MAXLOOKAHEAD characters are available
+//   or the end of the input has been reached. read() returns whatever
+//   input is available, so this does not block interactive input
+//   longer than necessary.
 //
 // Global Variables: -
 //
-// Side Effects    : May read a character
+// Side Effects    : Reads input, may terminate with an error
 //
 /----------------------------------------------------------------------*/
 
-static int read_char(Stream_p stream)
+static void stream_fill(Stream_p stream)
 {
-   int ch;
+   long    rest = StreamAvail(stream);
+   ssize_t res;
 
-   if(stream->eof_seen)
-   {
-      ch = EOF;
-   }
-   else
+   assert(stream->buf_size);
+
+   memmove(stream->data, StreamCurrPtr(stream), rest);
+   stream->data_len = rest;
+   stream->pos      = 0;
+
+   while(!stream->eof_seen && (stream->data_len < MAXLOOKAHEAD))
    {
-      if(stream->stream_type!=StreamTypeFile)
+      res = read(fileno(stream->file), stream->data+stream->data_len,
+                 stream->buf_size-stream->data_len);
+      if(res > 0)
       {
-    ch = (int)DStrView(stream->source)[stream->string_pos];
-    if(ch)
-    {
-       stream->string_pos++;
-    }
-    else
-    {
-       ch = EOF;
-       stream->eof_seen = true;
-    }
+         stream->data_len += res;
       }
-      else
+      else if(res == 0)
       {
-    ch = getc(stream->file);
-    if(ch == EOF)
-    {
-       stream->eof_seen = true;
-    }
+         stream->eof_seen = true;
+      }
+      else if(errno != EINTR)
+      {
+         TmpErrno = errno;
+         SysError("Cannot read from %s", FILE_ERROR,
+                  DStrView(stream->source));
       }
    }
-   return ch;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: stream_map_file()
+//
+//   Try to map the (regular, non-empty) file of stream into memory as
+//   the window, starting at the current file offset (which need not
+//   be 0, e.g. for stdin redirected from a partially read file). The
+//   mapping starts at the page boundary below the offset, and the
+//   window position is set to the offset. Return true on success,
+//   false if the file has to be read block by block.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool stream_map_file(Stream_p stream)
+{
+   struct stat stat_buf;
+   off_t       offset, base;
+   long        page_size;
+   void*       map;
+
+   if((fstat(fileno(stream->file), &stat_buf)!=0) ||
+      !S_ISREG(stat_buf.st_mode) ||
+      (stat_buf.st_size != (off_t)(size_t)stat_buf.st_size))
+   {
+      return false;
+   }
+   offset    = lseek(fileno(stream->file), 0, SEEK_CUR);
+   page_size = sysconf(_SC_PAGESIZE);
+   if((offset == -1) || (offset >= stat_buf.st_size) || (page_size <= 0))
+   {
+      return false;
+   }
+   base = offset - offset%page_size;
+   map = mmap(NULL, stat_buf.st_size-base, PROT_READ, MAP_PRIVATE,
+              fileno(stream->file), base);
+   if(map == MAP_FAILED)
+   {
+      return false;
+   }
+   stream->data     = map;
+   stream->data_len = stat_buf.st_size-base;
+   stream->pos      = offset-base;
+   stream->map_size = stat_buf.st_size-base;
+   stream->eof_seen = true;
+
+   return true;
 }
 
 /*---------------------------------------------------------------------*/
@@ -110,7 +170,9 @@ static int read_char(Stream_p stream)
 // Function: CreateStream()
 //
 //   Create a stream associated with the file name. Both the
-//   NULL-pointer and the name "-" are taken to mean stdin.
+//   NULL-pointer and the name "-" are taken to mean stdin. Regular
+//   files are mapped into memory, other files are read in blocks of
+//   STREAM_BLOCK_SIZE bytes.
 //
 // Global Variables: -
 //
@@ -121,12 +183,18 @@ static int read_char(Stream_p stream)
 Stream_p CreateStream(StreamType type, char* source, bool fail)
 {
    Stream_p handle;
-   int      i;
 
    handle = StreamCellAlloc();
 
-   handle->source = DStrAlloc();
+   handle->source      = DStrAlloc();
    handle->stream_type = type;
+   handle->file        = NULL;
+   handle->eof_seen    = false;
+   handle->data        = NULL;
+   handle->data_len    = 0;
+   handle->pos         = 0;
+   handle->buf_size    = 0;
+   handle->map_size    = 0;
 
    if(type == StreamTypeFile)
    {
@@ -150,24 +218,63 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
          }
       }
       VERBOUTARG("Opened ", DStrView(handle->source));
+      if(!stream_map_file(handle))
+      {
+         handle->buf_size = STREAM_BLOCK_SIZE;
+         handle->data     = SecureMalloc(handle->buf_size);
+         stream_fill(handle);
+      }
    }
    else
    {
       /* Interprete source as a string to read from! */
 
       DStrSet(handle->source, source);
-      handle->string_pos = 0;
+      handle->data     = DStrView(handle->source);
+      handle->data_len = strlen(handle->data);
+      handle->eof_seen = true;
    }
    handle->next       = NULL;
-   handle->eof_seen   = false;
    handle->line       = 1;
    handle->column     = 1;
-   handle->current    = 0;
 
-   for(i=0; i<MAXLOOKAHEAD; i++)
-   {
-      handle->buffer[i] = read_char(handle);
-   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CreateStreamView()
+//
+//   Create a stream reading the len characters at data, which are
+//   part of the named file starting at the given line and column
+//   (positions are reported accordingly). data is not copied and has
+//   to stay valid while the stream is in use.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+Stream_p CreateStreamView(char* source, char* data, long len,
+                          long line, long column)
+{
+   Stream_p handle = StreamCellAlloc();
+
+   handle->source      = DStrAlloc();
+   DStrSet(handle->source, source);
+   handle->stream_type = StreamTypeFile;
+   handle->file        = NULL;
+   handle->eof_seen    = true;
+   handle->data        = data;
+   handle->data_len    = len;
+   handle->pos         = 0;
+   handle->buf_size    = 0;
+   handle->map_size    = 0;
+   handle->next        = NULL;
+   handle->line        = line;
+   handle->column      = column;
 
    return handle;
 }
@@ -188,7 +295,15 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
 
 void DestroyStream(Stream_p stream)
 {
-   if(stream->stream_type == StreamTypeFile)
+   if(stream->map_size)
+   {
+      munmap(stream->data, stream->map_size);
+   }
+   if(stream->buf_size)
+   {
+      FREE(stream->data);
+   }
+   if(stream->stream_type == StreamTypeFile && stream->file)
    {
       if(stream->file != stdin)
       {
@@ -215,8 +330,8 @@ void DestroyStream(Stream_p stream)
 //
 // Global Variables: -
 //
-// Side Effects    : Reads one character from the input, update the
-//                   stream information about the current position.
+// Side Effects    : May read input, update the stream information
+//                   about the current position.
 //
 /----------------------------------------------------------------------*/
 
@@ -231,14 +346,102 @@ int StreamNextChar(Stream_p stream)
    {
       stream->column++;
    }
-   stream->current=STREAMREALPOS(stream->current+1);
-   stream->buffer[STREAMREALPOS(stream->current+MAXLOOKAHEAD-1)]
-      = read_char(stream);
-
+   if(stream->pos < stream->data_len)
+   {
+      stream->pos++;
+      if(!stream->eof_seen && (StreamAvail(stream) < MAXLOOKAHEAD))
+      {
+         stream_fill(stream);
+      }
+   }
    return StreamCurrChar(stream);
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: StreamSkip()
+//
+//   Consume count characters (at most StreamAvail(stream)) starting
+//   at the current one, i.e. do the same as count calls to
+//   StreamNextChar(), but in one go.
+//
+// Global Variables: -
+//
+// Side Effects    : May read input, update the stream information
+//                   about the current position.
+//
+/----------------------------------------------------------------------*/
+
+void StreamSkip(Stream_p stream, long count)
+{
+   char *ptr = StreamCurrPtr(stream), *end = ptr+count, *nl;
+
+   assert(count <= StreamAvail(stream));
+
+   while((nl = memchr(ptr, '\n', end-ptr)))
+   {
+      stream->line++;
+      stream->column = 1;
+      ptr = nl+1;
+   }
+   stream->column += end-ptr;
+   stream->pos    += count;
+
+   if(!stream->eof_seen && (StreamAvail(stream) < MAXLOOKAHEAD))
+   {
+      stream_fill(stream);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StreamReadAll()
+//
+//   Make sure that all remaining input of the stream is in the
+//   window, i.e. StreamCurrPtr(stream) points to StreamAvail(stream)
+//   characters that extend to the end of the input. This is free for
+//   mapped files and strings, other input is read completely into a
+//   growing buffer.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StreamReadAll(Stream_p stream)
+{
+   ssize_t res;
+
+   while(!stream->eof_seen)
+   {
+      if(stream->data_len == stream->buf_size)
+      {
+         stream->buf_size = 2*stream->buf_size;
+         stream->data     = SecureRealloc(stream->data, stream->buf_size);
+      }
+      res = read(fileno(stream->file), stream->data+stream->data_len,
+                 stream->buf_size-stream->data_len);
+      if(res > 0)
+      {
+         stream->data_len += res;
+      }
+      else if(res == 0)
+      {
+         stream->eof_seen = true;
+      }
+      else if(errno != EINTR)
+      {
+         TmpErrno = errno;
+         SysError("Cannot read from %s", FILE_ERROR,
+                  DStrView(stream->source));
+      }
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: OpenStackedInput()
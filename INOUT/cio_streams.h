@@ -37,6 +37,11 @@ Changes
 
 #define MAXLOOKAHEAD 64
 
+/* Block size for reading files that cannot be mapped (pipes, stdin
+   from a terminal, ...). */
+
+#define STREAM_BLOCK_SIZE 65536
+
 
 /* Streams can read either from a file or from several predefined
    classes of strings. We use a StreamType 'virtual type' to denote
@@ -49,7 +54,15 @@ typedef char* StreamType;
 /* The following data structure describes the state of a (named) input
    stream with lookahead-capability. Streams are stackable, with new
    data being read from the top of the stack. The empty stack is a
-   NULL-valued pointer of type Inpstack_p! */
+   NULL-valued pointer of type Inpstack_p!
+
+   The input is accessed through a contiguous window data[0..data_len)
+   with the current character at data[pos]. For strings the window is
+   the string itself, regular files are mapped into memory as a
+   whole, everything else is read block by block into an allocated
+   buffer. In the last case, the window always contains at least
+   MAXLOOKAHEAD characters after pos unless the end of the input has
+   been reached (eof_seen). */
 
 
 typedef struct streamcell
@@ -58,13 +71,18 @@ typedef struct streamcell
    DStr_p             source;
    StreamType         stream_type; /* Only constant strings allowed
                   here! */
-   long               string_pos;
    FILE*              file;
-   bool               eof_seen;
+   bool               eof_seen;    /* All input is in the window */
    long               line;
    long               column;
-   int                buffer[MAXLOOKAHEAD];
-   int                current;
+   char*              data;
+   long               data_len;
+   long               pos;
+   long               buf_size;    /* Size of the allocated buffer, 0 if
+                                      data is not owned by the
+                                      stream */
+   size_t             map_size;    /* Size of the mapping, 0 if data
+                                      is not mapped */
 }StreamCell, *Stream_p, **Inpstack_p;
 
 
@@ -82,18 +100,27 @@ extern const StreamType StreamTypeOptionString;
 #define StreamCellFree(junk)         SizeFree(junk, sizeof(StreamCell))
 
 Stream_p CreateStream(StreamType type, char* source, bool fail);
+Stream_p CreateStreamView(char* source, char* data, long len,
+                          long line, long column);
 void     DestroyStream(Stream_p stream);
 
-#define  STREAMREALPOS(pos) ((pos) % MAXLOOKAHEAD)
-
 #define  StreamLookChar(stream, look)\
          (assert((look)<MAXLOOKAHEAD),\
-     (stream)->buffer[STREAMREALPOS((stream)->current+(look))])
-#define  StreamCurrChar(stream) ((stream)->buffer[(stream)->current])
+          ((stream)->pos+(look) < (stream)->data_len)?\
+          (int)(unsigned char)(stream)->data[(stream)->pos+(look)]:EOF)
+#define  StreamCurrChar(stream) StreamLookChar((stream), 0)
 #define  StreamCurrLine(stream)   ((stream)->line)
 #define  StreamCurrColumn(stream) ((stream)->column)
 
+/* The characters from the current one to the end of the window can
+   be accessed (and consumed with StreamSkip()) as a block. */
+
+#define  StreamCurrPtr(stream)    ((stream)->data+(stream)->pos)
+#define  StreamAvail(stream)      ((stream)->data_len-(stream)->pos)
+
 int      StreamNextChar(Stream_p stream);
+void     StreamSkip(Stream_p stream, long count);
+void     StreamReadAll(Stream_p stream);
 
 Stream_p OpenStackedInput(Inpstack_p stack, StreamType type,
            char* source, bool fail);
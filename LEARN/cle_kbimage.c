@@ -0,0 +1,1377 @@
+/*-----------------------------------------------------------------------
+
+File  : cle_kbimage.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Reading, writing and appending to binary knowledge base images.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 03:41:17 CEST 2026
+    New
+<2> Tue Oct 20 11:02:45 CEST 2026
+    32 bit records, version 2
+<3> Wed Oct 21 10:12:31 CEST 2026
+    Variable-length coding, version 3, atomic appends
+
+-----------------------------------------------------------------------*/
+
+#include <fcntl.h>
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "cle_kbimage.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* A mapped segment: The header, the example records, and a cursor
+   into the code section */
+
+typedef struct kbimage_segment_cell
+{
+   KBImageHeader_p  header;
+   KBImageExample_p examples;
+   unsigned char*   code;
+   unsigned char*   code_end;
+   char*            strs;
+}KBImageSegmentCell, *KBImageSegment_p;
+
+
+/* Variables in clause patterns are normalized, anything beyond this
+   indicates a corrupt image */
+
+#define KB_IMAGE_MAX_VAR (1L<<30)
+
+/* Annotation values that are integers of at most this magnitude are
+   coded as integers, all others as a tag followed by the raw
+   double */
+
+#define KB_IMAGE_MAX_INT_VALUE (1L<<52)
+
+/* A segment under construction. The symbols, nodes and annotations
+   are coded as they are collected. */
+
+typedef struct kbimage_builder_cell
+{
+   DStr_p   syms;
+   DStr_p   nodes;
+   DStr_p   annos;
+   PStack_p examples;  /* ExampleRep_p, name */
+   long     sym_no;
+   long     node_no;
+   long     anno_no;
+   long     anno_node; /* Node of the previous annotation */
+   long     distrib_no;
+   long     value_no;
+   DStr_p   strs;
+}KBImageBuilderCell, *KBImageBuilder_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_corrupt()
+//
+//   Terminate with an error about the image file name.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates program
+//
+/----------------------------------------------------------------------*/
+
+static void image_corrupt(char* name)
+{
+   Error("%s: Corrupt or incompatible knowledge base image",
+         FILE_ERROR, name);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_int()
+//
+//   Return val as a field of an image record, or terminate with an
+//   error if it does not fit.
+//
+// Global Variables: -
+//
+// Side Effects    : May terminate program
+//
+/----------------------------------------------------------------------*/
+
+static int32_t image_int(long val, char* name)
+{
+   if((val < INT32_MIN) || (val > INT32_MAX))
+   {
+      Error("%s: Value %ld too large for knowledge base image",
+            FILE_ERROR, name, val);
+   }
+   return val;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: str_store()
+//
+//   Append str (with the terminating '\0') to the string pool and
+//   return its offset.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long str_store(DStr_p pool, char* str)
+{
+   long res = DStrLen(pool);
+
+   DStrAppendBuffer(pool, str, strlen(str)+1);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_put_uint()
+//
+//   Append val to code, 7 bits per byte, least significant group
+//   first, with the high bit set on all but the last byte.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void code_put_uint(DStr_p code, unsigned long val)
+{
+   while(val >= 0x80)
+   {
+      DStrAppendChar(code, (char)((val&0x7f)|0x80));
+      val = val>>7;
+   }
+   DStrAppendChar(code, (char)val);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_put_int()
+//
+//   Append the signed val to code, mapping 0, -1, 1, -2,... to 0, 1,
+//   2, 3,... so that small magnitudes get short codes.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void code_put_int(DStr_p code, long val)
+{
+   code_put_uint(code, (val<0)?
+                 (((unsigned long)(-(val+1)))<<1)|1:
+                 ((unsigned long)val)<<1);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_put_value()
+//
+//   Append an annotation value to code: An integral value v as the
+//   integer 2v, anything else as 1 followed by the bytes of the
+//   double.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void code_put_value(DStr_p code, double value)
+{
+   if((fabs(value) <= KB_IMAGE_MAX_INT_VALUE) &&
+      (value == (double)(long)value) && !signbit(value))
+   {
+      code_put_uint(code, ((unsigned long)value)<<1);
+   }
+   else
+   {
+      code_put_uint(code, 1);
+      DStrAppendBuffer(code, (char*)&value, sizeof(double));
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_get_uint()
+//
+//   Decode an unsigned integer at the cursor of seg into *val and
+//   advance the cursor. Return false if the code is truncated or too
+//   long.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cursor
+//
+/----------------------------------------------------------------------*/
+
+static bool code_get_uint(KBImageSegment_p seg, unsigned long *val)
+{
+   int shift;
+
+   *val = 0;
+   for(shift = 0; shift < 63; shift += 7)
+   {
+      if(seg->code == seg->code_end)
+      {
+         return false;
+      }
+      *val |= ((unsigned long)(*seg->code&0x7f))<<shift;
+      if(!(*seg->code++ & 0x80))
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_get_long()
+//
+//   Decode a non-negative integer of at most max at the cursor of
+//   seg into *val. Return false if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cursor
+//
+/----------------------------------------------------------------------*/
+
+static bool code_get_long(KBImageSegment_p seg, long *val, long max)
+{
+   unsigned long code;
+
+   if(!code_get_uint(seg, &code) || (code > (unsigned long)max))
+   {
+      return false;
+   }
+   *val = code;
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_get_int()
+//
+//   Decode a signed integer (see code_put_int()) at the cursor of
+//   seg into *val. Return false if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cursor
+//
+/----------------------------------------------------------------------*/
+
+static bool code_get_int(KBImageSegment_p seg, long *val)
+{
+   unsigned long code;
+
+   if(!code_get_uint(seg, &code))
+   {
+      return false;
+   }
+   *val = (code&1)?-(long)(code>>1)-1:(long)(code>>1);
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: code_get_value()
+//
+//   Decode an annotation value (see code_put_value()) at the cursor
+//   of seg into *val. Return false if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cursor
+//
+/----------------------------------------------------------------------*/
+
+static bool code_get_value(KBImageSegment_p seg, double *val)
+{
+   unsigned long code;
+
+   if(!code_get_uint(seg, &code))
+   {
+      return false;
+   }
+   if(code != 1)
+   {
+      *val = (double)(code>>1);
+      return !(code&1);
+   }
+   if(seg->code_end-seg->code < (long)sizeof(double))
+   {
+      return false;
+   }
+   memcpy(val, seg->code, sizeof(double));
+   seg->code += sizeof(double);
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: write_block()
+//
+//   Write size bytes from data to out.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static void write_block(FILE* out, void* data, size_t size, char* name)
+{
+   if(size && (fwrite(data, 1, size, out)!=size))
+   {
+      TmpErrno = errno;
+      SysError("Cannot write knowledge base image %s", FILE_ERROR, name);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: close_image()
+//
+//   Close an image file written with write_block(). Unlike
+//   SecureFClose(), fail if the buffered data cannot be written, as
+//   the file would be renamed over the old image afterwards.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static void close_image(FILE* out, char* name)
+{
+   if(fclose(out))
+   {
+      TmpErrno = errno;
+      SysError("Cannot write knowledge base image %s", FILE_ERROR, name);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: builder_init()
+//
+//   Initialize an empty segment builder.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void builder_init(KBImageBuilder_p builder)
+{
+   builder->syms       = DStrAlloc();
+   builder->nodes      = DStrAlloc();
+   builder->annos      = DStrAlloc();
+   builder->examples   = PStackAlloc();
+   builder->sym_no     = 0;
+   builder->node_no    = 0;
+   builder->anno_no    = 0;
+   builder->anno_node  = 0;
+   builder->distrib_no = 0;
+   builder->value_no   = 0;
+   builder->strs       = DStrAlloc();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: builder_exit()
+//
+//   Free the data of a segment builder.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void builder_exit(KBImageBuilder_p builder)
+{
+   DStrFree(builder->syms);
+   DStrFree(builder->nodes);
+   DStrFree(builder->annos);
+   PStackFree(builder->examples);
+   DStrFree(builder->strs);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: builder_add_term()
+//
+//   Add the nodes of t that are not yet in the image to the segment
+//   (arguments first), together with their new symbols. This is the
+//   order in which parsing the term would create them. A node is
+//   coded as its symbol number followed by its arguments, where a
+//   variable argument is its (negative) f_code, and a node argument
+//   the (positive) distance to the node number of the argument.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes builder and image
+//
+/----------------------------------------------------------------------*/
+
+static void builder_add_term(KBImageBuilder_p builder, KBImage_p image,
+                             Sig_p sig, Term_p t)
+{
+   long sym;
+   int  i;
+
+   if(TermIsVar(t) || PDArrayElementInt(image->node_index, t->entry_no))
+   {
+      return;
+   }
+   for(i=0; i<t->arity; i++)
+   {
+      builder_add_term(builder, image, sig, t->args[i]);
+   }
+   sym = PDArrayElementInt(image->sym_index, t->f_code);
+   if(!sym)
+   {
+      sym = ++image->sym_no;
+      PDArrayAssignInt(image->sym_index, t->f_code, sym);
+      code_put_uint(builder->syms,
+                    str_store(builder->strs, SigFindName(sig, t->f_code)));
+      code_put_uint(builder->syms, t->arity);
+      builder->sym_no++;
+   }
+   code_put_uint(builder->nodes, sym);
+   for(i=0; i<t->arity; i++)
+   {
+      if(TermIsVar(t->args[i]))
+      {
+         code_put_int(builder->nodes, t->args[i]->f_code);
+      }
+      else
+      {
+         code_put_int(builder->nodes,
+                      image->node_no+1-
+                      PDArrayElementInt(image->node_index,
+                                        t->args[i]->entry_no));
+      }
+   }
+   PDArrayAssignInt(image->node_index, t->entry_no, ++image->node_no);
+   builder->node_no++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: builder_collect()
+//
+//   Add the examples with ident at least first_ident and the
+//   annotations for these examples to the segment. An annotation is
+//   coded as the difference of its node number to that of the
+//   previous one, the example key, the length and the values. Return
+//   the number of annotations added.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes builder and image
+//
+/----------------------------------------------------------------------*/
+
+static long builder_collect(KBImageBuilder_p builder, KBImage_p image,
+                            ExampleSet_p examples, AnnoSet_p annos,
+                            long first_ident)
+{
+   PStack_p     stack, anno_stack;
+   NumTree_p    cell;
+   ExampleRep_p rep;
+   AnnoTerm_p   term;
+   Annotation_p anno;
+   long         node, j;
+
+   stack = NumTreeTraverseInit(examples->ident_index);
+   while((cell = NumTreeTraverseNext(stack)))
+   {
+      rep = cell->val1.p_val;
+      if(rep->ident >= first_ident)
+      {
+         PStackPushP(builder->examples, rep);
+         PStackPushInt(builder->examples, str_store(builder->strs, rep->name));
+         builder->distrib_no += rep->features->pred_max_arity+1
+            + rep->features->func_max_arity+1;
+      }
+   }
+   NumTreeTraverseExit(stack);
+
+   stack = NumTreeTraverseInit(annos->set);
+   while((cell = NumTreeTraverseNext(stack)))
+   {
+      term = cell->val1.p_val;
+      anno_stack = NumTreeTraverseInit(term->annotation);
+      while((anno = NumTreeTraverseNext(anno_stack)))
+      {
+         if(anno->key < first_ident)
+         {
+            continue;
+         }
+         builder_add_term(builder, image, annos->terms->sig, term->term);
+         node = PDArrayElementInt(image->node_index,
+                                  term->term->entry_no)-1;
+         code_put_int(builder->annos, node-builder->anno_node);
+         code_put_uint(builder->annos, anno->key);
+         code_put_uint(builder->annos, AnnotationLength(anno));
+         for(j=0; j<AnnotationLength(anno); j++)
+         {
+            code_put_value(builder->annos,
+                           DDArrayElement(AnnotationValues(anno), j));
+         }
+         builder->anno_node = node;
+         builder->value_no += AnnotationLength(anno);
+         builder->anno_no++;
+      }
+      NumTreeTraverseExit(anno_stack);
+   }
+   NumTreeTraverseExit(stack);
+
+   return builder->anno_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: builder_write()
+//
+//   Write the segment in builder to out and return its size.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+static long builder_write(KBImageBuilder_p builder, KBImage_p image,
+                          FILE* out, char* name)
+{
+   KBImageHeaderCell  hdr;
+   KBImageExampleCell ex;
+   ExampleRep_p       rep;
+   DStr_p             distribs = DStrAlloc();
+   PStackPointer      i;
+   long               j;
+
+   for(i=0; i<PStackGetSP(builder->examples); i+=2)
+   {
+      rep = PStackElementP(builder->examples, i);
+      for(j=0; j<=rep->features->pred_max_arity; j++)
+      {
+         code_put_uint(distribs,
+                       PDArrayElementInt(rep->features->pred_distrib, j));
+      }
+      for(j=0; j<=rep->features->func_max_arity; j++)
+      {
+         code_put_uint(distribs,
+                       PDArrayElementInt(rep->features->func_distrib, j));
+      }
+   }
+   memset(&hdr, 0, sizeof(KBImageHeaderCell));
+   strcpy(hdr.magic, KB_IMAGE_MAGIC);
+   hdr.version    = KB_IMAGE_VERSION;
+   hdr.byte_order = KB_IMAGE_BYTE_ORDER;
+   hdr.sym_no     = builder->sym_no;
+   hdr.node_no    = builder->node_no;
+   hdr.sym_base   = image->sym_no-hdr.sym_no;
+   hdr.node_base  = image->node_no-hdr.node_no;
+   hdr.example_no = PStackGetSP(builder->examples)/2;
+   hdr.distrib_no = builder->distrib_no;
+   hdr.anno_no    = builder->anno_no;
+   hdr.value_no   = builder->value_no;
+   hdr.code_size  = DStrLen(distribs)+DStrLen(builder->syms)
+      +DStrLen(builder->nodes)+DStrLen(builder->annos);
+   /* Keep the next segment aligned */
+   while((hdr.code_size+DStrLen(builder->strs))%KB_IMAGE_ALIGN)
+   {
+      DStrAppendChar(builder->strs, '\0');
+   }
+   hdr.str_size   = DStrLen(builder->strs);
+   hdr.size       = sizeof(KBImageHeaderCell)
+      + hdr.example_no*sizeof(KBImageExampleCell)
+      + hdr.code_size
+      + hdr.str_size;
+
+   write_block(out, &hdr, sizeof(KBImageHeaderCell), name);
+   for(i=0; i<PStackGetSP(builder->examples); i+=2)
+   {
+      rep = PStackElementP(builder->examples, i);
+      memset(&ex, 0, sizeof(KBImageExampleCell));
+      ex.ident          = image_int(rep->ident, name);
+      ex.name           = image_int(PStackElementInt(builder->examples, i+1),
+                                    name);
+      ex.pred_max_arity = image_int(rep->features->pred_max_arity, name);
+      ex.func_max_arity = image_int(rep->features->func_max_arity, name);
+      memcpy(ex.features, rep->features->features,
+             FEATURE_NUMBER*sizeof(double));
+      write_block(out, &ex, sizeof(KBImageExampleCell), name);
+   }
+   write_block(out, DStrView(distribs), DStrLen(distribs), name);
+   write_block(out, DStrView(builder->syms), DStrLen(builder->syms), name);
+   write_block(out, DStrView(builder->nodes), DStrLen(builder->nodes), name);
+   write_block(out, DStrView(builder->annos), DStrLen(builder->annos), name);
+   write_block(out, DStrView(builder->strs), hdr.str_size, name);
+   DStrFree(distribs);
+
+   return hdr.size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: segment_init()
+//
+//   Check the header of the segment at map (with avail bytes left in
+//   the image), set up the section pointers and put the cursor at the
+//   start of the code section. Return true if the segment is
+//   well-formed so far.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool segment_init(KBImageSegment_p seg, char* map, long avail,
+                         long sym_base, long node_base)
+{
+   KBImageHeader_p hdr = (KBImageHeader_p)map;
+
+   seg->header = hdr;
+   if((avail < (long)sizeof(KBImageHeaderCell)) ||
+      memcmp(hdr->magic, KB_IMAGE_MAGIC, sizeof(KB_IMAGE_MAGIC)) ||
+      (hdr->version != KB_IMAGE_VERSION) ||
+      (hdr->byte_order != KB_IMAGE_BYTE_ORDER) ||
+      (hdr->size > avail) ||
+      (hdr->sym_base != sym_base) || (hdr->node_base != node_base))
+   {
+      return false;
+   }
+   /* Every item takes at least one byte */
+   if((hdr->sym_no < 0)     || (hdr->sym_no > avail)     ||
+      (hdr->node_no < 0)    || (hdr->node_no > avail)    ||
+      (hdr->example_no < 0) || (hdr->example_no > avail) ||
+      (hdr->distrib_no < 0) || (hdr->distrib_no > avail) ||
+      (hdr->anno_no < 0)    || (hdr->anno_no > avail)    ||
+      (hdr->value_no < 0)   || (hdr->value_no > avail)   ||
+      (hdr->code_size < 0)  || (hdr->code_size > avail)  ||
+      (hdr->str_size < 0)   || (hdr->str_size > avail)   ||
+      (hdr->size%KB_IMAGE_ALIGN) ||
+      ((long)sizeof(KBImageHeaderCell)
+       + hdr->example_no*(long)sizeof(KBImageExampleCell)
+       + hdr->code_size + hdr->str_size != hdr->size))
+   {
+      return false;
+   }
+   seg->examples = (KBImageExample_p)(hdr+1);
+   seg->code     = (unsigned char*)(seg->examples+hdr->example_no);
+   seg->code_end = seg->code+hdr->code_size;
+   seg->strs     = (char*)seg->code_end;
+
+   return (hdr->str_size == 0) || (seg->strs[hdr->str_size-1] == '\0');
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: segment_str()
+//
+//   Return the string at offset off in the segment, or NULL if off
+//   is invalid.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* segment_str(KBImageSegment_p seg, long off)
+{
+   if((off < 0) || (off >= seg->header->str_size))
+   {
+      return NULL;
+   }
+   return seg->strs+off;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: segment_replay_examples()
+//
+//   Insert the examples of the segment into examples (or only skip
+//   their arity distributions if examples is NULL). Return false if
+//   the segment is inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes examples and the cursor, memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+static bool segment_replay_examples(KBImageSegment_p seg,
+                                    ExampleSet_p examples)
+{
+   KBImageHeader_p  hdr = seg->header;
+   KBImageExample_p ex;
+   ExampleRep_p     rep;
+   char             *name;
+   long             i, j, val, distrib_no = 0;
+
+   for(i=0; i<hdr->example_no; i++)
+   {
+      ex   = &(seg->examples[i]);
+      name = segment_str(seg, ex->name);
+      if(!name || (ex->ident < 0) ||
+         (ex->pred_max_arity < -1) || (ex->func_max_arity < -1) ||
+         ((long)ex->pred_max_arity+1+ex->func_max_arity+1
+          > hdr->distrib_no-distrib_no))
+      {
+         return false;
+      }
+      distrib_no += ex->pred_max_arity+1+ex->func_max_arity+1;
+      rep = NULL;
+      if(examples)
+      {
+         rep = ExampleRepCellAlloc();
+         rep->ident    = ex->ident;
+         rep->name     = SecureStrdup(name);
+         rep->features = FeaturesAlloc();
+         rep->features->pred_max_arity = ex->pred_max_arity;
+         rep->features->func_max_arity = ex->func_max_arity;
+         memcpy(rep->features->features, ex->features,
+                FEATURE_NUMBER*sizeof(double));
+      }
+      for(j=0; j<=ex->pred_max_arity+ex->func_max_arity+1; j++)
+      {
+         if(!code_get_long(seg, &val, LONG_MAX))
+         {
+            if(rep)
+            {
+               ExampleRepFree(rep);
+            }
+            return false;
+         }
+         if(!rep)
+         {
+            continue;
+         }
+         if(j<=ex->pred_max_arity)
+         {
+            PDArrayAssignInt(rep->features->pred_distrib, j, val);
+         }
+         else
+         {
+            PDArrayAssignInt(rep->features->func_distrib,
+                             j-ex->pred_max_arity-1, val);
+         }
+      }
+      if(rep && !ExampleSetInsert(examples, rep))
+      {
+         ExampleRepFree(rep);
+         return false;
+      }
+   }
+   return distrib_no == hdr->distrib_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: segment_replay_terms()
+//
+//   Insert the symbols and nodes of the segment into annos->terms,
+//   extending fmap (symbol number -> f_code) and cells (node number
+//   -> term). Return false if the segment is inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the signature, term bank and the cursor
+//
+/----------------------------------------------------------------------*/
+
+static bool segment_replay_terms(KBImageSegment_p seg, AnnoSet_p annos,
+                                 PDArray_p fmap, PDArray_p cells)
+{
+   KBImageHeader_p hdr = seg->header;
+   TB_p            bank = annos->terms;
+   Sig_p           sig = bank->sig;
+   FunCode         f;
+   Term_p          t;
+   char            *name;
+   long            i, name_off, arity, sym, arg, node_no;
+   int             j;
+
+   for(i=0; i<hdr->sym_no; i++)
+   {
+      if(!code_get_long(seg, &name_off, LONG_MAX) ||
+         !code_get_long(seg, &arity, INT_MAX))
+      {
+         return false;
+      }
+      name = segment_str(seg, name_off);
+      if(!name)
+      {
+         return false;
+      }
+      f = SigFindFCode(sig, name);
+      if(f && (SigFindArity(sig, f) != arity))
+      {
+         return false;
+      }
+      if(!f)
+      {
+         f = SigInsertId(sig, name, arity, false);
+      }
+      PDArrayAssignInt(fmap, hdr->sym_base+i+1, f);
+   }
+   for(i=0; i<hdr->node_no; i++)
+   {
+      node_no = hdr->node_base+i;
+      if(!code_get_long(seg, &sym, hdr->sym_base+hdr->sym_no) || (sym < 1))
+      {
+         return false;
+      }
+      f = PDArrayElementInt(fmap, sym);
+      t = TermTopAlloc(f, SigFindArity(sig, f));
+      for(j=0; j<t->arity; j++)
+      {
+         if(!code_get_int(seg, &arg) || (arg > node_no) ||
+            (arg == 0) || (arg < -KB_IMAGE_MAX_VAR))
+         {
+            TermTopFree(t);
+            return false;
+         }
+         t->args[j] = (arg>0)?PDArrayElementP(cells, node_no-arg):
+            VarBankVarAssertAlloc(bank->vars, arg, SigDefaultSort(sig));
+      }
+      PDArrayAssignP(cells, node_no, TBTermTopInsert(bank, t));
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: segment_replay_annos()
+//
+//   Add the annotations of the segment to annos, where cells maps
+//   node numbers to terms. Return false if the segment is
+//   inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes annos and the cursor, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool segment_replay_annos(KBImageSegment_p seg, AnnoSet_p annos,
+                                 PDArray_p cells)
+{
+   KBImageHeader_p hdr = seg->header;
+   Annotation_p    tree = NULL, anno, conflict;
+   long            i, j, node = 0, delta, key, length, value_no = 0;
+   long            tree_node = -1;
+   double          value;
+
+   for(i=0; i<hdr->anno_no; i++)
+   {
+      if(!code_get_int(seg, &delta) ||
+         (node+delta < 0) || (node+delta >= hdr->node_base+hdr->node_no) ||
+         !code_get_long(seg, &key, LONG_MAX) ||
+         !code_get_long(seg, &length, KB_ANNOTATION_NO) ||
+         (length != KB_ANNOTATION_NO))
+      {
+         break;
+      }
+      node += delta;
+      if(tree && (node != tree_node))
+      {
+         AnnoSetAddTerm(annos, AnnoTermAlloc(PDArrayElementP(cells, tree_node),
+                                             tree));
+         tree = NULL;
+      }
+      tree_node = node;
+      anno = AnnotationAlloc();
+      anno->key = key;
+      for(j=0; j<length; j++)
+      {
+         if(!code_get_value(seg, &value))
+         {
+            break;
+         }
+         DDArrayAssign(AnnotationValues(anno), j, value);
+      }
+      AnnotationLength(anno) = length;
+      value_no += length;
+      conflict = NumTreeInsert(&tree, anno);
+      if(conflict)
+      {
+         AnnotationCombine(conflict, anno);
+         AnnotationFree(anno);
+      }
+      if(j<length)
+      {
+         break;
+      }
+   }
+   if(tree)
+   {
+      AnnoSetAddTerm(annos, AnnoTermAlloc(PDArrayElementP(cells, tree_node),
+                                          tree));
+   }
+   return (i == hdr->anno_no) && (value_no == hdr->value_no) &&
+      (seg->code == seg->code_end);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageAlloc()
+//
+//   Allocate an image descriptor for an empty image.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+KBImage_p KBImageAlloc(void)
+{
+   KBImage_p handle = KBImageCellAlloc();
+
+   handle->size       = 0;
+   handle->sym_no     = 0;
+   handle->node_no    = 0;
+   handle->sym_index  = PDIntArrayAlloc(64, 0);
+   handle->node_index = PDIntArrayAlloc(1024, 0);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageFree()
+//
+//   Free an image descriptor.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void KBImageFree(KBImage_p junk)
+{
+   PDArrayFree(junk->sym_index);
+   PDArrayFree(junk->node_index);
+   KBImageCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBIsBinary()
+//
+//   Return true if the knowledge base kb is stored in binary form.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool KBIsBinary(char* kb)
+{
+   DStr_p      name = DStrAlloc();
+   struct stat stat_buf;
+   bool        res;
+
+   res = (stat(KBFileName(name, kb, KB_IMAGE_NAME), &stat_buf) == 0);
+   DStrFree(name);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageLoad()
+//
+//   Map the image of kb and replay it into examples and annos (each
+//   of which may be NULL to skip that part). If image is given, it
+//   is set up to append to the image file later (this requires
+//   annos).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes examples, annos and the signature
+//                   and term bank of annos, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+void KBImageLoad(KBImage_p image, char* kb, ExampleSet_p examples,
+                 AnnoSet_p annos)
+{
+   KBImageSegmentCell seg;
+   DStr_p             name = DStrAlloc();
+   struct stat        stat_buf;
+   char               *map = NULL;
+   long               size = 0, pos = 0, sym_no = 0, node_no = 0, i;
+   PDArray_p          fmap, cells;
+   Term_p             t;
+   int                fd;
+
+   assert(!image || annos);
+
+   KBFileName(name, kb, KB_IMAGE_NAME);
+   fd = open(DStrView(name), O_RDONLY);
+   if(fd == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot open knowledge base image %s", FILE_ERROR,
+               DStrView(name));
+   }
+   if((fstat(fd, &stat_buf)!=0) || !S_ISREG(stat_buf.st_mode) ||
+      (stat_buf.st_size != (off_t)(long)stat_buf.st_size))
+   {
+      image_corrupt(DStrView(name));
+   }
+   size = stat_buf.st_size;
+   if(size)
+   {
+      map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(map == MAP_FAILED)
+      {
+         TmpErrno = errno;
+         SysError("Cannot map knowledge base image %s", FILE_ERROR,
+                  DStrView(name));
+      }
+   }
+   close(fd);
+
+   fmap  = PDIntArrayAlloc(64, 0);
+   cells = PDArrayAlloc(1024, 0);
+   while(pos < size)
+   {
+      if(!segment_init(&seg, map+pos, size-pos, sym_no, node_no) ||
+         !segment_replay_examples(&seg, examples) ||
+         (annos && !segment_replay_terms(&seg, annos, fmap, cells)) ||
+         (annos && !segment_replay_annos(&seg, annos, cells)))
+      {
+         image_corrupt(DStrView(name));
+      }
+      sym_no  += seg.header->sym_no;
+      node_no += seg.header->node_no;
+      pos     += seg.header->size;
+   }
+   if(map)
+   {
+      munmap(map, size);
+   }
+   if(image)
+   {
+      image->size    = size;
+      image->sym_no  = sym_no;
+      image->node_no = node_no;
+      for(i=1; i<=sym_no; i++)
+      {
+         PDArrayAssignInt(image->sym_index, PDArrayElementInt(fmap, i), i);
+      }
+      for(i=0; i<node_no; i++)
+      {
+         t = PDArrayElementP(cells, i);
+         PDArrayAssignInt(image->node_index, t->entry_no, i+1);
+      }
+   }
+   VERBOUTARG("Loaded knowledge base image ", DStrView(name));
+   PDArrayFree(fmap);
+   PDArrayFree(cells);
+   DStrFree(name);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageAppend()
+//
+//   Append a segment with the examples with ident at least
+//   first_ident and their annotations to the image of kb (which has
+//   to be in the state described by image). The old image is copied
+//   to a temporary file that replaces it once the new segment is
+//   complete, so that an interrupted append leaves the image
+//   unchanged. Return the number of annotations written.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes image, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+long KBImageAppend(KBImage_p image, char* kb, ExampleSet_p examples,
+                   AnnoSet_p annos, long first_ident)
+{
+   KBImageBuilderCell builder;
+   DStr_p             name = DStrAlloc(), tmpname = DStrAlloc();
+   struct stat        stat_buf;
+   FILE               *in, *out;
+   char               buffer[8192];
+   long               res, old_size = 0, copied = 0;
+   size_t             read;
+
+   KBFileName(name, kb, KB_IMAGE_NAME);
+   if(stat(DStrView(name), &stat_buf) == 0)
+   {
+      old_size = stat_buf.st_size;
+   }
+   if(old_size != image->size)
+   {
+      Error("%s: Knowledge base image changed since it was loaded",
+            FILE_ERROR, DStrView(name));
+   }
+   DStrAppendStr(tmpname, DStrView(name));
+   DStrAppendStr(tmpname, ".tmp");
+
+   builder_init(&builder);
+   res = builder_collect(&builder, image, examples, annos, first_ident);
+   if(res || PStackGetSP(builder.examples))
+   {
+      out = SecureFOpen(DStrView(tmpname), "w");
+      if(old_size)
+      {
+         in = SecureFOpen(DStrView(name), "r");
+         while((read = fread(buffer, 1, sizeof(buffer), in)))
+         {
+            write_block(out, buffer, read, DStrView(tmpname));
+            copied += read;
+         }
+         if(ferror(in))
+         {
+            TmpErrno = errno;
+            SysError("Cannot read knowledge base image %s", FILE_ERROR,
+                     DStrView(name));
+         }
+         SecureFClose(in);
+         if(copied != image->size)
+         {
+            Error("%s: Knowledge base image changed since it was loaded",
+                  FILE_ERROR, DStrView(name));
+         }
+      }
+      image->size += builder_write(&builder, image, out, DStrView(tmpname));
+      close_image(out, DStrView(tmpname));
+      if(rename(DStrView(tmpname), DStrView(name)))
+      {
+         TmpErrno = errno;
+         SysError("Cannot rename %s", FILE_ERROR, DStrView(tmpname));
+      }
+   }
+   builder_exit(&builder);
+   DStrFree(name);
+   DStrFree(tmpname);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageWrite()
+//
+//   Write a complete new image of examples and annos for kb,
+//   replacing any existing one. Return the number of annotations
+//   written.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may terminate with error
+//
+/----------------------------------------------------------------------*/
+
+long KBImageWrite(char* kb, ExampleSet_p examples, AnnoSet_p annos)
+{
+   KBImageBuilderCell builder;
+   KBImage_p          image = KBImageAlloc();
+   DStr_p             name = DStrAlloc(), tmpname = DStrAlloc();
+   FILE               *out;
+   long               res;
+
+   KBFileName(name, kb, KB_IMAGE_NAME);
+   DStrAppendStr(tmpname, DStrView(name));
+   DStrAppendStr(tmpname, ".tmp");
+
+   builder_init(&builder);
+   res = builder_collect(&builder, image, examples, annos, 0);
+   out = SecureFOpen(DStrView(tmpname), "w");
+   if(res || PStackGetSP(builder.examples))
+   {
+      builder_write(&builder, image, out, DStrView(tmpname));
+   }
+   close_image(out, DStrView(tmpname));
+   if(rename(DStrView(tmpname), DStrView(name)))
+   {
+      TmpErrno = errno;
+      SysError("Cannot rename %s", FILE_ERROR, DStrView(tmpname));
+   }
+   builder_exit(&builder);
+   KBImageFree(image);
+   DStrFree(name);
+   DStrFree(tmpname);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBExamplesLoad()
+//
+//   Read the examples and annotated clause patterns of kb into
+//   examples and annos (either of which may be NULL), from the image
+//   if the knowledge base is binary and from the text files
+//   otherwise. image (which may be NULL) is set up for appending to
+//   a binary knowledge base.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes examples, annos
+//
+/----------------------------------------------------------------------*/
+
+void KBExamplesLoad(char* kb, KBImage_p image, ExampleSet_p examples,
+                    AnnoSet_p annos)
+{
+   DStr_p    name;
+   Scanner_p in;
+
+   if(KBIsBinary(kb))
+   {
+      KBImageLoad(image, kb, examples, annos);
+      return;
+   }
+   name = DStrAlloc();
+   if(examples)
+   {
+      in = CreateScanner(StreamTypeFile,
+                         KBFileName(name, kb, "problems"),
+                         true, NULL);
+      ExampleSetParse(in, examples);
+      DestroyScanner(in);
+   }
+   if(annos)
+   {
+      in = CreateScanner(StreamTypeFile,
+                         KBFileName(name, kb, "clausepatterns"),
+                         true, NULL);
+      while(TestInpTok(in, TermStartToken))
+      {
+         AnnoSetAddTerm(annos,
+                        AnnoTermParse(in, annos->terms, KB_ANNOTATION_NO));
+      }
+      DestroyScanner(in);
+   }
+   DStrFree(name);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBExamplesStore()
+//
+//   Store the examples and annotated clause patterns back into kb. A
+//   binary knowledge base (loaded with image) only gets the examples
+//   with ident at least first_ident and their annotations appended,
+//   text files are rewritten completely.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void KBExamplesStore(char* kb, KBImage_p image, ExampleSet_p examples,
+                     AnnoSet_p annos, long first_ident)
+{
+   DStr_p name;
+   FILE   *out;
+
+   if(KBIsBinary(kb))
+   {
+      KBImageAppend(image, kb, examples, annos, first_ident);
+      return;
+   }
+   name = DStrAlloc();
+   out = OutOpen(KBFileName(name, kb, "clausepatterns"));
+   AnnoSetPrint(out, annos);
+   OutClose(out);
+
+   out = OutOpen(KBFileName(name, kb, "problems"));
+   ExampleSetPrint(out, examples);
+   OutClose(out);
+   DStrFree(name);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
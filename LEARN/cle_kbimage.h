@@ -0,0 +1,150 @@
+/*-----------------------------------------------------------------------
+
+File  : cle_kbimage.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Binary knowledge bases. Instead of the text files "problems" and
+  "clausepatterns", a binary knowledge base stores the example table
+  and the annotated clause patterns in a single image file. The
+  image is a sequence of segments, each written by a single
+  operation on the knowledge base. A segment contains the symbols
+  and shared term nodes that are new with respect to the earlier
+  segments, the new examples and the new annotations. Inserting
+  examples hence only appends a segment, and loading maps the file
+  into memory and replays the segments without any parsing. The
+  reserved symbols ("signature") and the description stay text
+  files, as they are edited by hand.
+
+  Counts and offsets are stored as variable-length integers, and
+  clause patterns as shared term nodes referring to their arguments
+  by (relative) node number, so that subterms common to several
+  patterns are stored once. The fixed-width header and example
+  records depend on the byte order of the machine that created the
+  image. It is rejected on mismatch.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 03:41:17 CEST 2026
+    New
+<2> Tue Oct 20 11:02:45 CEST 2026
+    32 bit records, version 2
+<3> Wed Oct 21 10:12:31 CEST 2026
+    Variable-length coding, version 3
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLE_KBIMAGE
+
+#define CLE_KBIMAGE
+
+#include <stdint.h>
+#include <cle_kbdesc.h>
+#include <cle_annoterms.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define KB_IMAGE_NAME    "image"
+#define KB_IMAGE_MAGIC   "E-KBIMAGE"
+#define KB_IMAGE_VERSION 3
+#define KB_IMAGE_BYTE_ORDER 0x0102030405060708LL
+
+/* Segments are aligned to KB_IMAGE_ALIGN bytes */
+
+#define KB_IMAGE_ALIGN   8
+
+/* Each segment consists of the header, followed by the example
+   records, the code section and the string pool (padded to align the
+   next segment). The code section holds, as variable-length
+   integers, the arity distributions of the examples, the new
+   symbols (name, arity), the new nodes (symbol and arguments) and
+   the annotations (node, key, length, values). Symbols and nodes
+   are numbered across segments, strings are offsets into the pool
+   of the same segment. */
+
+typedef struct kbimage_header_cell
+{
+   char    magic[16];
+   int64_t version;
+   int64_t byte_order;
+   int64_t size;       /* Of the segment in bytes, including header */
+   int64_t sym_base;   /* Number of symbols... */
+   int64_t node_base;  /* ...and nodes in earlier segments */
+   int64_t sym_no;
+   int64_t node_no;
+   int64_t example_no;
+   int64_t distrib_no;
+   int64_t anno_no;
+   int64_t value_no;
+   int64_t code_size;  /* In bytes */
+   int64_t str_size;
+}KBImageHeaderCell, *KBImageHeader_p;
+
+
+/* The arity distributions for predicates (0..pred_max_arity) and
+   functions (0..func_max_arity) of the examples follow each other
+   at the start of the code section. */
+
+typedef struct kbimage_example_cell
+{
+   int32_t ident;
+   int32_t name;
+   int32_t pred_max_arity;
+   int32_t func_max_arity;
+   double  features[FEATURE_NUMBER];
+}KBImageExampleCell, *KBImageExample_p;
+
+
+/* Correspondence between an in-memory knowledge base and its image
+   file, needed to append to the image. */
+
+typedef struct kbimage_cell
+{
+   long      size;       /* Of the image file */
+   long      sym_no;
+   long      node_no;
+   PDArray_p sym_index;  /* f_code -> symbol number, 0 if none */
+   PDArray_p node_index; /* entry_no -> node number+1, 0 if none */
+}KBImageCell, *KBImage_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define KBImageCellAlloc() (KBImageCell*)SizeMalloc(sizeof(KBImageCell))
+#define KBImageCellFree(junk)         SizeFree(junk, sizeof(KBImageCell))
+
+KBImage_p KBImageAlloc(void);
+void      KBImageFree(KBImage_p junk);
+
+bool      KBIsBinary(char* kb);
+
+void      KBImageLoad(KBImage_p image, char* kb, ExampleSet_p examples,
+                      AnnoSet_p annos);
+long      KBImageAppend(KBImage_p image, char* kb, ExampleSet_p examples,
+                        AnnoSet_p annos, long first_ident);
+long      KBImageWrite(char* kb, ExampleSet_p examples, AnnoSet_p annos);
+
+void      KBExamplesLoad(char* kb, KBImage_p image, ExampleSet_p examples,
+                         AnnoSet_p annos);
+void      KBExamplesStore(char* kb, KBImage_p image,
+                          ExampleSet_p examples, AnnoSet_p annos,
+                          long first_ident);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
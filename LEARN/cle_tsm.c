@@ -833,6 +833,9 @@ TSMAdmin_p TSMAdminAlloc(Sig_p sig, TSMType type)
    handle->tsm             = NULL;
    handle->subst           = NULL;
    handle->local_limit     = true;
+   handle->eval_cache      = NULL;
+   handle->eval_values     = DDArrayAlloc(1024, 1024);
+   handle->eval_cached     = 0;
    handle->emptytsm        = tsmbasealloc(handle, IndexEmpty, 0);
    if(handle->tsmtype == TSMTypeRecurrentLocal)
    {
@@ -888,6 +891,8 @@ void TSMAdminFree(TSMAdmin_p junk)
    }
    junk->index_bank->sig = NULL;
    TBFree(junk->index_bank);
+   NumTreeFree(junk->eval_cache);
+   DDArrayFree(junk->eval_values);
 
    /* subst is external! */
    TSMAdminCellFree(junk);
@@ -919,6 +924,7 @@ void TSMAdminBuildTSM(TSMAdmin_p admin, FlatAnnoSet_p set, IndexType
    assert(set);
    assert(type!=IndexNoIndex);
 
+   TSMEvalCacheReset(admin);
    admin->index_type = type;
    admin->index_depth = depth;
    admin->subst  = subst;
@@ -1218,6 +1224,75 @@ double TSMEvalTerm(TSMAdmin_p admin, Term_p term, PatternSubst_p subst)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TSMEvalCacheFind()
+//
+//   If an evaluation for key is cached, store it in *eval and return
+//   true, otherwise return false.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool TSMEvalCacheFind(TSMAdmin_p admin, long key, double *eval)
+{
+   NumTree_p cell = NumTreeFind(&(admin->eval_cache), key);
+
+   if(cell)
+   {
+      *eval = DDArrayElement(admin->eval_values, cell->val1.i_val);
+      return true;
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TSMEvalCacheStore()
+//
+//   Cache eval as the evaluation for key.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TSMEvalCacheStore(TSMAdmin_p admin, long key, double eval)
+{
+   IntOrP val1, val2;
+
+   val1.i_val = admin->eval_cached++;
+   val2.i_val = 0;
+   NumTreeStore(&(admin->eval_cache), key, val1, val2);
+   DDArrayAssign(admin->eval_values, val1.i_val, eval);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TSMEvalCacheReset()
+//
+//   Drop all cached evaluations (required whenever the TSM changes).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TSMEvalCacheReset(TSMAdmin_p admin)
+{
+   NumTreeFree(admin->eval_cache);
+   admin->eval_cache  = NULL;
+   admin->eval_cached = 0;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TSMComputeClassificationLimit()
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Aug  6 16:47:31 MET DST 1999
     New
+<2> Tue Oct 20 03:12:48 CEST 2026
+    Cache of evaluations of encoded clauses.
 
 -----------------------------------------------------------------------*/
 
@@ -58,6 +60,12 @@ typedef struct tsmadmincell
    PStack_p       tsmstack;
    PStack_p       cachestack;
    PatternSubst_p subst;
+   NumTree_p      eval_cache;  /* Key (usually the entry number of a
+                                  shared term) -> index into
+                                  eval_values. Only valid for the
+                                  current TSM. */
+   DDArray_p      eval_values;
+   long           eval_cached;
 }TSMAdminCell, *TSMAdmin_p;
 
 
@@ -127,6 +135,9 @@ void    TSAFree(TSA_p tsa);
 
 double  TSMEvalTerm(TSMAdmin_p admin, Term_p term, PatternSubst_p
           subst);
+bool    TSMEvalCacheFind(TSMAdmin_p admin, long key, double *eval);
+void    TSMEvalCacheStore(TSMAdmin_p admin, long key, double eval);
+void    TSMEvalCacheReset(TSMAdmin_p admin);
 double  TSMComputeClassificationLimit(TSMAdmin_p admin,  FlatAnnoSet_p
                   set);
 double TSMComputeAverageEval(TSMAdmin_p admin,  FlatAnnoSet_p set);
@@ -17,6 +17,8 @@ Changes
 
 <1> Tue Aug 31 13:47:43 MET DST 1999
     New
+<2> Tue Oct 20 04:02:55 CEST 2026
+    Read binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
@@ -294,14 +296,10 @@ double ExampleSetFromKB(AnnoSet_p annoset, FlatAnnoSet_p flatset, bool
             true, NULL);
    SigParse(in, sig, true);
    DestroyScanner(in);
-
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(filename, kb, "problems"),
-            true, NULL);
-   ExampleSetParse(in, proofexamples);
-   DestroyScanner(in);
    DStrFree(filename);
 
+   KBExamplesLoad(kb, NULL, proofexamples, NULL);
+
    if(flat_patterns)
    {
       AnnoSetRecToFlatEnc(bank, annoset);
@@ -331,21 +329,15 @@ TSMAdmin_p TSMFromKB(bool flat_patterns, double evalweights[], char*
            double set_part, double dist_part, IndexType
            indextype, TSMType tsmtype, long indexdepth)
 {
-   DStr_p         filename = DStrAlloc();
    AnnoSet_p      annoset;
    FlatAnnoSet_p  flatset = FlatAnnoSetAlloc();
    TB_p bank =    TBAlloc(sig);
    TSMAdmin_p     admin;
    PatternSubst_p subst;
-   Scanner_p      in;
    double         eval_default;
 
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(filename, kb, "clausepatterns"),
-            true, NULL);
-   annoset = AnnoSetParse(in, bank, KB_ANNOTATION_NO);
-   DestroyScanner(in);
-   DStrFree(filename);
+   annoset = AnnoSetAlloc(bank);
+   KBExamplesLoad(kb, NULL, NULL, annoset);
 
    eval_default = ExampleSetFromKB(annoset, flatset, flat_patterns,
                bank, evalweights, kb, sig, target,
@@ -18,6 +18,8 @@ Changes
 
 <1> Tue Aug 31 13:23:14 MET DST 1999
     New
+<2> Tue Oct 20 04:02:55 CEST 2026
+    Read binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
@@ -27,7 +29,7 @@ Changes
 
 #include <cle_examplerep.h>
 #include <cle_tsm.h>
-#include <cle_kbdesc.h>
+#include <cle_kbimage.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -43,6 +43,7 @@ char* TONames[]=
    "AutoSched5",
    "AutoSched6",
    "AutoSched7",
+   "AutoTable",
    "Optimize",
    "KBO",
    "KBO6",
@@ -51,7 +52,8 @@ char* TONames[]=
    "LPO4",
    "LPO4Copy",
    "RPO",
-   "Empty"
+   "Empty",
+   NULL
 };
 
 
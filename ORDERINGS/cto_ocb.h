@@ -48,6 +48,7 @@ typedef enum
    AUTOSCHED5,
    AUTOSCHED6,
    AUTOSCHED7,
+   AUTOTABLE,
    OPTIMIZE_AX,
    KBO,
    KBO6,
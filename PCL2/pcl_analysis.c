@@ -239,6 +239,7 @@ void PCLExprUpdateGRefs(PCLProt_p prot, PCLExpr_p expr, bool proofstep)
    case PCLOpEResolution:
    case PCLOpEFactoring:
    case PCLOpSplitClause:
+   case PCLOpSatRefutation:
          for(i=0; i<expr->arg_no; i++)
     {
             parent = PCLExprGetQuotedArg(prot,expr, i);
@@ -232,7 +232,8 @@ PCLExpr_p PCLExprParse(Scanner_p in, bool mini)
                  PCL_CONDENSE"|"PCL_RW"|"PCL_SR"|"PCL_CSR"|"PCL_ACRES"|"
                  PCL_CN"|"PCL_SPLIT"|"PCL_SC"|"PCL_SE"|"PCL_FS"|"
                  PCL_NNF"|"PCL_ID"|"PCL_AD"|"PCL_SQ"|"PCL_VR"|"
-                 PCL_SK"|"PCL_DSTR"|"PCL_ANNOQ"|"PCL_EVANS"|"PCL_NC  );
+                 PCL_SK"|"PCL_DSTR"|"PCL_ANNOQ"|"PCL_EVANS"|"PCL_NC"|"
+                 PCL_SATREF);
 
       if(TestInpId(in, PCL_EVALGC))
       {
@@ -359,6 +360,11 @@ PCLExpr_p PCLExprParse(Scanner_p in, bool mini)
     handle->op=PCLOpFOFAssumeNegation;
     arg_no=1;
       }
+      else if(TestInpId(in, PCL_SATREF))
+      {
+         handle->op=PCLOpSatRefutation;
+         arg_no=PCL_VAR_ARG;
+      }
       NextToken(in);
       if(arg_no)
       {
@@ -554,6 +560,10 @@ void PCLExprPrint(FILE* out, PCLExpr_p expr, bool mini)
          fprintf(out, PCL_NC);
          assert(expr->arg_no==1);
          break;
+   case PCLOpSatRefutation:
+         fprintf(out, PCL_SATREF);
+         assert(expr->arg_no>0);
+         break;
    default:
          assert(false && "Unknown PCL operator");
          break;
@@ -759,6 +769,11 @@ void PCLExprPrintTSTP(FILE* out, PCLExpr_p expr, bool mini)
          status = status_cth;
          assert(expr->arg_no==1);
          break;
+   case PCLOpSatRefutation:
+         fprintf(out, PCL_SATREF);
+         status = status_thm;
+         assert(expr->arg_no>0);
+         break;
 
    default:
     assert(false && "Unknown PCL operator");
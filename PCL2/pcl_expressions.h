@@ -68,6 +68,7 @@ typedef enum
    PCLOpFOFVarRename,
    PCLOpFOFSkolemize,
    PCLOpFOFAssumeNegation,
+   PCLOpSatRefutation,
    PCLOpMaxOp
 }PCLOpcodes;
 
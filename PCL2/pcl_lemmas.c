@@ -19,6 +19,8 @@ Changes
 
 <1> Mon Jun 16 13:06:20 CEST 2003
     New
+<2> Mon Oct 19 02:51:16 CEST 2026
+    Incremental proof sizes over a topologically ordered DAG
 
 -----------------------------------------------------------------------*/
 
@@ -26,6 +28,18 @@ Changes
 
 
 
+/* The parts of the lemma rating of a step that do not depend on its
+   proof size */
+
+typedef struct lemma_rating_cell
+{
+   double refs;    /* Reference factor */
+   long   size;    /* Size divisor */
+   bool   horn;    /* Horn bonus applies */
+   bool   zero;    /* Rating is always 0 */
+}LemmaRatingCell, *LemmaRating_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
@@ -40,6 +54,381 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_rating_init()
+//
+//   Compute the parts of the lemma rating of step that do not depend
+//   on the size of its proof.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void lemma_rating_init(LemmaRating_p rating, PCLStep_p step,
+                              LemmaParam_p params)
+{
+   rating->refs = 0;
+   rating->size = 1;
+   rating->horn = false;
+   rating->zero = true;
+
+   if(PCLStepQueryProp(step, PCLIsFOFStep))
+   {
+      return;
+   }
+   rating->refs =
+      1.0+
+      params->tree_base_weight +
+      step->active_pm_refs        * params->act_pm_w +
+      step->other_generating_refs * params->o_gen_w +
+      step->active_simpl_refs     * params->act_simpl_w +
+      step->passive_simpl_refs    * params->pas_simpl_w;
+   rating->size =
+      params->size_base_weight+ClauseStandardWeight(step->logic.clause);
+   rating->horn = ClauseIsHorn(step->logic.clause);
+
+   if((step->passive_simpl_refs || step->pure_quote_refs)
+      &&
+      !(step->active_pm_refs+step->other_generating_refs+step->active_simpl_refs) )
+   {
+      return;
+   }
+   rating->zero = ClauseIsTrivial(step->logic.clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_rating_eval()
+//
+//   Return the lemma rating for a step with the given proof size.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static float lemma_rating_eval(LemmaRating_p rating, long proof_size,
+                               LemmaParam_p params)
+{
+   float res;
+
+   if(rating->zero)
+   {
+      return 0;
+   }
+   res = rating->refs*(1.0+proof_size)/rating->size;
+   if(rating->horn)
+   {
+      res = res*params->horn_bonus;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_find_step_index()
+//
+//   Find the position of the step with identifier id in the ordered
+//   in_order stack of a protocol by binary search. Return -1 if there
+//   is no such step.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long lemma_find_step_index(PStack_p in_order, PCLId_p id)
+{
+   long lo = 0, hi = PStackGetSP(in_order)-1, mid;
+   int  cmp;
+   PCLStep_p step;
+
+   while(lo <= hi)
+   {
+      mid  = lo+(hi-lo)/2;
+      step = PStackElementP(in_order, mid);
+      cmp  = PCLIdCompare(step->id, id);
+      if(cmp < 0)
+      {
+         lo = mid+1;
+      }
+      else if(cmp > 0)
+      {
+         hi = mid-1;
+      }
+      else
+      {
+         return mid;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_expr_collect_refs()
+//
+//   Push the in_order positions of all steps referenced by expr onto
+//   refs (once per reference) and return the weight of the inferences
+//   in expr itself (i.e. PCLExprProofSize() without the contribution
+//   of the referenced steps).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long lemma_expr_collect_refs(PCLProt_p prot, PCLExpr_p expr,
+                                    InferenceWeight_p iw, PStack_p refs)
+{
+   long res = 0, i, idx;
+
+   if(expr->op == PCLOpQuote)
+   {
+      idx = lemma_find_step_index(prot->in_order, PCLExprArg(expr,0));
+      if(idx == -1)
+      {
+         PCLExprPrint(stderr, expr, false); fprintf(stderr, "  ");
+         Error("Reference to non-existing step", SYNTAX_ERROR);
+      }
+      PStackPushInt(refs, idx);
+   }
+   else if(expr->op == PCLOpInitial)
+   {
+      res = (*iw)[expr->op];
+   }
+   else
+   {
+      res = (*iw)[expr->op];
+      for(i=0; i<expr->arg_no; i++)
+      {
+         res += lemma_expr_collect_refs(prot, PCLExprArg(expr,i), iw, refs);
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_invert_edges()
+//
+//   Given a graph with n nodes in compressed form (the successors of
+//   node i are edge[start[i]]...edge[start[i+1]-1]), return the
+//   inverted graph in the same form in *inv_start and *inv_edge.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lemma_invert_edges(long n, long *start, long *edge,
+                               long **inv_start, long **inv_edge)
+{
+   long i, j, *istart, *iedge, *fill;
+
+   istart = SizeMalloc((n+1)*sizeof(long));
+   iedge  = SizeMalloc((start[n]+1)*sizeof(long));
+   fill   = SizeMalloc((n+1)*sizeof(long));
+   memset(istart, 0, (n+1)*sizeof(long));
+
+   for(j=0; j<start[n]; j++)
+   {
+      istart[edge[j]+1]++;
+   }
+   for(i=0; i<n; i++)
+   {
+      istart[i+1] += istart[i];
+   }
+   memcpy(fill, istart, (n+1)*sizeof(long));
+   for(i=0; i<n; i++)
+   {
+      for(j=start[i]; j<start[i+1]; j++)
+      {
+         iedge[fill[edge[j]]++] = i;
+      }
+   }
+   SizeFree(fill, (n+1)*sizeof(long));
+   *inv_start = istart;
+   *inv_edge  = iedge;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_topo_order()
+//
+//   Return an array with the nodes 0..n-1 of the graph described by
+//   the parent lists (start, par) and child lists (cstart, child) in
+//   topological order (parents first). If the numbering already is
+//   topological (the normal case for PCL protocols), it is kept.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, terminates with an error on
+//                   cyclic protocols.
+//
+/----------------------------------------------------------------------*/
+
+static long* lemma_topo_order(long n, long *start, long *par,
+                              long *cstart, long *child)
+{
+   long i, j, head, tail, *order, *indeg;
+   bool ordered = true;
+
+   order = SizeMalloc((n+1)*sizeof(long));
+   for(i=0; i<n && ordered; i++)
+   {
+      for(j=start[i]; j<start[i+1]; j++)
+      {
+         if(par[j] >= i)
+         {
+            ordered = false;
+            break;
+         }
+      }
+   }
+   if(ordered)
+   {
+      for(i=0; i<n; i++)
+      {
+         order[i] = i;
+      }
+      return order;
+   }
+   indeg = SizeMalloc((n+1)*sizeof(long));
+   tail  = 0;
+   for(i=0; i<n; i++)
+   {
+      indeg[i] = start[i+1]-start[i];
+      if(!indeg[i])
+      {
+         order[tail++] = i;
+      }
+   }
+   for(head=0; head<tail; head++)
+   {
+      i = order[head];
+      for(j=cstart[i]; j<cstart[i+1]; j++)
+      {
+         if(!(--indeg[child[j]]))
+         {
+            order[tail++] = child[j];
+         }
+      }
+   }
+   SizeFree(indeg, (n+1)*sizeof(long));
+   if(tail != n)
+   {
+      Error("Cyclic dependencies in PCL protocol", SYNTAX_ERROR);
+   }
+   return order;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_weights_monotone()
+//
+//   Return true if no weight or parameter is negative. In this case
+//   proof sizes can only shrink when new lemmas are selected, and so
+//   can lemma qualities.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool lemma_weights_monotone(LemmaParam_p params, InferenceWeight_p iw)
+{
+   int i;
+
+   for(i=0; i<PCLOpMaxOp; i++)
+   {
+      if((*iw)[i] < 0)
+      {
+         return false;
+      }
+   }
+   return params->tree_base_weight >= 0 &&
+      params->act_pm_w >= 0 &&
+      params->o_gen_w >= 0 &&
+      params->act_simpl_w >= 0 &&
+      params->pas_simpl_w >= 0 &&
+      params->size_base_weight >= 0 &&
+      params->horn_bonus >= 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_heap_better()
+//
+//   Return true if candidate a is a better lemma than candidate b: It
+//   has a higher lemma quality, or the same quality and comes first
+//   in the protocol.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool lemma_heap_better(float *quality, long *rank, long a, long b)
+{
+   return (quality[a] > quality[b]) ||
+      ((quality[a] == quality[b]) && (rank[a] < rank[b]));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lemma_heap_down()
+//
+//   Move the element at position i of the (best-first) binary heap
+//   of candidates with size elements down until the heap property is
+//   restored.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static void lemma_heap_down(float *quality, long *rank, long *heap,
+                            long size, long i)
+{
+   long cand = heap[i], child;
+
+   while((child = 2*i+1) < size)
+   {
+      if(child+1 < size &&
+         lemma_heap_better(quality, rank, heap[child+1], heap[child]))
+      {
+         child++;
+      }
+      if(!lemma_heap_better(quality, rank, heap[child], cand))
+      {
+         break;
+      }
+      heap[i] = heap[child];
+      i = child;
+   }
+   heap[i] = cand;
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -174,6 +563,19 @@ void PCLExprUpdateRefs(PCLProt_p prot, PCLExpr_p expr)
             PCLExprUpdateRefs(prot, PCLExprArg(expr,0));
          }
     break;
+   case PCLOpSatRefutation:
+         for(i=0; i < expr->arg_no; i++)
+         {
+            if((handle = PCLExprGetQuotedArg(prot,expr,i)))
+            {
+               handle->other_generating_refs++;
+            }
+            else
+            {
+               PCLExprUpdateRefs(prot, PCLExprArg(expr,i));
+            }
+         }
+         break;
    case PCLOpSimplifyReflect:
    case PCLOpACResolution:
    case PCLOpRewrite:
@@ -430,65 +832,330 @@ void PCLProtComputeProofSize(PCLProt_p prot, InferenceWeight_p iw,
 
 /*-----------------------------------------------------------------------
 //
-// Function: PCLStepComputeLemmaWeight()
+// Function: PCLLemmaDAGAlloc()
 //
-//   Compute the lemma quality of a PCL step based on the information
-//   stored in it.
+//   Build the derivation graph of prot, with the inference weights
+//   from iw. Proof sizes are not computed.
 //
 // Global Variables: -
 //
-// Side Effects    : Caches the result in step->lemma_quality
+// Side Effects    : Memory operations, serializes prot.
 //
 /----------------------------------------------------------------------*/
 
-float PCLStepComputeLemmaWeight(PCLProt_p prot, PCLStep_p step,
-            LemmaParam_p params)
+PCLLemmaDAG_p PCLLemmaDAGAlloc(PCLProt_p prot, InferenceWeight_p iw)
 {
-   float res;
+   PCLLemmaDAG_p dag = PCLLemmaDAGCellAlloc();
+   PStack_p      refs = PStackAlloc();
+   PCLStep_p     step;
+   long          n, i, j, t, edges;
+   long          *start, *base, *par, *cstart, *child, *order, *pos;
 
-   if(PCLStepQueryProp(step, PCLIsFOFStep))
+   PCLProtSerialize(prot);
+   n = PStackGetSP(prot->in_order);
+
+   /* Graph in protocol order */
+   start = SizeMalloc((n+1)*sizeof(long));
+   base  = SizeMalloc((n+1)*sizeof(long));
+   for(i=0; i<n; i++)
    {
-      res = 0;
+      start[i] = PStackGetSP(refs);
+      step     = PStackElementP(prot->in_order, i);
+      assert(step->just);
+      base[i]  = lemma_expr_collect_refs(prot, step->just, iw, refs);
    }
-   else
+   start[n] = PStackGetSP(refs);
+   edges    = start[n];
+   par      = SizeMalloc((edges+1)*sizeof(long));
+   for(j=0; j<edges; j++)
+   {
+      par[j] = PStackElementInt(refs, j);
+   }
+   PStackFree(refs);
+   lemma_invert_edges(n, start, par, &cstart, &child);
+   order = lemma_topo_order(n, start, par, cstart, child);
+   pos   = SizeMalloc((n+1)*sizeof(long));
+   for(t=0; t<n; t++)
    {
-      res =
-         (1.0+
-          params->tree_base_weight +
-          step->active_pm_refs        * params->act_pm_w +
-          step->other_generating_refs * params->o_gen_w +
-          step->active_simpl_refs     * params->act_simpl_w +
-          step->passive_simpl_refs    * params->pas_simpl_w)
-         *
-         (1.0+
-          step->proof_tree_size
-            )
-         /
-         (params->size_base_weight+ClauseStandardWeight(step->logic.clause));
-
-      if(ClauseIsHorn(step->logic.clause))
+      pos[order[t]] = t;
+   }
+
+   /* Renumber into topological order */
+   dag->step_no     = n;
+   dag->steps       = SizeMalloc((n+1)*sizeof(PCLStep_p));
+   dag->rank        = order;
+   dag->base        = SizeMalloc((n+1)*sizeof(long));
+   dag->par_start   = SizeMalloc((n+1)*sizeof(long));
+   dag->par         = SizeMalloc((edges+1)*sizeof(long));
+   dag->child_start = SizeMalloc((n+1)*sizeof(long));
+   dag->child       = SizeMalloc((edges+1)*sizeof(long));
+   dag->size        = SizeMalloc((n+1)*sizeof(long));
+   dag->lemmas      = BitSetAlloc(n);
+   dag->delta       = SizeMalloc((n+1)*sizeof(long));
+   dag->pending     = BitSetAlloc(n);
+   dag->first_pending = n;
+   dag->overflow      = false;
+   memset(dag->delta, 0, (n+1)*sizeof(long));
+
+   dag->par_start[0]   = 0;
+   dag->child_start[0] = 0;
+   for(t=0; t<n; t++)
+   {
+      i = order[t];
+      dag->steps[t] = PStackElementP(prot->in_order, i);
+      dag->base[t]  = base[i];
+      dag->size[t]  = PCLNoWeight;
+      if(PCLStepQueryProp(dag->steps[t], PCLIsLemma))
+      {
+         BitSetInsert(dag->lemmas, t);
+      }
+      dag->par_start[t+1] = dag->par_start[t];
+      for(j=start[i]; j<start[i+1]; j++)
       {
-         res = res*params->horn_bonus;
+         dag->par[dag->par_start[t+1]++] = pos[par[j]];
       }
+      dag->child_start[t+1] = dag->child_start[t];
+      for(j=cstart[i]; j<cstart[i+1]; j++)
+      {
+         dag->child[dag->child_start[t+1]++] = pos[child[j]];
+      }
+   }
+   SizeFree(start, (n+1)*sizeof(long));
+   SizeFree(base, (n+1)*sizeof(long));
+   SizeFree(par, (edges+1)*sizeof(long));
+   SizeFree(cstart, (n+1)*sizeof(long));
+   SizeFree(child, (edges+1)*sizeof(long));
+   SizeFree(pos, (n+1)*sizeof(long));
+
+   return dag;
+}
+
 
-      if((step->passive_simpl_refs || step->pure_quote_refs)
-         &&
-         !(step->active_pm_refs+step->other_generating_refs+step->active_simpl_refs) )
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGFree()
+//
+//   Free a derivation graph (but not the steps).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PCLLemmaDAGFree(PCLLemmaDAG_p junk)
+{
+   long n = junk->step_no, edges = junk->par_start[junk->step_no];
+
+   SizeFree(junk->steps, (n+1)*sizeof(PCLStep_p));
+   SizeFree(junk->rank, (n+1)*sizeof(long));
+   SizeFree(junk->base, (n+1)*sizeof(long));
+   SizeFree(junk->par_start, (n+1)*sizeof(long));
+   SizeFree(junk->par, (edges+1)*sizeof(long));
+   SizeFree(junk->child_start, (n+1)*sizeof(long));
+   SizeFree(junk->child, (edges+1)*sizeof(long));
+   SizeFree(junk->size, (n+1)*sizeof(long));
+   BitSetFree(junk->lemmas);
+   SizeFree(junk->delta, (n+1)*sizeof(long));
+   BitSetFree(junk->pending);
+   PCLLemmaDAGCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGStepProofSize()
+//
+//   Compute, store and return the proof tree size of step i of dag
+//   from the (already computed) sizes of its parents, with lemmas
+//   contributing 0. Sizes wrap around on overflow (as in
+//   PCLExprProofSize()), but this is recorded in dag->overflow.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets the size in dag and proof_tree_size in the
+//                   step.
+//
+/----------------------------------------------------------------------*/
+
+long PCLLemmaDAGStepProofSize(PCLLemmaDAG_p dag, long i)
+{
+   long res = dag->base[i], j, parent;
+
+   for(j=dag->par_start[i]; j<dag->par_start[i+1]; j++)
+   {
+      parent = dag->par[j];
+      assert(dag->size[parent] != PCLNoWeight);
+      if(!PCLLemmaDAGIsLemma(dag, parent) &&
+         __builtin_add_overflow(res, dag->size[parent], &res))
       {
-         res = 0;
+         dag->overflow = true;
       }
-      else
+   }
+   dag->size[i] = res;
+   dag->steps[i]->proof_tree_size = res;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGComputeProofSize()
+//
+//   Compute the proof tree sizes of all steps in dag in a single
+//   pass, with lemmas contributing 0. This is the equivalent of
+//   PCLProtComputeProofSize() with use_lemmas set.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets proof_tree_size in all steps.
+//
+/----------------------------------------------------------------------*/
+
+void PCLLemmaDAGComputeProofSize(PCLLemmaDAG_p dag)
+{
+   long i;
+
+   for(i=0; i<dag->step_no; i++)
+   {
+      PCLLemmaDAGStepProofSize(dag, i);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGSetLemma()
+//
+//   Mark step i of dag as a lemma. Its proof no longer contributes to
+//   the proofs of its children. The resulting size changes are only
+//   recorded and applied by PCLLemmaDAGPropagate().
+//
+// Global Variables: -
+//
+// Side Effects    : Sets PCLIsLemma, records pending changes.
+//
+/----------------------------------------------------------------------*/
+
+void PCLLemmaDAGSetLemma(PCLLemmaDAG_p dag, long i)
+{
+   long j, c;
+
+   assert(!PCLLemmaDAGIsLemma(dag, i));
+   PCLLemmaDAGMarkLemma(dag, i);
+
+   for(j=dag->child_start[i]; j<dag->child_start[i+1]; j++)
+   {
+      c = dag->child[j];
+      dag->delta[c] -= dag->size[i];
+      BitSetInsert(dag->pending, c);
+      dag->first_pending = MIN(dag->first_pending, c);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGPropagate()
+//
+//   Apply all pending proof size changes. Steps are visited in
+//   topological order, and a change is passed on to the children of
+//   a step unless the step is a lemma. Only descendants of new lemmas
+//   are touched. If changed is not NULL, add all steps with a new
+//   proof size to it. Returns the number of those steps. The steps
+//   themselves are not updated (see PCLLemmaDAGStoreProofSize()).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes sizes in dag.
+//
+/----------------------------------------------------------------------*/
+
+long PCLLemmaDAGPropagate(PCLLemmaDAG_p dag, BitSet_p changed)
+{
+   long i, j, c, d, res = 0;
+
+   for(i = BitSetNextElement(dag->pending, dag->first_pending);
+       i != -1;
+       i = BitSetNextElement(dag->pending, i+1))
+   {
+      BitSetDelete(dag->pending, i);
+      d = dag->delta[i];
+      dag->delta[i] = 0;
+      if(!d)
       {
-         if(ClauseIsTrivial(step->logic.clause))
-         {
-            res = 0;
-         }
+         continue;
+      }
+      dag->size[i] += d;
+      res++;
+      if(changed)
+      {
+         BitSetInsert(changed, i);
+      }
+      if(PCLLemmaDAGIsLemma(dag, i))
+      {
+         continue;
+      }
+      for(j=dag->child_start[i]; j<dag->child_start[i+1]; j++)
+      {
+         c = dag->child[j];
+         dag->delta[c] += d;
+         BitSetInsert(dag->pending, c);
       }
    }
-   step->lemma_quality = res;
+   dag->first_pending = dag->step_no;
    return res;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLLemmaDAGStoreProofSize()
+//
+//   Copy the proof sizes from dag into the proof_tree_size fields of
+//   the steps.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the steps
+//
+/----------------------------------------------------------------------*/
+
+void PCLLemmaDAGStoreProofSize(PCLLemmaDAG_p dag)
+{
+   long i;
+
+   for(i=0; i<dag->step_no; i++)
+   {
+      dag->steps[i]->proof_tree_size = dag->size[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLStepComputeLemmaWeight()
+//
+//   Compute the lemma quality of a PCL step based on the information
+//   stored in it.
+//
+// Global Variables: -
+//
+// Side Effects    : Caches the result in step->lemma_quality
+//
+/----------------------------------------------------------------------*/
+
+float PCLStepComputeLemmaWeight(PCLProt_p prot, PCLStep_p step,
+            LemmaParam_p params)
+{
+   LemmaRatingCell rating;
+
+   lemma_rating_init(&rating, step, params);
+   step->lemma_quality = lemma_rating_eval(&rating, step->proof_tree_size,
+                                           params);
+   return step->lemma_quality;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: PCLProtComputeLemmaWeights()
@@ -530,9 +1197,9 @@ PCLStep_p PCLProtComputeLemmaWeights(PCLProt_p prot, LemmaParam_p params)
 //
 //   Mark all lemmas in procol which have a lemma rating of at least
 //   quality_limit, but not more than max_number. Goes from first to
-//   last step, taking already marked lemmas into account. Assumes
-//   topologically ordered protocol (otherwise lemma ratings might be
-//   off). Returns number of lemmas found.
+//   last step, taking already marked lemmas into account. Steps are
+//   visited in topological order, which is the protocol order for
+//   all normal protocols. Returns number of lemmas found.
 //
 // Global Variables: -
 //
@@ -545,21 +1212,23 @@ long PCLProtSeqFindLemmas(PCLProt_p prot, LemmaParam_p params,
            InferenceWeight_p iw, long max_number,
            float quality_limit)
 {
-   PStackPointer i;
+   long i;
    PCLStep_p step;
+   PCLLemmaDAG_p dag;
    long res = 0;
 
    PCLProtSerialize(prot);
    PCLProtResetTreeData(prot, false);
    PCLProtUpdateRefs(prot);
+   dag = PCLLemmaDAGAlloc(prot, iw);
 
-   for(i=0; i<PStackGetSP(prot->in_order); i++)
+   for(i=0; i<dag->step_no; i++)
    {
-      step = PStackElementP(prot->in_order, i);
-      PCLStepProofSize(prot, step, iw, true);
+      step = dag->steps[i];
+      PCLLemmaDAGStepProofSize(dag, i);
       if(PCLStepComputeLemmaWeight(prot, step, params) >= quality_limit)
       {
-    PCLStepSetProp(step, PCLIsLemma);
+    PCLLemmaDAGMarkLemma(dag, i);
     res++;
     if(res > max_number)
     {
@@ -567,6 +1236,7 @@ long PCLProtSeqFindLemmas(PCLProt_p prot, LemmaParam_p params,
     }
       }
    }
+   PCLLemmaDAGFree(dag);
    return res;
 }
 
@@ -580,6 +1250,16 @@ long PCLProtSeqFindLemmas(PCLProt_p prot, LemmaParam_p params,
 //   of lemmas found. Terminate if max_number lemmas have
 //   been found or quality drops below quality limit.
 //
+//   Only the proof sizes of the descendants of the new lemma change,
+//   and only their ratings need to be updated. Candidates are kept in
+//   a heap ordered by lemma quality (ties are broken by protocol
+//   order). If qualities can only decrease (see
+//   lemma_weights_monotone(), and proof sizes must not have
+//   overflowed), outdated ratings are upper bounds and are only
+//   recomputed once a step reaches the top of the heap. Otherwise all
+//   changed ratings are updated at once, and the best candidate is
+//   found by a linear scan over the (compact) ratings.
+//
 // Global Variables: -
 //
 // Side Effects    : Changes lemma weights.
@@ -590,22 +1270,104 @@ long PCLProtRecFindLemmas(PCLProt_p prot, LemmaParam_p params,
              InferenceWeight_p iw, long max_number,
              float quality_limit)
 {
-   long i;
-   PCLStep_p lemma = NULL;
+   long i, j, best, size;
+   long *heap;
+   float *quality;
+   LemmaRating_p ratings;
+   bool lazy;
+   PCLLemmaDAG_p dag;
+   BitSet_p changed;
 
    PCLProtResetTreeData(prot, false);
    PCLProtUpdateRefs(prot);
+   dag = PCLLemmaDAGAlloc(prot, iw);
+   PCLLemmaDAGComputeProofSize(dag);
+   lazy = lemma_weights_monotone(params, iw) && !dag->overflow;
+
+   size    = dag->step_no;
+   changed = BitSetAlloc(size);
+   ratings = SizeMalloc((size+1)*sizeof(LemmaRatingCell));
+   quality = SizeMalloc((size+1)*sizeof(float));
+   heap    = SizeMalloc((size+1)*sizeof(long));
+   for(j=0; j<size; j++)
+   {
+      lemma_rating_init(&(ratings[j]), dag->steps[j], params);
+      quality[j] = lemma_rating_eval(&(ratings[j]),
+                                     dag->size[j], params);
+      heap[j] = j;
+   }
+   if(lazy)
+   {
+      for(j=size/2-1; j>=0; j--)
+      {
+         lemma_heap_down(quality, dag->rank, heap, size, j);
+      }
+   }
+
    for(i=0; i<max_number; i++)
    {
-      PCLProtResetTreeData(prot, true);
-      PCLProtComputeProofSize(prot, iw, true);
-      lemma = PCLProtComputeLemmaWeights(prot, params);
-      if(!lemma || (lemma->lemma_quality < quality_limit))
+      PCLLemmaDAGPropagate(dag, changed);
+      best = -1;
+      if(lazy)
+      {
+         while(size && BitSetQuery(changed, heap[0]))
+         {
+            j = heap[0];
+            BitSetDelete(changed, j);
+            quality[j] = lemma_rating_eval(&(ratings[j]),
+                                           dag->size[j],
+                                           params);
+            lemma_heap_down(quality, dag->rank, heap, size, 0);
+         }
+         if(size)
+         {
+            best = heap[0];
+            size--;
+            heap[0] = heap[size];
+            lemma_heap_down(quality, dag->rank, heap, size, 0);
+         }
+      }
+      else
+      {
+         BitSetForEach(changed, j)
+         {
+            quality[j] = lemma_rating_eval(&(ratings[j]),
+                                           dag->size[j],
+                                           params);
+         }
+         BitSetClearAll(changed);
+         for(j=0; j<dag->step_no; j++)
+         {
+            if(!PCLLemmaDAGIsLemma(dag, j) &&
+               (best == -1 || lemma_heap_better(quality, dag->rank, j, best)))
+            {
+               best = j;
+            }
+         }
+      }
+      if(best == -1 || (quality[best] < quality_limit))
       {
     break;
       }
-      PCLStepSetProp(lemma, PCLIsLemma);
+      PCLLemmaDAGSetLemma(dag, best);
+   }
+   /* Bring the remaining ratings up to date */
+   BitSetForEach(changed, j)
+   {
+      quality[j] = lemma_rating_eval(&(ratings[j]),
+                                     dag->size[j], params);
    }
+   for(j=0; j<dag->step_no; j++)
+   {
+      dag->steps[j]->lemma_quality = quality[j];
+   }
+   PCLLemmaDAGStoreProofSize(dag);
+   SizeFree(ratings, (dag->step_no+1)*sizeof(LemmaRatingCell));
+   SizeFree(quality, (dag->step_no+1)*sizeof(float));
+   SizeFree(heap, (dag->step_no+1)*sizeof(long));
+   BitSetFree(changed);
+   PCLLemmaDAGFree(dag);
+
    return i;
 }
 
@@ -26,6 +26,7 @@ Changes
 
 #define PCL_LEMMAS
 
+#include <clb_bitsets.h>
 #include <pcl_protocol.h>
 
 /*---------------------------------------------------------------------*/
@@ -89,6 +90,37 @@ typedef long InferenceWeightType[PCLOpMaxOp];
 typedef InferenceWeightType *InferenceWeight_p;
 
 
+/* The derivation graph of a protocol, used to maintain proof tree
+   sizes (with lemmas contributing 0 to the proofs of their
+   descendants) incrementally while lemmas are selected. Sizes and
+   lemma status are kept in arrays indexed by step. Steps are numbered
+   in topological order (parents before children), and parent and
+   child references are stored in compressed arrays (the parents of
+   step i are par[par_start[i]]...par[par_start[i+1]-1], children
+   analogously). A step referenced several times by the same
+   inference has several entries, as it contributes several times to
+   the unfolded proof tree. */
+
+typedef struct pcl_lemma_dag_cell
+{
+   long      step_no;
+   PCLStep_p *steps;       /* In topological order */
+   long      *rank;        /* Position of steps[i] in prot->in_order */
+   long      *base;        /* Weight of the inferences of steps[i] */
+   long      *par_start;
+   long      *par;
+   long      *child_start;
+   long      *child;
+   long      *size;        /* Proof tree sizes */
+   BitSet_p  lemmas;
+   long      *delta;       /* Pending proof size changes... */
+   BitSet_p  pending;      /* ...for these steps */
+   long      first_pending;
+   bool      overflow;     /* Some proof size exceeded LONG_MAX */
+}PCLLemmaDAGCell, *PCLLemmaDAG_p;
+
+
+
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
@@ -121,6 +153,23 @@ long PCLStepProofSize(PCLProt_p prot, PCLStep_p step, InferenceWeight_p iw,
 void PCLProtComputeProofSize(PCLProt_p prot, InferenceWeight_p iw,
               bool use_lemmas);
 
+#define PCLLemmaDAGCellAlloc() \
+        (PCLLemmaDAGCell*)SizeMalloc(sizeof(PCLLemmaDAGCell))
+#define PCLLemmaDAGCellFree(junk) SizeFree(junk, sizeof(PCLLemmaDAGCell))
+
+PCLLemmaDAG_p PCLLemmaDAGAlloc(PCLProt_p prot, InferenceWeight_p iw);
+void          PCLLemmaDAGFree(PCLLemmaDAG_p junk);
+long          PCLLemmaDAGStepProofSize(PCLLemmaDAG_p dag, long i);
+void          PCLLemmaDAGComputeProofSize(PCLLemmaDAG_p dag);
+void          PCLLemmaDAGSetLemma(PCLLemmaDAG_p dag, long i);
+long          PCLLemmaDAGPropagate(PCLLemmaDAG_p dag, BitSet_p changed);
+void          PCLLemmaDAGStoreProofSize(PCLLemmaDAG_p dag);
+
+#define PCLLemmaDAGIsLemma(dag, i) BitSetQuery((dag)->lemmas, (i))
+#define PCLLemmaDAGMarkLemma(dag, i) \
+        (BitSetInsert((dag)->lemmas, (i)),\
+         PCLStepSetProp((dag)->steps[(i)], PCLIsLemma))
+
 float PCLStepComputeLemmaWeight(PCLProt_p prot, PCLStep_p step,
             LemmaParam_p params);
 PCLStep_p PCLProtComputeLemmaWeights(PCLProt_p prot, LemmaParam_p params);
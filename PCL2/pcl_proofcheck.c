@@ -19,6 +19,9 @@ Changes
 
 <1> Mon Apr  3 23:02:28 GMT 2000
     New
+<2> Mon Oct 19 23:20:14 CEST 2026
+    Parallel checking with a bounded number of prover processes,
+    identical check problems are only run once.
 
 -----------------------------------------------------------------------*/
 
@@ -45,15 +48,16 @@ Changes
 // Function: pcl_run_prover()
 //
 //   Execute command and scan the output for success. If found, return
-//   true, else return false;
+//   true, else return false. The prover transcript (if requested by
+//   OutputLevel) goes to out.
 //
-// Global Variables:
+// Global Variables: OutputLevel
 //
-// Side Effects    :
+// Side Effects    : Runs a process, output
 //
 /----------------------------------------------------------------------*/
 
-static bool pcl_run_prover(char* command, char*success)
+static bool pcl_run_prover(FILE* out, char* command, char*success)
 {
    bool   res=false;
    char   line[180],*l;
@@ -61,7 +65,7 @@ static bool pcl_run_prover(char* command, char*success)
 
    if(OutputLevel>1)
    {
-      fprintf(GlobalOut, "# Running %s\n", command);
+      fprintf(out, "# Running %s\n", command);
    }
    ppipe=popen(command, "r");
    if(!ppipe)
@@ -77,7 +81,7 @@ static bool pcl_run_prover(char* command, char*success)
       }
       if(OutputLevel >= 3)
       {
-    fprintf(GlobalOut, "#> %s", line);
+    fprintf(out, "#> %s", line);
       }
    }
    pclose(ppipe);
@@ -85,24 +89,43 @@ static bool pcl_run_prover(char* command, char*success)
    return res;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_print_problem()
+//
+//   Print the problem file name (for a failed check).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_print_problem(FILE* out, char* name)
+{
+   fprintf(out, "# ------------Problem begin--------------\n");
+   FilePrint(out, name);
+   fprintf(out, "# ------------Problem end----------------\n");
+}
+
 /*-----------------------------------------------------------------------
 //
-// Function: pcl_verify_eprover()
+// Function: pcl_prepare_eprover()
 //
-//   Run E on the problem, return true if a proof is found.
+//   Write the problem to the file name and the command to run E on
+//   it to command. Return the string that indicates a proof.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, by subroutines.
+// Side Effects    : Output, memory operations
 //
 /----------------------------------------------------------------------*/
 
-static bool pcl_verify_eprover(ClauseSet_p problem,char *executable,
-                long time_limit)
+static char* pcl_prepare_eprover(ClauseSet_p problem,char *executable,
+                                 long time_limit, char* name,
+                                 DStr_p command)
 {
-   bool   res;
-   DStr_p command = DStrAlloc();
-   char*  name=TempFileName();
    FILE*  problemfile;
 
    assert(OutputFormat == TPTPFormat);
@@ -122,19 +145,7 @@ static bool pcl_verify_eprover(ClauseSet_p problem,char *executable,
    DStrAppendChar(command, ' ');
    DStrAppendStr(command, name);
 
-   res = pcl_run_prover(DStrView(command),"# Proof found!");
-
-   if(!res)
-   {
-      fprintf(GlobalOut, "# ------------Problem begin--------------\n");
-      FilePrint(GlobalOut, name);
-      fprintf(GlobalOut, "# ------------Problem end----------------\n");
-   }
-
-   TempFileRemove(name);
-   FREE(name);
-   DStrFree(command);
-   return res;
+   return "# Proof found!";
 }
 
 
@@ -261,22 +272,21 @@ static void clause_set_print_otter(FILE* out, ClauseSet_p set)
 
 /*-----------------------------------------------------------------------
 //
-// Function: pcl_verify_otter()
+// Function: pcl_prepare_otter()
 //
-//   Run Otter on the problem, return true if a proof is found.
+//   Write the problem to the file name and the command to run Otter
+//   on it to command. Return the string that indicates a proof.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, by subroutines.
+// Side Effects    : Output, memory operations
 //
 /----------------------------------------------------------------------*/
 
-static bool pcl_verify_otter(ClauseSet_p problem,char *executable,
-              long time_limit)
+static char* pcl_prepare_otter(ClauseSet_p problem,char *executable,
+                               long time_limit, char* name,
+                               DStr_p command)
 {
-   bool   res;
-   DStr_p command = DStrAlloc();
-   char*  name=TempFileName();
    FILE*  problemfile;
 
    if(!executable)
@@ -307,19 +317,7 @@ static bool pcl_verify_otter(ClauseSet_p problem,char *executable,
    DStrAppendStr(command, name);
    DStrAppendStr(command, " 2> /dev/null");
 
-   res = pcl_run_prover(DStrView(command), "-------- PROOF --------");
-
-   if(!res)
-   {
-      fprintf(GlobalOut, "# ------------Problem begin--------------\n");
-      FilePrint(GlobalOut, name);
-      fprintf(GlobalOut, "# ------------Problem end----------------\n");
-   }
-
-   TempFileRemove(name);
-   FREE(name);
-   DStrFree(command);
-   return res;
+   return "-------- PROOF --------";
 }
 
 
@@ -501,22 +499,21 @@ static void clause_set_print_dfg(FILE* out, ClauseSet_p set)
 
 /*-----------------------------------------------------------------------
 //
-// Function: pcl_verify_spass()
+// Function: pcl_prepare_spass()
 //
-//   Run SPASS on the problem, return true if a proof is found.
+//   Write the problem to the file name and the command to run SPASS
+//   on it to command. Return the string that indicates a proof.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, by subroutines.
+// Side Effects    : Output, memory operations
 //
 /----------------------------------------------------------------------*/
 
-static bool pcl_verify_spass(ClauseSet_p problem,char *executable,
-              long time_limit, Sig_p sig)
+static char* pcl_prepare_spass(ClauseSet_p problem,char *executable,
+                               long time_limit, Sig_p sig, char* name,
+                               DStr_p command)
 {
-   bool   res;
-   DStr_p command = DStrAlloc();
-   char*  name=TempFileName();
    FILE*  problemfile;
 
    if(!executable)
@@ -542,18 +539,363 @@ static bool pcl_verify_spass(ClauseSet_p problem,char *executable,
    DStrAppendStr(command, " ");
    DStrAppendStr(command, name);
 
-   res = pcl_run_prover(DStrView(command), "Proof found.");
+   return "Proof found.";
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_prepare_check()
+//
+//   Write the check problem for prover to the file name and the
+//   command to check it to command. Return the string indicating
+//   success (or NULL if prover is not supported).
+//
+// Global Variables: -
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_prepare_check(PCLProt_p prot, ClauseSet_p problem,
+                               ProverType prover, char* executable,
+                               long time_limit, char* name,
+                               DStr_p command)
+{
+   switch(prover)
+   {
+   case EProver:
+         return pcl_prepare_eprover(problem, executable, time_limit,
+                                    name, command);
+   case Otter:
+         return pcl_prepare_otter(problem, executable, time_limit,
+                                  name, command);
+   case Spass:
+         return pcl_prepare_spass(problem, executable, time_limit,
+                                  prot->terms->sig, name, command);
+   default:
+         assert(false && "Not yet implemented");
+         break;
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_job_compare()
+//
+//   Total ordering on check jobs that is 0 exactly for jobs with the
+//   same premises and the same conclusion literals. Clauses parsed
+//   from a protocol share variables by name, so variant clauses as
+//   printed by E consist of identical literals.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int pcl_check_job_compare(const void* j1, const void* j2)
+{
+   const PCLCheckJob_p job1 = (const PCLCheckJob_p)j1;
+   const PCLCheckJob_p job2 = (const PCLCheckJob_p)j2;
+   PStackPointer i;
+   Eqn_p         lit1, lit2;
+   int           res;
+
+   res = PStackGetSP(job1->parents) - PStackGetSP(job2->parents);
+   for(i=0; !res && i<PStackGetSP(job1->parents); i++)
+   {
+      res = PCmp(PStackElementP(job1->parents, i),
+                 PStackElementP(job2->parents, i));
+   }
+   lit1 = job1->step->logic.clause->literals;
+   lit2 = job2->step->logic.clause->literals;
+   while(!res && lit1 && lit2)
+   {
+      res = PCmp(lit1->lterm, lit2->lterm);
+      if(!res)
+      {
+         res = PCmp(lit1->rterm, lit2->rterm);
+      }
+      if(!res)
+      {
+         res = (int)EqnIsPositive(lit1) - (int)EqnIsPositive(lit2);
+      }
+      lit1 = lit1->next;
+      lit2 = lit2->next;
+   }
    if(!res)
    {
-      fprintf(GlobalOut, "# ------------Problem begin--------------\n");
-      FilePrint(GlobalOut, name);
-      fprintf(GlobalOut, "# ------------Problem end----------------\n");
+      res = (lit1!=NULL) - (lit2!=NULL);
    }
+   return res;
+}
 
-   TempFileRemove(name);
-   FREE(name);
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_job_init()
+//
+//   Initialize job for checking step. Steps that need no prover run
+//   are done immediately. For the others, find an earlier job with
+//   the same check problem in cache, or enter job into cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_check_job_init(PCLProt_p prot, PCLCheckJob_p job,
+                               PCLStep_p step, PTree_p *cache)
+{
+   PTree_p       tree = NULL;
+   PCLCheckJob_p old;
+   PStackPointer i;
+
+   job->step         = step;
+   job->parents      = NULL;
+   job->same_as      = NULL;
+   job->res          = CheckFail;
+   job->done         = false;
+   job->problem_name = NULL;
+   job->log_name     = NULL;
+   job->pid          = 0;
+   job->usecs        = 0;
+
+   if(step->just->op==PCLOpSplitClause)
+   {
+      job->res  = CheckNotImplemented;
+      job->done = true;
+      return;
+   }
+   job->parents = PStackAlloc();
+   PCLExprCollectPreconds(prot, step->just, &tree);
+   PTreeToPStack(job->parents, tree);
+   PTreeFree(tree);
+
+   for(i=0; i<PStackGetSP(job->parents); i++)
+   {
+      if(PCLStepIsClausal((PCLStep_p)PStackElementP(job->parents, i)))
+      {
+         break;
+      }
+   }
+   if(i==PStackGetSP(job->parents))
+   {
+      /* Initial step, or no clausal premises (see PCLGenerateCheck()) */
+      job->res  = CheckByAssumption;
+      job->done = true;
+      return;
+   }
+   if(PCLStepIsClausal(step))
+   {
+      old = PTreeObjStore(cache, job, pcl_check_job_compare);
+      if(old)
+      {
+         job->same_as = old;
+         job->done    = true;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_job_start()
+//
+//   Write the check problem of job and run the prover on it. If
+//   parallel is true, the prover is run in a child process and true
+//   is returned, otherwise the job is done on return (and false is
+//   returned).
+//
+// Global Variables: OutputLevel
+//
+// Side Effects    : Output, runs processes, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool pcl_check_job_start(PCLProt_p prot, PCLCheckJob_p job,
+                                ProverType prover, char* executable,
+                                long time_limit, bool parallel)
+{
+   ClauseSet_p problem;
+   DStr_p      command = DStrAlloc();
+   char        *success;
+   FILE        *out;
+   bool        res;
+
+   job->problem_name = TempFileName();
+   if(OutputLevel>1)
+   {
+      job->log_name = TempFileName();
+   }
+   problem = PCLGenerateCheck(prot, job->step);
+   success = pcl_prepare_check(prot, problem, prover, executable,
+                               time_limit, job->problem_name, command);
+   ClauseSetFree(problem);
+
+   job->start = GetUSecTime();
+   if(parallel)
+   {
+      fflush(GlobalOut);
+      job->pid = fork();
+      if(job->pid == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot fork prover process", SYS_ERROR);
+      }
+   }
+   if(!parallel || !job->pid)
+   {
+      res = false;
+      if(success)
+      {
+         out = job->log_name?OutOpen(job->log_name):GlobalOut;
+         res = pcl_run_prover(out, DStrView(command), success);
+         if(job->log_name)
+         {
+            OutClose(out);
+         }
+      }
+      if(parallel)
+      {
+         _exit(res?EXIT_SUCCESS:EXIT_FAILURE);
+      }
+      job->res   = res?CheckOk:CheckFail;
+      job->usecs = GetUSecTime()-job->start;
+      job->done  = true;
+   }
    DStrFree(command);
-   return res;
+
+   return parallel;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_job_reap()
+//
+//   Wait for one of the prover processes of jobs[first..last) to
+//   finish and record its result.
+//
+// Global Variables: -
+//
+// Side Effects    : Waits for a child process
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_check_job_reap(PCLCheckJob_p jobs, long first, long last)
+{
+   pid_t pid;
+   int   status;
+   long  i;
+
+   do
+   {
+      pid = waitpid(-1, &status, 0);
+   }while(pid == -1 && errno == EINTR);
+   if(pid == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot wait for prover process", SYS_ERROR);
+   }
+   for(i=first; i<last; i++)
+   {
+      if(jobs[i].pid == pid && !jobs[i].done)
+      {
+         jobs[i].res   = (WIFEXITED(status) &&
+                          WEXITSTATUS(status) == EXIT_SUCCESS)?
+            CheckOk:CheckFail;
+         jobs[i].usecs = GetUSecTime()-jobs[i].start;
+         jobs[i].done  = true;
+         break;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_job_report()
+//
+//   Print the result of a finished job, clean up its files and data.
+//   Return the result.
+//
+// Global Variables: OutputLevel
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PCLCheckType pcl_check_job_report(PCLCheckJob_p job)
+{
+   assert(job->done);
+
+   if(job->same_as)
+   {
+      job->res = job->same_as->res;
+   }
+   if(OutputLevel)
+   {
+      fprintf(GlobalOut, "# Checking ");
+      PCLStepPrint(GlobalOut, job->step);
+      fputc('\n', GlobalOut);
+   }
+   if(job->log_name)
+   {
+      FilePrint(GlobalOut, job->log_name);
+      TempFileRemove(job->log_name);
+      FREE(job->log_name);
+   }
+   if(job->problem_name)
+   {
+      if(job->res == CheckFail)
+      {
+         pcl_print_problem(GlobalOut, job->problem_name);
+      }
+      TempFileRemove(job->problem_name);
+      FREE(job->problem_name);
+   }
+   switch(job->res)
+   {
+   case CheckByAssumption:
+         OUTPRINT(1,"# Checked (by assumption)\n\n");
+         break;
+   case CheckOk:
+         if(job->same_as)
+         {
+            OUTPRINT(1,"# Checked (by prover, same problem as an "
+                     "earlier step)\n\n");
+         }
+         else if(OutputLevel)
+         {
+            fprintf(GlobalOut, "# Checked (by prover, %.3f s)\n\n",
+                    job->usecs/1000000.0);
+         }
+         break;
+   case CheckFail:
+         if(job->same_as)
+         {
+            OUTPRINT(1,"# FAILED (same problem as an earlier step)\n\n");
+         }
+         else if(OutputLevel)
+         {
+            fprintf(GlobalOut, "# FAILED (%.3f s)\n\n",
+                    job->usecs/1000000.0);
+         }
+         break;
+   case CheckNotImplemented:
+         OUTPRINT(1,"# Check not implemented, assuming true!\n\n");
+         break;
+   default:
+         assert(false);
+         break;
+   }
+   fflush(GlobalOut);
+   return job->res;
 }
 
 
@@ -697,6 +1039,8 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
 {
    ClauseSet_p problem;
    PCLCheckType res=CheckFail;
+   DStr_p      command;
+   char        *name, *success;
 
    if(step->just->op==PCLOpSplitClause)
    {
@@ -707,34 +1051,26 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
    {
       return CheckByAssumption;
    }
-   else
+   name    = TempFileName();
+   command = DStrAlloc();
+   success = pcl_prepare_check(prot, problem, prover, executable,
+                               time_limit, name, command);
+   ClauseSetFree(problem);
+   if(success)
    {
-      switch(prover)
+      if(pcl_run_prover(GlobalOut, DStrView(command), success))
+      {
+         res = CheckOk;
+      }
+      else
       {
-      case EProver:
-       if(pcl_verify_eprover(problem,executable,time_limit))
-       {
-          res = CheckOk;
-       }
-       break;
-      case Otter:
-       if(pcl_verify_otter(problem,executable,time_limit))
-       {
-          res = CheckOk;
-       }
-       break;
-      case Spass:
-       if(pcl_verify_spass(problem,executable,time_limit,prot->terms->sig))
-       {
-          res = CheckOk;
-       }
-       break;
-      default:
-       assert(false && "Not yet implemented");
-       break;
+         pcl_print_problem(GlobalOut, name);
       }
-      ClauseSetFree(problem);
    }
+   TempFileRemove(name);
+   FREE(name);
+   DStrFree(command);
+
    return res;
 }
 
@@ -743,68 +1079,95 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
 //
 // Function: PCLProtCheck()
 //
-//   Check all steps in a PCL listing. Return number of successful
+//   Check all steps in a PCL listing, running up to jobs prover
+//   processes in parallel. Steps with the same check problem as an
+//   earlier step are not checked again. Results are printed in step
+//   order as soon as they are available. Return number of successful
 //   steps.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Output, runs processes
 //
 /----------------------------------------------------------------------*/
 
 long PCLProtCheck(PCLProt_p prot, ProverType prover, char* executable,
-        long time_limit, long *unchecked)
+        long time_limit, int jobs, long *unchecked)
 {
-   PStack_p      trav_stack,stack = PStackAlloc();
-   PStackPointer i;
-   PTree_p       cell;
-   PCLStep_p     step;
-   long          res=0;
-   PCLCheckType  check;
+   PStack_p      trav_stack, steps = PStackAlloc();
+   PTree_p       cell, cache = NULL;
+   PCLCheckJob_p job_array;
+   long          res=0, job_no, i, next_start, next_report;
+   int           running = 0;
+
+   assert(jobs >= 1);
 
    *unchecked = 0;
+   job_no     = prot->number;
+   job_array  = SizeMalloc((job_no+1)*sizeof(PCLCheckJobCell));
+
+   /* Finding premises reorganizes prot->steps, so collect the steps
+      first */
    trav_stack = PTreeTraverseInit(prot->steps);
    while((cell=PTreeTraverseNext(trav_stack)))
    {
-      step=cell->key;
-      PStackPushP(stack, step);
+      PStackPushP(steps, cell->key);
    }
    PTreeTraverseExit(trav_stack);
+   assert(PStackGetSP(steps) == job_no);
+
+   for(i=0; i<job_no; i++)
+   {
+      pcl_check_job_init(prot, &(job_array[i]), PStackElementP(steps, i),
+                         &cache);
+   }
+   PStackFree(steps);
 
-   for(i=0; i<PStackGetSP(stack); i++)
+   next_start = next_report = 0;
+   while(next_report < job_no)
    {
-      step = PStackElementP(stack,i);
-      if(OutputLevel)
+      while(running < jobs && next_start < job_no)
+      {
+         if(!job_array[next_start].done)
+         {
+            running += pcl_check_job_start(prot, &(job_array[next_start]),
+                                           prover, executable,
+                                           time_limit, jobs > 1);
+         }
+         next_start++;
+      }
+      while(next_report < job_no && job_array[next_report].done)
+      {
+         switch(pcl_check_job_report(&(job_array[next_report])))
+         {
+         case CheckByAssumption:
+         case CheckOk:
+               res++;
+               break;
+         case CheckNotImplemented:
+               (*unchecked)++;
+               break;
+         default:
+               break;
+         }
+         next_report++;
+      }
+      if(running)
       {
-    fprintf(GlobalOut, "# Checking ");
-    PCLStepPrint(GlobalOut, step);
-    fputc('\n', GlobalOut);
+         pcl_check_job_reap(job_array, next_report, next_start);
+         running--;
       }
-      check = PCLStepCheck(prot, step, prover, executable,
-            time_limit);
-      switch(check)
+   }
+   for(i=0; i<job_no; i++)
+   {
+      if(job_array[i].parents)
       {
-      case CheckByAssumption:
-       OUTPRINT(1,"# Checked (by assumption)\n\n");
-       res++;
-       break;
-      case CheckOk:
-       OUTPRINT(1,"# Checked (by prover)\n\n");
-       res++;
-       break;
-      case CheckFail:
-       OUTPRINT(1,"# FAILED\n\n");
-       break;
-      case CheckNotImplemented:
-       OUTPRINT(1,"# Check not implemented, assuming true!\n\n");
-       (*unchecked)++;
-       break;
-      default:
-       assert(false);
-       break;
+         PStackFree(job_array[i].parents);
       }
    }
-   PStackFree(stack);
+   PTreeFree(cache);
+   SizeFree(job_array, (job_no+1)*sizeof(PCLCheckJobCell));
+
    return res;
 }
 
@@ -26,6 +26,8 @@ Changes
 
 #define PCL_PROOFCHECK
 
+#include <sys/types.h>
+#include <sys/wait.h>
 #include <cio_tempfile.h>
 #include <pcl_protocol.h>
 
@@ -51,6 +53,24 @@ typedef enum
 }ProverType;
 
 
+/* State of the check of a single step in PCLProtCheck() */
+
+typedef struct pclcheckjobcell
+{
+   PCLStep_p               step;
+   PStack_p                parents;  /* Premises, ordered by address */
+   struct pclcheckjobcell* same_as;  /* Earlier job with the same
+                                        check problem, or NULL */
+   PCLCheckType            res;
+   bool                    done;
+   char*                   problem_name;
+   char*                   log_name; /* Prover transcript, if printed */
+   pid_t                   pid;
+   long long               start;
+   long long               usecs;
+}PCLCheckJobCell, *PCLCheckJob_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -68,7 +88,7 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
            prover, char* executable, long time_limit);
 
 long PCLProtCheck(PCLProt_p prot, ProverType
-        prover, char* executable, long time_limit, long*
+        prover, char* executable, long time_limit, int jobs, long*
         unchecked);
 
 #endif
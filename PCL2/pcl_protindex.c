@@ -0,0 +1,845 @@
+/*-----------------------------------------------------------------------
+
+File  : pcl_protindex.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Index-based two-phase reading of PCL protocols. See the header file
+  for an overview.
+
+  The first phase does not use the scanner. It relies on the regular
+  structure of PCL steps (<id> : <type> : <clause/formula> : <just>
+  [: <extra>]), tracking only nesting depth and quoted strings to find
+  the top-level colons. Steps start with a line that (after blanks)
+  starts with a digit, comment lines are skipped.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 22:41:07 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "pcl_protindex.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Context for sorting step indices with qsort() */
+
+static PCLProtIndex_p sort_index = NULL;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_skip_blanks()
+//
+//   Return a pointer to the first character at or after p that is not
+//   a blank (newlines are not skipped).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_index_skip_blanks(char* p, char* end)
+{
+   while(p<end && (*p==' ' || *p=='\t' || *p=='\r'))
+   {
+      p++;
+   }
+   return p;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_skip_line()
+//
+//   Return a pointer to the start of the line after the one
+//   containing p (or end).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_index_skip_line(char* p, char* end)
+{
+   char *nl = memchr(p, '\n', end-p);
+
+   return nl?nl+1:end;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_skip_string()
+//
+//   p points to a quote character. Return a pointer behind the
+//   matching closing quote (or end).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_index_skip_string(char* p, char* end)
+{
+   char quote = *p;
+
+   for(p++; p<end && *p!=quote; p++)
+   {
+      if(*p=='\\')
+      {
+         p++;
+      }
+   }
+   return (p<end)?p+1:end;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_skip_group()
+//
+//   p points to an opening parenthesis. Return a pointer behind the
+//   matching closing parenthesis (or end).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_index_skip_group(char* p, char* end)
+{
+   long depth = 0;
+
+   while(p<end)
+   {
+      switch(*p)
+      {
+      case '"':
+      case '\'':
+            p = pcl_index_skip_string(p, end);
+            continue;
+      case '(':
+            depth++;
+            break;
+      case ')':
+            depth--;
+            if(!depth)
+            {
+               return p+1;
+            }
+            break;
+      default:
+            break;
+      }
+      p++;
+   }
+   return end;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_parse_id()
+//
+//   Parse a PCL identifier starting at *p (which has to be a digit)
+//   into the id pool of index, advance *p behind it, and return its
+//   offset in the pool.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long pcl_index_parse_id(PCLProtIndex_p index, char** p, char* end)
+{
+   long  res = PStackGetSP(index->id_pool), val;
+   char* s = *p;
+
+   assert(isdigit(*s));
+   while(true)
+   {
+      for(val=0; s<end && isdigit(*s); s++)
+      {
+         val = 10*val+(*s-'0');
+      }
+      PStackPushInt(index->id_pool, val);
+      if(s+1<end && *s=='.' && isdigit(s[1]))
+      {
+         s++;
+      }
+      else
+      {
+         break;
+      }
+   }
+   PStackPushInt(index->id_pool, NO_PCL_ID_ELEMENT);
+   *p = s;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_id_compare()
+//
+//   Compare the identifiers at the two pool offsets in the same order
+//   as PCLIdCompare().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int pcl_index_id_compare(PStack_p pool, long id1, long id2)
+{
+   long e1, e2;
+
+   while(true)
+   {
+      e1 = PStackElementInt(pool, id1++);
+      e2 = PStackElementInt(pool, id2++);
+      if(e1 != e2)
+      {
+         return (e1<e2)?-1:1;
+      }
+      if(e1 == NO_PCL_ID_ELEMENT)
+      {
+         return 0;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_step_compare()
+//
+//   qsort() comparison function for step indices (in sort_index) by
+//   identifier.
+//
+// Global Variables: sort_index
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int pcl_index_step_compare(const void* s1, const void* s2)
+{
+   const long *i1 = s1, *i2 = s2;
+
+   return pcl_index_id_compare(sort_index->id_pool,
+                               sort_index->steps[*i1].id,
+                               sort_index->steps[*i2].id);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_find()
+//
+//   Return the index of the step with the identifier at pool offset
+//   id, or -1 if there is none. by_id contains the step indices
+//   sorted by identifier.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long pcl_index_find(PCLProtIndex_p index, long* by_id, long id)
+{
+   long lo = 0, hi = index->step_no-1, mid;
+   int  cmp;
+
+   while(lo <= hi)
+   {
+      mid = (lo+hi)/2;
+      cmp = pcl_index_id_compare(index->id_pool, id,
+                                 index->steps[by_id[mid]].id);
+      if(cmp == 0)
+      {
+         return by_id[mid];
+      }
+      if(cmp < 0)
+      {
+         hi = mid-1;
+      }
+      else
+      {
+         lo = mid+1;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_is_extract()
+//
+//   Return true if the "extra" annotation in [start,end) marks a
+//   root for extraction (see PCLStepExtract()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool pcl_index_is_extract(char* start, char* end)
+{
+   char buf[16];
+   long len = MIN(end-start, (long)sizeof(buf)-1);
+
+   if(len <= 0)
+   {
+      return false;
+   }
+   memcpy(buf, start, len);
+   buf[len] = '\0';
+
+   return PCLStepExtract(buf);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_new_step()
+//
+//   Append a new step entry to index and return it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PCLIndexStep_p pcl_index_new_step(PCLProtIndex_p index)
+{
+   if(index->step_no == index->size)
+   {
+      index->size  = index->size?2*index->size:1024;
+      index->steps = SecureRealloc(index->steps,
+                                   index->size*sizeof(PCLIndexStepCell));
+   }
+   return &(index->steps[index->step_no++]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_index_scan_step()
+//
+//   Scan the step starting at p (which points to the first digit of
+//   its identifier), record it in index, and return a pointer behind
+//   it. The step ends at the first newline outside of any nesting
+//   after which a new step or a comment starts.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* pcl_index_scan_step(PCLProtIndex_p index, char* p, char* end)
+{
+   PCLIndexStep_p step = pcl_index_new_step(index);
+   int   field = 0, last = ':';
+   long  depth = 0;
+   bool  is_clause = false;
+   char  *logic = NULL, *extra = NULL, *q, *step_end;
+
+   step->stream  = PStackGetSP(index->streams)-1;
+   step->text    = p;
+   step->id      = pcl_index_parse_id(index, &p, end);
+   step->parents = PStackGetSP(index->parents);
+
+   while(p<end)
+   {
+      if(*p=='"' || *p=='\'')
+      {
+         p = pcl_index_skip_string(p, end);
+         last = '"';
+         continue;
+      }
+      if(*p=='\n')
+      {
+         if(!depth)
+         {
+            q = pcl_index_skip_blanks(p+1, end);
+            if(q==end || isdigit(*q) || isstartcomment(*q))
+            {
+               break;
+            }
+         }
+         p++;
+         continue;
+      }
+      if(field==3 && isdigit(*p) && (last=='(' || last==',' || last==':'))
+      {
+         /* Reference to a parent step, maybe with a position */
+         PStackPushInt(index->parents, pcl_index_parse_id(index, &p, end));
+         q = pcl_index_skip_blanks(p, end);
+         if(q<end && *q=='(')
+         {
+            p = pcl_index_skip_group(q, end);
+         }
+         last = '0';
+         continue;
+      }
+      if(field==3 && isstartidchar(*p))
+      {
+         for(q=p; q<end && isidchar(*q); q++)
+         {
+            /* Just skip */
+         }
+         if(q-p==7 && strncmp(p, "initial", 7)==0)
+         {
+            q = pcl_index_skip_blanks(q, end);
+            if(q<end && *q=='(')
+            {
+               q = pcl_index_skip_group(q, end);
+            }
+         }
+         p    = q;
+         last = 'a';
+         continue;
+      }
+      switch(*p)
+      {
+      case '(':
+      case '[':
+            depth++;
+            break;
+      case ')':
+      case ']':
+            depth--;
+            break;
+      case ':':
+            /* Colons after quantifier variable lists belong to the
+               formula */
+            if(!depth && !(field==2 && !is_clause && last==']'))
+            {
+               field++;
+               if(field==2)
+               {
+                  logic = pcl_index_skip_blanks(p+1, end);
+                  is_clause = (logic<end && *logic=='[');
+               }
+               else if(field==3 && is_clause)
+               {
+                  q = pcl_index_skip_blanks(logic+1, end);
+                  if(q<end && *q==']')
+                  {
+                     index->empty_clause = true;
+                  }
+               }
+               else if(field==4)
+               {
+                  extra = p+1;
+               }
+               last = ':';
+               p++;
+               continue;
+            }
+            break;
+      default:
+            break;
+      }
+      if(!isspace(*p))
+      {
+         last = *p;
+      }
+      p++;
+   }
+   for(step_end=p; step_end>step->text && isspace(step_end[-1]); step_end--)
+   {
+      /* Strip trailing white space */
+   }
+   step->len = step_end-step->text;
+   if(depth)
+   {
+      /* Unbalanced brackets, the step (and the rest of the input)
+         can only be diagnosed by the parser */
+      index->malformed = true;
+   }
+   if(extra)
+   {
+      extra = pcl_index_skip_blanks(extra, step_end);
+      if(pcl_index_is_extract(extra, step_end))
+      {
+         PStackPushInt(index->roots, index->step_no-1);
+      }
+   }
+   return p;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexAlloc()
+//
+//   Return an empty protocol index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+PCLProtIndex_p PCLProtIndexAlloc(void)
+{
+   PCLProtIndex_p handle = PCLProtIndexCellAlloc();
+
+   handle->streams      = PStackAlloc();
+   handle->step_no      = 0;
+   handle->size         = 0;
+   handle->steps        = NULL;
+   handle->id_pool      = PStackAlloc();
+   handle->parents      = PStackAlloc();
+   handle->roots        = PStackAlloc();
+   handle->resolved     = false;
+   handle->empty_clause = false;
+   handle->malformed    = false;
+   handle->unresolved   = 0;
+   handle->reachable    = NULL;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexFree()
+//
+//   Free a protocol index and close its inputs.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, closes files
+//
+/----------------------------------------------------------------------*/
+
+void PCLProtIndexFree(PCLProtIndex_p junk)
+{
+   while(!PStackEmpty(junk->streams))
+   {
+      DestroyStream(PStackPopP(junk->streams));
+   }
+   PStackFree(junk->streams);
+   if(junk->steps)
+   {
+      FREE(junk->steps);
+   }
+   if(junk->id_pool)
+   {
+      PStackFree(junk->id_pool);
+   }
+   PStackFree(junk->parents);
+   PStackFree(junk->roots);
+   if(junk->reachable)
+   {
+      BitSetFree(junk->reachable);
+   }
+   PCLProtIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexAddFile()
+//
+//   Open the named file ("-" is stdin) and add all its steps to the
+//   index (phase 1). Regular files are mapped into memory, other
+//   input is read completely. Return the number of steps found.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long PCLProtIndexAddFile(PCLProtIndex_p index, char* name)
+{
+   Stream_p stream;
+   char     *p, *end;
+   long     old_no = index->step_no;
+
+   assert(!index->resolved);
+
+   stream = CreateStream(StreamTypeFile, name, true);
+   StreamReadAll(stream);
+   PStackPushP(index->streams, stream);
+
+   p   = StreamCurrPtr(stream);
+   end = p+StreamAvail(stream);
+
+   while(p<end)
+   {
+      p = pcl_index_skip_blanks(p, end);
+      if(p<end && isdigit(*p))
+      {
+         p = pcl_index_scan_step(index, p, end);
+      }
+      else
+      {
+         p = pcl_index_skip_line(p, end);
+      }
+   }
+   return index->step_no-old_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexResolve()
+//
+//   Replace the identifiers in the parent graph by step indices
+//   (references to unknown steps become -1 and are counted in
+//   index->unresolved). The id pool is freed afterwards. Fails with
+//   an error on duplicate identifiers.
+//
+// Global Variables: sort_index
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PCLProtIndexResolve(PCLProtIndex_p index)
+{
+   long          *by_id, i, target;
+   bool          sorted = true;
+   PStackPointer j;
+
+   assert(!index->resolved);
+
+   by_id = SizeMalloc((index->step_no+1)*sizeof(long));
+   for(i=0; i<index->step_no; i++)
+   {
+      by_id[i] = i;
+      if(i && pcl_index_id_compare(index->id_pool,
+                                   index->steps[i-1].id,
+                                   index->steps[i].id) >= 0)
+      {
+         sorted = false;
+      }
+   }
+   /* Protocols written by E are already in order */
+   if(!sorted)
+   {
+      sort_index = index;
+      qsort(by_id, index->step_no, sizeof(long), pcl_index_step_compare);
+      sort_index = NULL;
+      for(i=1; i<index->step_no; i++)
+      {
+         if(pcl_index_id_compare(index->id_pool,
+                                 index->steps[by_id[i-1]].id,
+                                 index->steps[by_id[i]].id) == 0)
+         {
+            DStr_p errpos = DStrAlloc();
+
+            DStrAppendStr(errpos, "PCL step ");
+            DStrAppendBuffer(errpos, index->steps[by_id[i]].text,
+                             MIN(index->steps[by_id[i]].len, 40));
+            DStrAppendStr(errpos, ": duplicate PCL identifier");
+            Error(DStrView(errpos), SYNTAX_ERROR);
+            DStrFree(errpos);
+         }
+      }
+   }
+   for(j=0; j<PStackGetSP(index->parents); j++)
+   {
+      target = pcl_index_find(index, by_id,
+                              PStackElementInt(index->parents, j));
+      if(target == -1)
+      {
+         index->unresolved++;
+      }
+      PStackAssignInt(index->parents, j, target);
+   }
+   SizeFree(by_id, (index->step_no+1)*sizeof(long));
+   PStackFree(index->id_pool);
+   index->id_pool  = NULL;
+   index->resolved = true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexMarkReachable()
+//
+//   Mark all steps reachable from the roots in index->reachable and
+//   return their number.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long PCLProtIndexMarkReachable(PCLProtIndex_p index)
+{
+   PStack_p      to_proc = PStackAlloc();
+   long          step, parent, count = 0;
+   PStackPointer j, last;
+
+   if(!index->resolved)
+   {
+      PCLProtIndexResolve(index);
+   }
+   if(index->reachable)
+   {
+      BitSetFree(index->reachable);
+   }
+   index->reachable = BitSetAlloc(index->step_no);
+
+   PStackPushStack(to_proc, index->roots);
+   while(!PStackEmpty(to_proc))
+   {
+      step = PStackPopInt(to_proc);
+      if(BitSetQuery(index->reachable, step))
+      {
+         continue;
+      }
+      BitSetInsert(index->reachable, step);
+      count++;
+
+      last = (step+1 < index->step_no)?
+         index->steps[step+1].parents:PStackGetSP(index->parents);
+      for(j=index->steps[step].parents; j<last; j++)
+      {
+         parent = PStackElementInt(index->parents, j);
+         if(parent != -1 && !BitSetQuery(index->reachable, parent))
+         {
+            PStackPushInt(to_proc, parent);
+         }
+      }
+   }
+   PStackFree(to_proc);
+
+   return count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtIndexParseReachable()
+//
+//   Parse all steps reachable from the roots of the index into prot
+//   (phase 2). Each run of consecutive reachable steps is parsed
+//   directly from the input, with positions (for error messages)
+//   relative to the original file. If the index could not determine
+//   the boundaries of all steps, all inputs are parsed completely
+//   instead. Return the number of steps parsed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long PCLProtIndexParseReachable(PCLProtIndex_p index, PCLProt_p prot)
+{
+   Scanner_p      in;
+   Stream_p       stream = NULL;
+   PCLIndexStep_p first, last;
+   char           *pos = NULL, *line_start = NULL, *nl;
+   long           i, line = 1, res = 0;
+
+   if(index->malformed)
+   {
+      for(i=0; i<PStackGetSP(index->streams); i++)
+      {
+         stream = PStackElementP(index->streams, i);
+         in = CreateScannerFromStream(
+            CreateStreamView(DStrView(stream->source),
+                             StreamCurrPtr(stream), StreamAvail(stream),
+                             1, 1),
+            true);
+         ScannerSetFormat(in, TPTPFormat);
+         res += PCLProtParse(in, prot);
+         CheckInpTok(in, NoToken);
+         DestroyScanner(in);
+      }
+      return res;
+   }
+   if(!index->reachable)
+   {
+      PCLProtIndexMarkReachable(index);
+   }
+   for(i = BitSetNextElement(index->reachable, 0); i != -1;
+       i = BitSetNextElement(index->reachable, last-index->steps+1))
+   {
+      first = last = &(index->steps[i]);
+      while(last+1 < index->steps+index->step_no &&
+            BitSetQuery(index->reachable, last-index->steps+1) &&
+            last[1].stream == first->stream)
+      {
+         last++;
+      }
+      if(!stream || stream != PStackElementP(index->streams, first->stream))
+      {
+         stream     = PStackElementP(index->streams, first->stream);
+         pos        = line_start = StreamCurrPtr(stream);
+         line       = 1;
+      }
+      /* Steps are in input order, so positions only move forward */
+      while((nl = memchr(pos, '\n', first->text-pos)))
+      {
+         line++;
+         pos = line_start = nl+1;
+      }
+      pos = first->text;
+
+      in = CreateScannerFromStream(
+         CreateStreamView(DStrView(stream->source), first->text,
+                          last->text+last->len-first->text,
+                          line, first->text-line_start+1),
+         true);
+      ScannerSetFormat(in, TPTPFormat);
+      res += PCLProtParse(in, prot);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------
+
+File  : pcl_protindex.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Two-phase reading of (very large) PCL protocols. The first phase
+  only scans the (memory-mapped) input for step boundaries,
+  identifiers and parent references, and builds an index of steps and
+  a compact parent graph. The second phase parses only the steps
+  needed for the "proof", "final" and "extract" steps into a normal
+  PCL protocol.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 22:41:07 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef PCL_PROTINDEX
+
+#define PCL_PROTINDEX
+
+#include <clb_bitsets.h>
+#include <pcl_protocol.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Location of a single step in the input */
+
+typedef struct pclindexstepcell
+{
+   long stream;   /* Number of the input stream */
+   char *text;    /* Start of the step (its identifier) */
+   long len;      /* Length of the step text */
+   long id;       /* Identifier, offset into the id pool */
+   long parents;  /* First parent in the parent array */
+}PCLIndexStepCell, *PCLIndexStep_p;
+
+
+typedef struct pclprotindexcell
+{
+   PStack_p         streams;  /* Inputs, must stay open while steps
+                                 point into them */
+   long             step_no;
+   long             size;     /* Allocated size of steps */
+   PCLIndexStep_p   steps;    /* In input order */
+   PStack_p         id_pool;  /* Identifiers as -1-terminated
+                                 sequences of their elements */
+   PStack_p         parents;  /* CSR parent graph: Pool offsets of the
+                                 referenced identifiers while scanning,
+                                 step indices after
+                                 PCLProtIndexResolve() */
+   PStack_p         roots;    /* Indices of proof/final/extract steps */
+   bool             resolved;
+   bool             empty_clause; /* An empty clause has been seen */
+   bool             malformed;    /* A step did not end properly */
+   long             unresolved;   /* References to unknown steps */
+   BitSet_p         reachable;
+}PCLProtIndexCell, *PCLProtIndex_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define PCLProtIndexCellAlloc() \
+   (PCLProtIndexCell*)SizeMalloc(sizeof(PCLProtIndexCell))
+#define PCLProtIndexCellFree(junk) SizeFree(junk, sizeof(PCLProtIndexCell))
+
+PCLProtIndex_p PCLProtIndexAlloc(void);
+void           PCLProtIndexFree(PCLProtIndex_p junk);
+
+long PCLProtIndexAddFile(PCLProtIndex_p index, char* name);
+void PCLProtIndexResolve(PCLProtIndex_p index);
+long PCLProtIndexMarkReachable(PCLProtIndex_p index);
+long PCLProtIndexParseReachable(PCLProtIndex_p index, PCLProt_p prot);
+
+#define PCLProtIndexEdgeNo(index) PStackGetSP((index)->parents)
+#define PCLProtIndexRootNo(index) PStackGetSP((index)->roots)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
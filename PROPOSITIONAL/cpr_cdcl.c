@@ -0,0 +1,1412 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_cdcl.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Implementation of a CDCL SAT solver in the tradition of
+  MiniSAT. Clauses are kept with their two watched literals in
+  positions 0 and 1. The implied literal of a reason clause is always
+  in position 0.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 23:12:40 CEST 2026
+    New
+<2> Tue Oct 20 00:41:12 CEST 2026
+    Solving under assumptions with final conflict analysis.
+
+-----------------------------------------------------------------------*/
+
+#include "cpr_cdcl.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define CDCL_INITIAL_ATOMS   64
+#define CDCL_VAR_RESCALE     1e100
+#define CDCL_CLA_RESCALE     1e20
+
+#define cdcl_clause_mem(lit_no) \
+   (sizeof(CDCLClauseCell)+(lit_no)*sizeof(CDCLLit))
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_clause_alloc()
+//
+//   Allocate a solver clause with the given literals.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static CDCLClause_p cdcl_clause_alloc(CDCLLit *lits, long lit_no,
+                                      bool learned)
+{
+   CDCLClause_p handle = SizeMalloc(cdcl_clause_mem(lit_no));
+
+   handle->lit_no   = lit_no;
+   handle->lbd      = 0;
+   handle->learned  = learned;
+   handle->deleted  = false;
+   handle->activity = 0.0;
+   memcpy(handle->lits, lits, lit_no*sizeof(CDCLLit));
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_clause_free()
+//
+//   Free a solver clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_clause_free(CDCLClause_p junk)
+{
+   SizeFree(junk, cdcl_clause_mem(junk->lit_no));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_watch_add()
+//
+//   Add a watcher for clause with the given blocking literal to list.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_watch_add(CDCLWatchList_p list, CDCLClause_p clause,
+                           CDCLLit blocker)
+{
+   if(list->size == list->alloc)
+   {
+      list->alloc   = list->alloc?2*list->alloc:4;
+      list->watches = SecureRealloc(list->watches,
+                                    list->alloc*sizeof(CDCLWatchCell));
+   }
+   list->watches[list->size].clause  = clause;
+   list->watches[list->size].blocker = blocker;
+   list->size++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_attach_clause()
+//
+//   Watch the first two literals of clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes watch lists
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_attach_clause(CDCLState_p state, CDCLClause_p clause)
+{
+   assert(clause->lit_no >= 2);
+
+   cdcl_watch_add(&(state->watches[clause->lits[0]]), clause,
+                  clause->lits[1]);
+   cdcl_watch_add(&(state->watches[clause->lits[1]]), clause,
+                  clause->lits[0]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_heap_up()
+//
+//   Move the atom at position pos of the decision heap up until the
+//   heap property is restored.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_heap_up(CDCLState_p state, long pos)
+{
+   long atom = state->heap[pos], parent;
+
+   while(pos)
+   {
+      parent = (pos-1)/2;
+      if(!(state->activity[atom] > state->activity[state->heap[parent]]))
+      {
+         break;
+      }
+      state->heap[pos] = state->heap[parent];
+      state->heap_pos[state->heap[pos]] = pos;
+      pos = parent;
+   }
+   state->heap[pos] = atom;
+   state->heap_pos[atom] = pos;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_heap_down()
+//
+//   Move the atom at position pos of the decision heap down until
+//   the heap property is restored.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_heap_down(CDCLState_p state, long pos)
+{
+   long atom = state->heap[pos], child;
+
+   while((child = 2*pos+1) < state->heap_size)
+   {
+      if((child+1 < state->heap_size) &&
+         (state->activity[state->heap[child+1]] >
+          state->activity[state->heap[child]]))
+      {
+         child++;
+      }
+      if(!(state->activity[state->heap[child]] > state->activity[atom]))
+      {
+         break;
+      }
+      state->heap[pos] = state->heap[child];
+      state->heap_pos[state->heap[pos]] = pos;
+      pos = child;
+   }
+   state->heap[pos] = atom;
+   state->heap_pos[atom] = pos;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_heap_insert()
+//
+//   Insert atom into the decision heap (if it is not already in it).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_heap_insert(CDCLState_p state, long atom)
+{
+   if(state->heap_pos[atom] >= 0)
+   {
+      return;
+   }
+   state->heap[state->heap_size] = atom;
+   state->heap_pos[atom] = state->heap_size;
+   state->heap_size++;
+   cdcl_heap_up(state, state->heap_size-1);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_heap_pop()
+//
+//   Remove and return the most active atom from the (non-empty)
+//   decision heap.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static long cdcl_heap_pop(CDCLState_p state)
+{
+   long atom = state->heap[0];
+
+   assert(state->heap_size);
+
+   state->heap_pos[atom] = -1;
+   state->heap_size--;
+   if(state->heap_size)
+   {
+      state->heap[0] = state->heap[state->heap_size];
+      state->heap_pos[state->heap[0]] = 0;
+      cdcl_heap_down(state, 0);
+   }
+   return atom;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_grow()
+//
+//   Make room for all atoms up to (and including) atom.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_grow(CDCLState_p state, long atom)
+{
+   long old_alloc = state->atom_alloc, new_alloc, i;
+
+   new_alloc = MAX(2*old_alloc, CDCL_INITIAL_ATOMS);
+   while(new_alloc <= atom)
+   {
+      new_alloc *= 2;
+   }
+   state->value = SecureRealloc(state->value,
+                                2*new_alloc*sizeof(signed char));
+   state->watches = SecureRealloc(state->watches,
+                                  2*new_alloc*sizeof(CDCLWatchListCell));
+   for(i=2*old_alloc; i<2*new_alloc; i++)
+   {
+      state->value[i]           = CDCL_UNDEF;
+      state->watches[i].size    = 0;
+      state->watches[i].alloc   = 0;
+      state->watches[i].watches = NULL;
+   }
+   state->level     = SecureRealloc(state->level, new_alloc*sizeof(int));
+   state->reason    = SecureRealloc(state->reason,
+                                    new_alloc*sizeof(CDCLClause_p));
+   state->activity  = SecureRealloc(state->activity,
+                                    new_alloc*sizeof(double));
+   state->phase     = SecureRealloc(state->phase, new_alloc*sizeof(char));
+   state->seen      = SecureRealloc(state->seen, new_alloc*sizeof(char));
+   state->model     = SecureRealloc(state->model,
+                                    new_alloc*sizeof(signed char));
+   state->heap      = SecureRealloc(state->heap, new_alloc*sizeof(long));
+   state->heap_pos  = SecureRealloc(state->heap_pos,
+                                    new_alloc*sizeof(long));
+   for(i=old_alloc; i<new_alloc; i++)
+   {
+      state->level[i]    = 0;
+      state->reason[i]   = NULL;
+      state->activity[i] = 0.0;
+      state->phase[i]    = false;
+      state->seen[i]     = 0;
+      state->model[i]    = CDCL_UNDEF;
+      state->heap_pos[i] = -1;
+   }
+   state->trail     = SecureRealloc(state->trail,
+                                    new_alloc*sizeof(CDCLLit));
+   state->learnt    = SecureRealloc(state->learnt,
+                                    new_alloc*sizeof(CDCLLit));
+   state->to_clear  = SecureRealloc(state->to_clear,
+                                    new_alloc*sizeof(CDCLLit));
+   state->trail_lim = SecureRealloc(state->trail_lim,
+                                    (new_alloc+1)*sizeof(long));
+   state->level_stamp = SecureRealloc(state->level_stamp,
+                                      (new_alloc+1)*sizeof(unsigned long));
+   for(i=old_alloc; i<=new_alloc; i++)
+   {
+      state->level_stamp[i] = 0;
+   }
+   state->atom_alloc = new_alloc;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_assign()
+//
+//   Make lit true at the current decision level.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes assignment and trail
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_assign(CDCLState_p state, CDCLLit lit, CDCLClause_p reason)
+{
+   long atom = CDCLLitAtom(lit);
+
+   assert(state->value[lit] == CDCL_UNDEF);
+
+   state->value[lit] = CDCL_TRUE;
+   state->value[CDCLLitNegate(lit)] = CDCL_FALSE;
+   state->level[atom]  = state->decision_level;
+   state->reason[atom] = reason;
+   state->trail[state->trail_size++] = lit;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_propagate()
+//
+//   Perform unit propagation for all literals on the trail that have
+//   not been propagated yet. Return a conflicting clause or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes assignment, trail and watch lists
+//
+/----------------------------------------------------------------------*/
+
+static CDCLClause_p cdcl_propagate(CDCLState_p state)
+{
+   CDCLClause_p    confl = NULL, clause;
+   CDCLWatchList_p list;
+   CDCLWatch_p     ws;
+   CDCLLit         false_lit, first, blocker;
+   long            i, j, k, n;
+
+   while(!confl && (state->prop_head < state->trail_size))
+   {
+      false_lit = CDCLLitNegate(state->trail[state->prop_head++]);
+      list = &(state->watches[false_lit]);
+      ws   = list->watches;
+      n    = list->size;
+      state->propagations++;
+
+      for(i=0, j=0; i<n; )
+      {
+         blocker = ws[i].blocker;
+         if(state->value[blocker] == CDCL_TRUE)
+         {
+            ws[j++] = ws[i++];
+            continue;
+         }
+         clause = ws[i].clause;
+         i++;
+         if(clause->lits[0] == false_lit)
+         {
+            clause->lits[0] = clause->lits[1];
+            clause->lits[1] = false_lit;
+         }
+         assert(clause->lits[1] == false_lit);
+         first = clause->lits[0];
+         if((first != blocker) && (state->value[first] == CDCL_TRUE))
+         {
+            ws[j].clause  = clause;
+            ws[j].blocker = first;
+            j++;
+            continue;
+         }
+         for(k=2; k<clause->lit_no; k++)
+         {
+            if(state->value[clause->lits[k]] != CDCL_FALSE)
+            {
+               clause->lits[1] = clause->lits[k];
+               clause->lits[k] = false_lit;
+               cdcl_watch_add(&(state->watches[clause->lits[1]]),
+                              clause, first);
+               break;
+            }
+         }
+         if(k < clause->lit_no)
+         {
+            continue;
+         }
+         /* Clause is unit or conflicting */
+         ws[j].clause  = clause;
+         ws[j].blocker = first;
+         j++;
+         if(state->value[first] == CDCL_FALSE)
+         {
+            confl = clause;
+            state->prop_head = state->trail_size;
+            while(i<n)
+            {
+               ws[j++] = ws[i++];
+            }
+         }
+         else
+         {
+            cdcl_assign(state, first, clause);
+         }
+      }
+      list->size = j;
+   }
+   return confl;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_bump_atom()
+//
+//   Increase the activity of atom, rescaling all activities if
+//   necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities and heap
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_bump_atom(CDCLState_p state, long atom)
+{
+   long i;
+
+   state->activity[atom] += state->var_inc;
+   if(state->activity[atom] > CDCL_VAR_RESCALE)
+   {
+      for(i=1; i<=state->max_atom; i++)
+      {
+         state->activity[i] /= CDCL_VAR_RESCALE;
+      }
+      state->var_inc /= CDCL_VAR_RESCALE;
+   }
+   if(state->heap_pos[atom] >= 0)
+   {
+      cdcl_heap_up(state, state->heap_pos[atom]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_bump_clause()
+//
+//   Increase the activity of a learned clause, rescaling all clause
+//   activities if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_bump_clause(CDCLState_p state, CDCLClause_p clause)
+{
+   PStackPointer i;
+   CDCLClause_p  handle;
+
+   clause->activity += state->cla_inc;
+   if(clause->activity > CDCL_CLA_RESCALE)
+   {
+      for(i=0; i<PStackGetSP(state->learned); i++)
+      {
+         handle = PStackElementP(state->learned, i);
+         handle->activity /= CDCL_CLA_RESCALE;
+      }
+      state->cla_inc /= CDCL_CLA_RESCALE;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_lit_redundant()
+//
+//   Return true if the literal implied by reason can be removed from
+//   the learned clause, i.e. if all other literals of reason are
+//   already in the clause (or false at level 0).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool cdcl_lit_redundant(CDCLState_p state, CDCLClause_p reason)
+{
+   long i, atom;
+
+   for(i=1; i<reason->lit_no; i++)
+   {
+      atom = CDCLLitAtom(reason->lits[i]);
+      if(!state->seen[atom] && state->level[atom] > 0)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_analyze()
+//
+//   Analyze a conflict and derive the first-UIP clause into
+//   state->learnt, with the asserting literal in position 0 and a
+//   literal of the backtrack level in position 1. Return the
+//   backtrack level, store the LBD of the clause in *lbd.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities
+//
+/----------------------------------------------------------------------*/
+
+static int cdcl_analyze(CDCLState_p state, CDCLClause_p confl, int *lbd)
+{
+   CDCLLit *learnt = state->learnt;
+   long    path_c = 0, index = state->trail_size-1, n = 1, i, j, atom;
+   long    max_i;
+   CDCLLit p = -1, q;
+
+   do
+   {
+      assert(confl);
+      if(confl->learned)
+      {
+         cdcl_bump_clause(state, confl);
+      }
+      for(i = (p==-1)?0:1; i<confl->lit_no; i++)
+      {
+         q    = confl->lits[i];
+         atom = CDCLLitAtom(q);
+         if(!state->seen[atom] && (state->level[atom] > 0))
+         {
+            cdcl_bump_atom(state, atom);
+            state->seen[atom] = 1;
+            if(state->level[atom] >= state->decision_level)
+            {
+               path_c++;
+            }
+            else
+            {
+               learnt[n++] = q;
+            }
+         }
+      }
+      while(!state->seen[CDCLLitAtom(state->trail[index])])
+      {
+         index--;
+      }
+      p     = state->trail[index--];
+      confl = state->reason[CDCLLitAtom(p)];
+      state->seen[CDCLLitAtom(p)] = 0;
+      path_c--;
+   }while(path_c > 0);
+   learnt[0] = CDCLLitNegate(p);
+
+   /* Local minimization: Drop literals implied by other literals of
+      the clause. */
+   memcpy(state->to_clear, learnt, n*sizeof(CDCLLit));
+   for(i=1, j=1; i<n; i++)
+   {
+      confl = state->reason[CDCLLitAtom(learnt[i])];
+      if(!confl || !cdcl_lit_redundant(state, confl))
+      {
+         learnt[j++] = learnt[i];
+      }
+   }
+   for(i=1; i<n; i++)
+   {
+      state->seen[CDCLLitAtom(state->to_clear[i])] = 0;
+   }
+   n = j;
+   state->learnt_size = n;
+
+   /* Literal block distance */
+   state->stamp++;
+   *lbd = 0;
+   for(i=0; i<n; i++)
+   {
+      atom = CDCLLitAtom(learnt[i]);
+      if(state->level_stamp[state->level[atom]] != state->stamp)
+      {
+         state->level_stamp[state->level[atom]] = state->stamp;
+         (*lbd)++;
+      }
+   }
+
+   if(n == 1)
+   {
+      return 0;
+   }
+   max_i = 1;
+   for(i=2; i<n; i++)
+   {
+      if(state->level[CDCLLitAtom(learnt[i])] >
+         state->level[CDCLLitAtom(learnt[max_i])])
+      {
+         max_i = i;
+      }
+   }
+   q = learnt[max_i];
+   learnt[max_i] = learnt[1];
+   learnt[1] = q;
+
+   return state->level[CDCLLitAtom(q)];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_analyze_final()
+//
+//   The assumption lit has become false. Collect the assumptions
+//   responsible for this (including lit itself) in state->core. All
+//   decisions on the trail are assumptions at this point.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state->core
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_analyze_final(CDCLState_p state, CDCLLit lit)
+{
+   long         i, j, atom;
+   CDCLClause_p reason;
+
+   PStackPushInt(state->core, CDCLLitToCode(lit));
+   if(state->decision_level == 0)
+   {
+      return;
+   }
+   state->seen[CDCLLitAtom(lit)] = 1;
+   for(i=state->trail_size-1; i>=state->trail_lim[0]; i--)
+   {
+      atom = CDCLLitAtom(state->trail[i]);
+      if(!state->seen[atom])
+      {
+         continue;
+      }
+      reason = state->reason[atom];
+      if(!reason)
+      {
+         assert(state->level[atom] > 0);
+         PStackPushInt(state->core, CDCLLitToCode(state->trail[i]));
+      }
+      else
+      {
+         for(j=1; j<reason->lit_no; j++)
+         {
+            if(state->level[CDCLLitAtom(reason->lits[j])] > 0)
+            {
+               state->seen[CDCLLitAtom(reason->lits[j])] = 1;
+            }
+         }
+      }
+      state->seen[atom] = 0;
+   }
+   state->seen[CDCLLitAtom(lit)] = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_backtrack()
+//
+//   Undo all assignments above decision level level, saving their
+//   polarity.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes assignment, trail and heap
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_backtrack(CDCLState_p state, int level)
+{
+   long    i, atom;
+   CDCLLit lit;
+
+   if(state->decision_level <= level)
+   {
+      return;
+   }
+   for(i=state->trail_size-1; i>=state->trail_lim[level]; i--)
+   {
+      lit  = state->trail[i];
+      atom = CDCLLitAtom(lit);
+      state->value[lit] = CDCL_UNDEF;
+      state->value[CDCLLitNegate(lit)] = CDCL_UNDEF;
+      state->reason[atom] = NULL;
+      state->phase[atom]  = !CDCLLitIsNeg(lit);
+      cdcl_heap_insert(state, atom);
+   }
+   state->trail_size     = state->trail_lim[level];
+   state->prop_head      = state->trail_size;
+   state->decision_level = level;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_learned_cmp()
+//
+//   Compare two learned clauses (wrapped in IntOrP) by usefulness:
+//   Smaller LBD first, then higher activity.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cdcl_learned_cmp(const void* c1, const void* c2)
+{
+   const CDCLClause_p cl1 = ((const IntOrP*)c1)->p_val;
+   const CDCLClause_p cl2 = ((const IntOrP*)c2)->p_val;
+
+   if(cl1->lbd != cl2->lbd)
+   {
+      return cl1->lbd < cl2->lbd ? -1 : 1;
+   }
+   if(cl1->activity != cl2->activity)
+   {
+      return cl1->activity > cl2->activity ? -1 : 1;
+   }
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_reduce_db()
+//
+//   Delete the less useful half of the learned clauses, keeping
+//   binary clauses, glue clauses and clauses that are currently the
+//   reason for an assignment.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes watch lists
+//
+/----------------------------------------------------------------------*/
+
+static void cdcl_reduce_db(CDCLState_p state)
+{
+   PStackPointer   i, j;
+   CDCLClause_p    clause;
+   CDCLWatchList_p list;
+   long            lit, k, l;
+
+   PStackSort(state->learned, cdcl_learned_cmp);
+   for(i=PStackGetSP(state->learned)/2; i<PStackGetSP(state->learned); i++)
+   {
+      clause = PStackElementP(state->learned, i);
+      if((clause->lit_no > 2) &&
+         (clause->lbd > CDCL_GLUE_LBD) &&
+         (state->reason[CDCLLitAtom(clause->lits[0])] != clause))
+      {
+         clause->deleted = true;
+      }
+   }
+   for(lit=CDCLLitPos(1); lit<=CDCLLitNeg(state->max_atom); lit++)
+   {
+      list = &(state->watches[lit]);
+      for(k=0, l=0; k<list->size; k++)
+      {
+         if(!list->watches[k].clause->deleted)
+         {
+            list->watches[l++] = list->watches[k];
+         }
+      }
+      list->size = l;
+   }
+   for(i=0, j=0; i<PStackGetSP(state->learned); i++)
+   {
+      clause = PStackElementP(state->learned, i);
+      if(clause->deleted)
+      {
+         cdcl_clause_free(clause);
+         state->deleted_total++;
+      }
+      else
+      {
+         PStackAssignP(state->learned, j, clause);
+         j++;
+      }
+   }
+   PStackSetSP(state->learned, j);
+   state->max_learned *= CDCL_LEARNED_GROWTH;
+   state->reductions++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_luby()
+//
+//   Return the i-th element (starting at 0) of the Luby sequence
+//   1,1,2,1,1,2,4,1,1,2,...
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long cdcl_luby(long i)
+{
+   long size, seq;
+
+   for(size=1, seq=0; size<i+1; seq++)
+   {
+      size = 2*size+1;
+   }
+   while(size-1 != i)
+   {
+      size = (size-1)/2;
+      seq--;
+      i = i%size;
+   }
+   return 1L<<seq;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cdcl_pick_branch()
+//
+//   Return the most active unassigned atom, or 0 if all atoms are
+//   assigned.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static long cdcl_pick_branch(CDCLState_p state)
+{
+   long atom;
+
+   while(state->heap_size)
+   {
+      atom = cdcl_heap_pop(state);
+      if(state->value[CDCLLitPos(atom)] == CDCL_UNDEF)
+      {
+         return atom;
+      }
+   }
+   return 0;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLStateAlloc()
+//
+//   Allocate an empty solver state (representing the empty, i.e.
+//   satisfiable, clause set).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+CDCLState_p CDCLStateAlloc(void)
+{
+   CDCLState_p handle = CDCLStateCellAlloc();
+
+   handle->atom_alloc     = 0;
+   handle->max_atom       = 0;
+   handle->value          = NULL;
+   handle->watches        = NULL;
+   handle->level          = NULL;
+   handle->reason         = NULL;
+   handle->activity       = NULL;
+   handle->phase          = NULL;
+   handle->seen           = NULL;
+   handle->model          = NULL;
+   handle->heap           = NULL;
+   handle->heap_pos       = NULL;
+   handle->heap_size      = 0;
+   handle->trail          = NULL;
+   handle->trail_size     = 0;
+   handle->prop_head      = 0;
+   handle->trail_lim      = NULL;
+   handle->decision_level = 0;
+   handle->level_stamp    = NULL;
+   handle->stamp          = 0;
+   handle->var_inc        = 1.0;
+   handle->cla_inc        = 1.0;
+   handle->clauses        = PStackAlloc();
+   handle->learned        = PStackAlloc();
+   handle->learnt         = NULL;
+   handle->learnt_size    = 0;
+   handle->to_clear       = NULL;
+   handle->max_learned    = CDCL_MIN_LEARNED;
+   handle->inconsistent   = false;
+   handle->core           = PStackAlloc();
+   handle->decisions      = 0;
+   handle->propagations   = 0;
+   handle->conflicts      = 0;
+   handle->restarts       = 0;
+   handle->reductions     = 0;
+   handle->learned_total  = 0;
+   handle->learned_units  = 0;
+   handle->deleted_total  = 0;
+
+   cdcl_grow(handle, 0);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLStateFree()
+//
+//   Free a solver state with all its clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void CDCLStateFree(CDCLState_p junk)
+{
+   long i;
+
+   while(!PStackEmpty(junk->clauses))
+   {
+      cdcl_clause_free(PStackPopP(junk->clauses));
+   }
+   PStackFree(junk->clauses);
+   while(!PStackEmpty(junk->learned))
+   {
+      cdcl_clause_free(PStackPopP(junk->learned));
+   }
+   PStackFree(junk->learned);
+   PStackFree(junk->core);
+   for(i=0; i<2*junk->atom_alloc; i++)
+   {
+      if(junk->watches[i].watches)
+      {
+         FREE(junk->watches[i].watches);
+      }
+   }
+   FREE(junk->watches);
+   FREE(junk->value);
+   FREE(junk->level);
+   FREE(junk->reason);
+   FREE(junk->activity);
+   FREE(junk->phase);
+   FREE(junk->seen);
+   FREE(junk->model);
+   FREE(junk->heap);
+   FREE(junk->heap_pos);
+   FREE(junk->trail);
+   FREE(junk->learnt);
+   FREE(junk->to_clear);
+   FREE(junk->trail_lim);
+   FREE(junk->level_stamp);
+   CDCLStateCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLStateAddClause()
+//
+//   Add a clause (given as an array of literal codes, atoms must be
+//   positive) to the solver. Duplicate literals are removed,
+//   tautologies and clauses already satisfied at the top level are
+//   discarded, literals false at the top level are deleted. Return
+//   false if the clause set has become trivially unsatisfiable, true
+//   otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes state
+//
+/----------------------------------------------------------------------*/
+
+bool CDCLStateAddClause(CDCLState_p state, PLiteralCode *lits, long lit_no)
+{
+   long         i, n = 0, atom;
+   CDCLLit      lit, *buf;
+   CDCLClause_p clause;
+   char         mask;
+   bool         satisfied = false;
+
+   assert(state->decision_level == 0);
+
+   if(state->inconsistent)
+   {
+      return false;
+   }
+   for(i=0; i<lit_no; i++)
+   {
+      atom = ABS(lits[i]);
+      assert(atom > 0);
+      if(atom >= state->atom_alloc)
+      {
+         cdcl_grow(state, atom);
+      }
+      while(state->max_atom < atom)
+      {
+         state->max_atom++;
+         cdcl_heap_insert(state, state->max_atom);
+      }
+   }
+   buf = state->learnt;
+   for(i=0; i<lit_no; i++)
+   {
+      lit  = CDCLLitFromCode(lits[i]);
+      atom = CDCLLitAtom(lit);
+      mask = CDCLLitIsNeg(lit)?2:1;
+      if(state->seen[atom] & mask)
+      {
+         continue;
+      }
+      if(state->seen[atom])
+      {
+         satisfied = true;
+      }
+      state->seen[atom] |= mask;
+      if(state->value[lit] == CDCL_TRUE)
+      {
+         satisfied = true;
+      }
+      else if(state->value[lit] == CDCL_UNDEF)
+      {
+         buf[n++] = lit;
+      }
+   }
+   for(i=0; i<lit_no; i++)
+   {
+      state->seen[ABS(lits[i])] = 0;
+   }
+   if(satisfied)
+   {
+      return true;
+   }
+   switch(n)
+   {
+   case 0:
+         state->inconsistent = true;
+         return false;
+   case 1:
+         cdcl_assign(state, buf[0], NULL);
+         break;
+   default:
+         clause = cdcl_clause_alloc(buf, n, false);
+         cdcl_attach_clause(state, clause);
+         PStackPushP(state->clauses, clause);
+         break;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLStateAddFormula()
+//
+//   Add all clauses of form to the solver. Return the number of
+//   clauses added.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes state
+//
+/----------------------------------------------------------------------*/
+
+long CDCLStateAddFormula(CDCLState_p state, DPLLFormula_p form)
+{
+   PStackPointer i;
+   DPLLClause_p  clause;
+
+   for(i=0; i<PStackGetSP(form->clauses); i++)
+   {
+      clause = PStackElementP(form->clauses, i);
+      CDCLStateAddClause(state, clause->literals, clause->lit_no);
+   }
+   return PStackGetSP(form->clauses);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLSolveAssumptions()
+//
+//   Decide the satisfiability of the clauses in state under the
+//   assumptions given (literal codes on pairwise distinct
+//   atoms). Gives up after conflict_limit conflicts (if
+//   conflict_limit > 0) or if TimeIsUp is set. If the result is
+//   CDCLSatisfiable, the model can be queried with
+//   CDCLModelValue(). If it is CDCLUnsatisfiable and the clauses
+//   alone are not inconsistent, CDCLCore() contains the subset of
+//   the assumptions that is inconsistent with the clauses. The
+//   solver is always left at decision level 0, so more clauses can
+//   be added and the solver can be called again. CDCLSolve() is the
+//   special case without assumptions.
+//
+// Global Variables: TimeIsUp
+//
+// Side Effects    : Changes state, memory operations
+//
+/----------------------------------------------------------------------*/
+
+CDCLResult CDCLSolveAssumptions(CDCLState_p state,
+                                PLiteralCode *assumptions,
+                                long assumption_no,
+                                long conflict_limit)
+{
+   CDCLClause_p confl, clause;
+   long         conflicts = 0, restart_conflicts = 0, restart_no = 0;
+   long         restart_limit, atom;
+   int          bt_level, lbd;
+   CDCLLit      next;
+
+   PStackReset(state->core);
+   for(atom=0; atom<assumption_no; atom++)
+   {
+      assert(assumptions[atom]);
+      if(ABS(assumptions[atom]) >= state->atom_alloc)
+      {
+         cdcl_grow(state, ABS(assumptions[atom]));
+      }
+      while(state->max_atom < ABS(assumptions[atom]))
+      {
+         state->max_atom++;
+         cdcl_heap_insert(state, state->max_atom);
+      }
+   }
+   if(state->inconsistent)
+   {
+      return CDCLUnsatisfiable;
+   }
+   state->max_learned = MAX(state->max_learned,
+                            PStackGetSP(state->clauses)/3);
+   restart_limit = CDCL_RESTART_UNIT*cdcl_luby(restart_no);
+
+   while(true)
+   {
+      confl = cdcl_propagate(state);
+      if(confl)
+      {
+         state->conflicts++;
+         conflicts++;
+         restart_conflicts++;
+         if(state->decision_level == 0)
+         {
+            state->inconsistent = true;
+            return CDCLUnsatisfiable;
+         }
+         bt_level = cdcl_analyze(state, confl, &lbd);
+         cdcl_backtrack(state, bt_level);
+         if(state->learnt_size == 1)
+         {
+            cdcl_assign(state, state->learnt[0], NULL);
+            state->learned_units++;
+         }
+         else
+         {
+            clause = cdcl_clause_alloc(state->learnt, state->learnt_size,
+                                       true);
+            clause->lbd = lbd;
+            cdcl_attach_clause(state, clause);
+            cdcl_bump_clause(state, clause);
+            PStackPushP(state->learned, clause);
+            cdcl_assign(state, clause->lits[0], clause);
+         }
+         state->learned_total++;
+         state->var_inc /= CDCL_VAR_DECAY;
+         state->cla_inc /= CDCL_CLA_DECAY;
+      }
+      else
+      {
+         if(restart_conflicts >= restart_limit)
+         {
+            cdcl_backtrack(state, 0);
+            state->restarts++;
+            restart_no++;
+            restart_conflicts = 0;
+            restart_limit = CDCL_RESTART_UNIT*cdcl_luby(restart_no);
+         }
+         if(TimeIsUp ||
+            ((conflict_limit > 0) && (conflicts >= conflict_limit)))
+         {
+            cdcl_backtrack(state, 0);
+            return CDCLUnknown;
+         }
+         if(PStackGetSP(state->learned)-state->trail_size >=
+            state->max_learned)
+         {
+            cdcl_reduce_db(state);
+         }
+         next = -1;
+         while(state->decision_level < assumption_no)
+         {
+            /* Assumptions are the first decisions, one per level */
+            next = CDCLLitFromCode(assumptions[state->decision_level]);
+            if(state->value[next] == CDCL_TRUE)
+            {
+               state->trail_lim[state->decision_level++] =
+                  state->trail_size;
+               next = -1;
+            }
+            else if(state->value[next] == CDCL_FALSE)
+            {
+               cdcl_analyze_final(state, next);
+               cdcl_backtrack(state, 0);
+               return CDCLUnsatisfiable;
+            }
+            else
+            {
+               break;
+            }
+         }
+         if(next == -1)
+         {
+            atom = cdcl_pick_branch(state);
+            if(!atom)
+            {
+               for(atom=1; atom<=state->max_atom; atom++)
+               {
+                  state->model[atom] = state->value[CDCLLitPos(atom)];
+               }
+               cdcl_backtrack(state, 0);
+               return CDCLSatisfiable;
+            }
+            next = state->phase[atom]?CDCLLitPos(atom):CDCLLitNeg(atom);
+         }
+         state->decisions++;
+         state->trail_lim[state->decision_level++] = state->trail_size;
+         cdcl_assign(state, next, NULL);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLPrintModel()
+//
+//   Print the last model found in the "v"-line format of the SAT
+//   competitions.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void CDCLPrintModel(FILE* out, CDCLState_p state)
+{
+   long atom;
+
+   for(atom=1; atom<=state->max_atom; atom++)
+   {
+      if((atom%10) == 1)
+      {
+         fprintf(out, "v");
+      }
+      fprintf(out, " %ld",
+              state->model[atom]==CDCL_TRUE?atom:-atom);
+      if((atom%10) == 0)
+      {
+         fputc('\n', out);
+      }
+   }
+   fprintf(out, "%s 0\n", (state->max_atom%10)?"":"v");
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLPrintStatistics()
+//
+//   Print solver statistics as comments.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void CDCLPrintStatistics(FILE* out, CDCLState_p state)
+{
+   fprintf(out,
+           "# Atoms                                : %ld\n"
+           "# Clauses                              : %ld\n"
+           "# Decisions                            : %ld\n"
+           "# Propagations                         : %ld\n"
+           "# Conflicts                            : %ld\n"
+           "# Restarts                             : %ld\n"
+           "# Learned clauses                      : %ld\n"
+           "# ...of which units                    : %ld\n"
+           "# Database reductions                  : %ld\n"
+           "# Deleted learned clauses              : %ld\n",
+           state->max_atom,
+           (long)PStackGetSP(state->clauses),
+           state->decisions,
+           state->propagations,
+           state->conflicts,
+           state->restarts,
+           state->learned_total,
+           state->learned_units,
+           state->reductions,
+           state->deleted_total);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLResultSZSStatus()
+//
+//   Return the SZS status string corresponding to a solver result.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+char* CDCLResultSZSStatus(CDCLResult res)
+{
+   switch(res)
+   {
+   case CDCLSatisfiable:
+         return "Satisfiable";
+   case CDCLUnsatisfiable:
+         return "Unsatisfiable";
+   default:
+         return "GaveUp";
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
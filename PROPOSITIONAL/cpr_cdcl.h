@@ -0,0 +1,188 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_cdcl.h
+
+Author: Stephan Schulz
+
+Contents
+
+  A conflict-driven clause learning (CDCL) SAT solver for
+  propositional formulas in CNF: Two-watched-literal unit
+  propagation, first-UIP conflict analysis with clause minimization,
+  EVSIDS decision heuristic with phase saving, Luby restarts and
+  reduction of the learned clause database by LBD and activity.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 23:12:40 CEST 2026
+    New
+<2> Tue Oct 20 00:41:12 CEST 2026
+    Solving under assumptions with final conflict analysis.
+
+-----------------------------------------------------------------------*/
+
+#ifndef CPR_CDCL
+
+#define CPR_CDCL
+
+#include <cio_signals.h>
+#include <cpr_dpllformula.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Internal literal encoding: Atom a is represented by 2a (positive)
+   and 2a+1 (negative), so that literals can directly index
+   per-literal arrays. */
+
+typedef int CDCLLit;
+
+#define CDCLLitPos(atom)    ((CDCLLit)(2*(atom)))
+#define CDCLLitNeg(atom)    ((CDCLLit)(2*(atom)+1))
+#define CDCLLitAtom(lit)    ((lit)>>1)
+#define CDCLLitIsNeg(lit)   ((lit)&1)
+#define CDCLLitNegate(lit)  ((lit)^1)
+#define CDCLLitFromCode(code) \
+   ((code)>0?CDCLLitPos(code):CDCLLitNeg(-(code)))
+#define CDCLLitToCode(lit) \
+   (CDCLLitIsNeg(lit)?-(PLiteralCode)CDCLLitAtom(lit):\
+    (PLiteralCode)CDCLLitAtom(lit))
+
+/* Truth values of literals and atoms */
+
+#define CDCL_TRUE    1
+#define CDCL_FALSE  -1
+#define CDCL_UNDEF   0
+
+typedef enum
+{
+   CDCLUnknown = 0,
+   CDCLSatisfiable,
+   CDCLUnsatisfiable
+}CDCLResult;
+
+typedef struct cdcl_clause_cell
+{
+   int      lit_no;
+   int      lbd;        /* Literal block distance when learned */
+   bool     learned;
+   bool     deleted;    /* Marked for removal in reduction */
+   float    activity;
+   CDCLLit  lits[];     /* lits[0] and lits[1] are watched */
+}CDCLClauseCell, *CDCLClause_p;
+
+/* A watcher carries a "blocking" literal of the clause - if it is
+   true, the clause need not be visited at all. */
+
+typedef struct cdcl_watch_cell
+{
+   CDCLClause_p clause;
+   CDCLLit      blocker;
+}CDCLWatchCell, *CDCLWatch_p;
+
+typedef struct cdcl_watch_list_cell
+{
+   long        size;
+   long        alloc;
+   CDCLWatch_p watches;
+}CDCLWatchListCell, *CDCLWatchList_p;
+
+typedef struct cdcl_state_cell
+{
+   long              atom_alloc;  /* Atoms are 1..atom_alloc-1 */
+   long              max_atom;    /* Largest atom used so far */
+   signed char       *value;      /* Indexed by literal */
+   CDCLWatchListCell *watches;    /* Indexed by literal, clauses
+                                     watching the literal */
+   int               *level;      /* Indexed by atom */
+   CDCLClause_p      *reason;     /* Indexed by atom */
+   double            *activity;   /* Indexed by atom */
+   char              *phase;      /* Indexed by atom, saved polarity */
+   char              *seen;       /* Indexed by atom, for analysis */
+   signed char       *model;      /* Indexed by atom, last model */
+   long              *heap;       /* Binary max-heap of atoms by
+                                     activity */
+   long              *heap_pos;   /* Position in heap or -1 */
+   long              heap_size;
+   CDCLLit           *trail;
+   long              trail_size;
+   long              prop_head;   /* Next trail literal to propagate */
+   long              *trail_lim;  /* Trail start of each decision
+                                     level */
+   int               decision_level;
+   unsigned long     *level_stamp; /* Indexed by level, for LBD */
+   unsigned long     stamp;
+   double            var_inc;
+   double            cla_inc;
+   PStack_p          clauses;     /* Original clauses */
+   PStack_p          learned;     /* Learned clauses */
+   CDCLLit           *learnt;     /* Buffer for conflict analysis */
+   long              learnt_size;
+   CDCLLit           *to_clear;   /* Literals marked seen in analysis */
+   long              max_learned;
+   bool              inconsistent; /* Empty clause derived */
+   PStack_p          core;        /* Failed assumptions (literal
+                                     codes) of the last call to
+                                     CDCLSolveAssumptions() */
+   /* Statistics */
+   long              decisions;
+   long              propagations;
+   long              conflicts;
+   long              restarts;
+   long              reductions;
+   long              learned_total;
+   long              learned_units;
+   long              deleted_total;
+}CDCLStateCell, *CDCLState_p;
+
+#define CDCL_VAR_DECAY        0.95
+#define CDCL_CLA_DECAY        0.999
+#define CDCL_RESTART_UNIT     100
+#define CDCL_MIN_LEARNED      2000
+#define CDCL_LEARNED_GROWTH   1.1
+#define CDCL_GLUE_LBD         2
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define CDCLStateCellAlloc() (CDCLStateCell*)SizeMalloc(sizeof(CDCLStateCell))
+#define CDCLStateCellFree(junk)            SizeFree(junk, sizeof(CDCLStateCell))
+
+CDCLState_p CDCLStateAlloc(void);
+void        CDCLStateFree(CDCLState_p junk);
+
+bool        CDCLStateAddClause(CDCLState_p state, PLiteralCode *lits,
+                               long lit_no);
+long        CDCLStateAddFormula(CDCLState_p state, DPLLFormula_p form);
+
+CDCLResult  CDCLSolveAssumptions(CDCLState_p state,
+                                 PLiteralCode *assumptions,
+                                 long assumption_no,
+                                 long conflict_limit);
+#define     CDCLSolve(state, conflict_limit) \
+   CDCLSolveAssumptions((state), NULL, 0, (conflict_limit))
+
+#define     CDCLAtomNumber(state) ((state)->max_atom)
+#define     CDCLModelValue(state, atom) \
+   ((atom)<(state)->atom_alloc?(state)->model[atom]:CDCL_UNDEF)
+#define     CDCLCore(state) ((state)->core)
+
+void        CDCLPrintModel(FILE* out, CDCLState_p state);
+void        CDCLPrintStatistics(FILE* out, CDCLState_p state);
+char*       CDCLResultSZSStatus(CDCLResult res);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
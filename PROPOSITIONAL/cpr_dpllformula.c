@@ -18,6 +18,8 @@ Changes
 
 <1> Fri May  2 19:01:54 CEST 2003
     New
+<2> Mon Oct 19 23:41:19 CEST 2026
+    Import ground sets, only print clauses on higher output levels
 
 -----------------------------------------------------------------------*/
 
@@ -165,7 +167,7 @@ void DPLLFormulaPrint(FILE* out,DPLLFormula_p form, DPLLOutputFormat format,
     {
        fprintf(out, "# %4ld: %4ld %4ld\n", i,
           form->atoms[i].pos_occur,
-          form->atoms[i].pos_occur);
+          form->atoms[i].neg_occur);
     }
       }
    }
@@ -206,7 +208,7 @@ void DPLLRegisterClauseLiteral(DPLLFormula_p form,
    PLiteralCode atom = ABS(lit);
    bool res;
 
-   while(form->atom_no<=lit)
+   while(form->atom_no<=atom)
    {
       dpll_form_add_atom_space(form);
    }
@@ -276,21 +278,95 @@ void DPLLFormulaParseLOP(Scanner_p in, Sig_p sig, DPLLFormula_p form)
       clause = ClauseParse(in, terms);
       pclause = DPLLClauseFromClause(form->sig, clause);
       ClauseFree(clause);
-      fprintf(GlobalOut, "New clause: ");
-      DPLLClausePrintLOP(GlobalOut, form->sig, pclause);
+      if(OutputLevel >= 2)
+      {
+         fprintf(GlobalOut, "# New clause: ");
+         DPLLClausePrintLOP(GlobalOut, form->sig, pclause);
+      }
       if(DPLLClauseNormalize(pclause))
       {
-    fprintf(GlobalOut, "...discarded (tautology)\n");
-    DPLLClauseFree(pclause);
-    continue;
+         if(OutputLevel >= 2)
+         {
+            fprintf(GlobalOut, "...discarded (tautology)\n");
+         }
+         DPLLClauseFree(pclause);
+         continue;
       }
       DPLLFormulaInsertClause(form, pclause);
-      fprintf(GlobalOut, "...accepted\n");
+      if(OutputLevel >= 2)
+      {
+         fprintf(GlobalOut, "...accepted\n");
+      }
    }
    terms->sig = NULL;
    TBFree(terms);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: DPLLFormulaAddGroundSet()
+//
+//   Add the clauses of a ground set to form. Atoms are identified by
+//   the literal codes of the ground set (i.e. the term bank entry
+//   numbers of the atoms, as for DIMACS output) and are not entered
+//   into form->sig. Tautologies are discarded. Returns the number of
+//   clauses inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes form, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long DPLLFormulaAddGroundSet(DPLLFormula_p form, GroundSet_p set)
+{
+   PropClause_p handle;
+   DPLLClause_p pclause;
+   GCUEncoding  status;
+   long         i, res = 0;
+   int          j;
+
+   for(i=0; i<set->units->size; i++)
+   {
+      status = PDArrayElementInt(set->units, i);
+      if(status&GCUPos)
+      {
+         pclause = DPLLClauseAlloc(1);
+         pclause->literals[0] = i;
+         DPLLFormulaInsertClause(form, pclause);
+         res++;
+      }
+      if(status&GCUNeg)
+      {
+         pclause = DPLLClauseAlloc(1);
+         pclause->literals[0] = -i;
+         DPLLFormulaInsertClause(form, pclause);
+         res++;
+      }
+   }
+   for(handle = set->non_units->list; handle; handle = handle->next)
+   {
+      pclause = DPLLClauseAlloc(handle->lit_no);
+      for(j=0; j<handle->lit_no; j++)
+      {
+         pclause->literals[j] = handle->literals[j].lit->entry_no;
+         if(!(handle->literals[j].properties&EPIsPositive))
+         {
+            pclause->literals[j] = -pclause->literals[j];
+         }
+      }
+      if(DPLLClauseNormalize(pclause))
+      {
+         DPLLClauseFree(pclause);
+         continue;
+      }
+      DPLLFormulaInsertClause(form, pclause);
+      res++;
+   }
+   return res;
+}
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
@@ -27,6 +27,7 @@ Changes
 
 #define CPR_DPLLFORMULA
 
+#include <ccl_grounding.h>
 #include <cpr_propclauses.h>
 
 /*---------------------------------------------------------------------*/
@@ -71,6 +72,7 @@ void DPLLRegisterClauseLiteral(DPLLFormula_p form,
                 PLiteralCode lit);
 void DPLLFormulaInsertClause(DPLLFormula_p form, DPLLClause_p clause);
 void DPLLFormulaParseLOP(Scanner_p in, Sig_p sig, DPLLFormula_p form);
+long DPLLFormulaAddGroundSet(DPLLFormula_p form, GroundSet_p set);
 
 #endif
 
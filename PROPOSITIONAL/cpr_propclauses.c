@@ -60,12 +60,12 @@ int p_atom_compare(const void* atom1, const void* atom2)
 
    PLiteralCode abs_a1, abs_a2;
 
-   if(a1==a2)
+   if(*a1==*a2)
    {
       return 0;
    }
    abs_a1 = ABS(*a1);
-   abs_a2 = ABS(*a1);
+   abs_a2 = ABS(*a2);
    if(abs_a1 < abs_a2)
    {
       return -1;
@@ -86,6 +86,32 @@ int p_atom_compare(const void* atom1, const void* atom2)
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: DPLLClauseAlloc()
+//
+//   Allocate a DPLLClause with space for lit_no (uninitialized)
+//   literals.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations.
+//
+/----------------------------------------------------------------------*/
+
+DPLLClause_p DPLLClauseAlloc(long lit_no)
+{
+   DPLLClause_p handle = DPLLClauseCellAlloc();
+
+   handle->lit_no    = lit_no;
+   handle->active_no = lit_no;
+   handle->mem_size  = MAX(lit_no,1)*sizeof(PLiteralCode);
+   handle->literals  = SizeMalloc(handle->mem_size);
+
+   return handle;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: DPLLClauseFree()
@@ -121,16 +147,11 @@ void DPLLClauseFree(DPLLClause_p junk)
 DPLLClause_p DPLLClauseFromClause(PropSig_p psig, Clause_p clause)
 {
    long         lit_no = ClauseLiteralNumber(clause);
-   DPLLClause_p handle = DPLLClauseCellAlloc();
+   DPLLClause_p handle = DPLLClauseAlloc(lit_no);
    Eqn_p        eqn;
    long         i;
    PLiteralCode    atom;
 
-   handle->lit_no    = lit_no;
-   handle->active_no = lit_no;
-   handle->mem_size  = lit_no*sizeof(PLiteralCode);
-   handle->literals  = SizeMalloc(handle->mem_size);
-
    for(i=0,eqn=clause->literals;
        eqn;
        i++,eqn=eqn->next)
@@ -61,6 +61,7 @@ typedef struct dpll_clause_cell
 
 #define DPLLClauseIsUnit(clause) ((clause)->active_no==1)
 
+DPLLClause_p DPLLClauseAlloc(long lit_no);
 void         DPLLClauseFree(DPLLClause_p junk);
 DPLLClause_p DPLLClauseFromClause(PropSig_p psig, Clause_p clause);
 bool         DPLLClauseNormalize(DPLLClause_p clause);
@@ -0,0 +1,411 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_satcheck.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Incremental SAT checking of the ground abstraction of a clause
+  set. Instances are built in a private term bank by binding the
+  variables of a clause to one canonical variable per sort (which
+  plays the role of the fresh constant) and inserting the literal
+  terms.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 01:17:52 CEST 2026
+    New
+<2> Wed Oct 21 09:12:40 CEST 2026
+    Distinguish the canonical variables from shared terms in atom
+    keys
+
+-----------------------------------------------------------------------*/
+
+#include "cpr_satcheck.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* f_code of the canonical variable that stands for the fresh
+   constant of each sort */
+
+#define SATCHECK_CONST_VAR -2
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: satcheck_get_atom()
+//
+//   Return the propositional atom for the (ground) atom with the
+//   given key, creating it if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes check->atoms
+//
+/----------------------------------------------------------------------*/
+
+static long satcheck_get_atom(SatCheck_p check, long key)
+{
+   NumTree_p cell;
+   IntOrP    val1, val2;
+
+   cell = NumTreeFind(&(check->atoms), key);
+   if(cell)
+   {
+      return cell->val1.i_val;
+   }
+   val1.i_val = ++check->atom_count;
+   val2.i_val = 0;
+   NumTreeStore(&(check->atoms), key, val1, val2);
+   return val1.i_val;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: satcheck_term_id()
+//
+//   Return a positive number identifying a term of the private
+//   bank. Shared terms are numbered by (even) entry numbers, the
+//   canonical variables (whose entry number is their negative
+//   f_code, the same for all sorts) by odd numbers derived from their
+//   sort.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long satcheck_term_id(Term_p term)
+{
+   if(TermIsVar(term))
+   {
+      assert(term->f_code == SATCHECK_CONST_VAR);
+      return 2*(long)term->sort+1;
+   }
+   assert(term->entry_no > 0);
+   return 2*term->entry_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: satcheck_literal_code()
+//
+//   Insert the instance of lit under the current bindings into the
+//   private bank and return its propositional literal. Return 0 if
+//   the instance is a trivial equation, with *taut set if it is
+//   also positive.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the private bank and atom map
+//
+/----------------------------------------------------------------------*/
+
+static PLiteralCode satcheck_literal_code(SatCheck_p check, Eqn_p lit,
+                                          bool *taut)
+{
+   Term_p lterm, rterm;
+   long   key, min, max;
+
+   lterm = TBInsertNoProps(check->terms, lit->lterm, DEREF_ALWAYS);
+   if(EqnIsEquLit(lit))
+   {
+      rterm = TBInsertNoProps(check->terms, lit->rterm, DEREF_ALWAYS);
+      if(lterm == rterm)
+      {
+         *taut = EqnIsPositive(lit);
+         return 0;
+      }
+      min = MIN(satcheck_term_id(lterm), satcheck_term_id(rterm));
+      max = MAX(satcheck_term_id(lterm), satcheck_term_id(rterm));
+   }
+   else
+   {
+      /* Term ids are positive, so 0 marks non-equational atoms */
+      min = 0;
+      max = satcheck_term_id(lterm);
+   }
+   assert(max < (1L<<31));
+   key = (max<<32)|min;
+
+   return EqnIsPositive(lit)?
+      satcheck_get_atom(check, key):-satcheck_get_atom(check, key);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatCheckAlloc()
+//
+//   Allocate an empty ground abstraction for clauses over sig.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SatCheck_p SatCheckAlloc(Sig_p sig, bool use_selectors)
+{
+   SatCheck_p handle = SatCheckCellAlloc();
+
+   handle->terms         = TBAlloc(sig);
+   handle->solver        = CDCLStateAlloc();
+   handle->atoms         = NULL;
+   handle->selectors     = NULL;
+   handle->use_selectors = use_selectors;
+   handle->atom_count    = 0;
+   handle->base          = 0;
+   handle->clauses       = 0;
+   handle->instances     = 0;
+   handle->checks        = 0;
+   handle->unknown       = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatCheckFree()
+//
+//   Free a ground abstraction. The signature is not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SatCheckFree(SatCheck_p junk)
+{
+   junk->terms->sig = NULL;
+   TBFree(junk->terms);
+   CDCLStateFree(junk->solver);
+   NumTreeFree(junk->atoms);
+   NumTreeFree(junk->selectors);
+   SatCheckCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatCheckAddClause()
+//
+//   Add the ground instance of clause (all variables of a sort
+//   mapped to the same fresh constant) to the abstraction. With
+//   selectors, the clause (by ident) is associated with a fresh
+//   selector atom, replacing any earlier association. Return true if
+//   a propositional clause has been added, false if the instance is
+//   a tautology.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes check, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool SatCheckAddClause(SatCheck_p check, Clause_p clause)
+{
+   PTree_p      vars = NULL, node;
+   PStack_p     trav;
+   Term_p       var;
+   Eqn_p        lit;
+   PLiteralCode *lits, code;
+   long         lit_no = 0, size;
+   bool         taut = false;
+   NumTree_p    cell;
+   IntOrP       val1, val2;
+
+   check->clauses++;
+   ClauseCollectVariables(clause, &vars);
+   trav = PTreeTraverseInit(vars);
+   while((node = PTreeTraverseNext(trav)))
+   {
+      var = node->key;
+      var->binding = VarBankVarAssertAlloc(check->terms->vars,
+                                           SATCHECK_CONST_VAR,
+                                           var->sort);
+   }
+   PTreeTraverseExit(trav);
+
+   size = (ClauseLiteralNumber(clause)+1)*sizeof(PLiteralCode);
+   lits = SizeMalloc(size);
+   for(lit = clause->literals; lit && !taut; lit = lit->next)
+   {
+      code = satcheck_literal_code(check, lit, &taut);
+      if(code)
+      {
+         lits[lit_no++] = code;
+      }
+   }
+
+   trav = PTreeTraverseInit(vars);
+   while((node = PTreeTraverseNext(trav)))
+   {
+      var = node->key;
+      var->binding = NULL;
+   }
+   PTreeTraverseExit(trav);
+   PTreeFree(vars);
+
+   if(!taut)
+   {
+      if(check->use_selectors)
+      {
+         val1.i_val = ++check->atom_count;
+         val2.i_val = 0;
+         lits[lit_no++] = -val1.i_val;
+         cell = NumTreeFind(&(check->selectors), clause->ident);
+         if(cell)
+         {
+            cell->val1 = val1;
+         }
+         else
+         {
+            NumTreeStore(&(check->selectors), clause->ident, val1, val2);
+         }
+      }
+      CDCLStateAddClause(check->solver, lits, lit_no);
+      check->instances++;
+   }
+   SizeFree(lits, size);
+
+   return !taut;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatCheckSolve()
+//
+//   Check the abstraction for satisfiability with at most
+//   conflict_limit conflicts. With selectors, only the instances of
+//   clauses on live are active, and on unsatisfiability the clauses
+//   from live needed for the refutation are pushed onto core.
+//
+// Global Variables: -
+//
+// Side Effects    : Runs the solver
+//
+/----------------------------------------------------------------------*/
+
+CDCLResult SatCheckSolve(SatCheck_p check, PStack_p live,
+                         long conflict_limit, PStack_p core)
+{
+   PLiteralCode  *assumptions = NULL;
+   long          assumption_no = 0, size = 0;
+   PStackPointer i;
+   NumTree_p     cell, failed = NULL;
+   Clause_p      clause;
+   IntOrP        dummy;
+   CDCLResult    res;
+
+   check->checks++;
+   if(check->use_selectors && live && PStackGetSP(live))
+   {
+      size = PStackGetSP(live)*sizeof(PLiteralCode);
+      assumptions = SizeMalloc(size);
+      for(i=0; i<PStackGetSP(live); i++)
+      {
+         clause = PStackElementP(live, i);
+         cell = NumTreeFind(&(check->selectors), clause->ident);
+         if(cell)
+         {
+            assumptions[assumption_no++] = cell->val1.i_val;
+         }
+      }
+   }
+   res = CDCLSolveAssumptions(check->solver, assumptions, assumption_no,
+                              conflict_limit);
+   if(res == CDCLUnknown)
+   {
+      check->unknown++;
+   }
+   if(res == CDCLUnsatisfiable && core && check->use_selectors)
+   {
+      dummy.i_val = 0;
+      for(i=0; i<PStackGetSP(CDCLCore(check->solver)); i++)
+      {
+         NumTreeStore(&failed, PStackElementInt(CDCLCore(check->solver), i),
+                      dummy, dummy);
+      }
+      for(i=0; live && i<PStackGetSP(live); i++)
+      {
+         clause = PStackElementP(live, i);
+         cell = NumTreeFind(&(check->selectors), clause->ident);
+         if(cell && NumTreeFind(&failed, cell->val1.i_val))
+         {
+            PStackPushP(core, clause);
+         }
+      }
+      NumTreeFree(failed);
+   }
+   if(assumptions)
+   {
+      SizeFree(assumptions, size);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatCheckPrintStatistics()
+//
+//   Print statistics about the abstraction and the solver as
+//   comments.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void SatCheckPrintStatistics(FILE* out, SatCheck_p check)
+{
+   fprintf(out, "# SAT checks                           : %ld\n",
+           check->checks);
+   fprintf(out, "# ...of these hit the conflict limit   : %ld\n",
+           check->unknown);
+   fprintf(out, "# Clauses in ground abstraction        : %ld\n",
+           check->clauses);
+   fprintf(out, "# ...non-tautological instances        : %ld\n",
+           check->instances);
+   fprintf(out, "# Propositional atoms                  : %ld\n",
+           check->atom_count);
+   fprintf(out, "# SAT solver conflicts                 : %ld\n",
+           check->solver->conflicts);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
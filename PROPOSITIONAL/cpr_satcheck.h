@@ -0,0 +1,85 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_satcheck.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Incremental checking of the ground abstraction of a first-order
+  clause set: Every clause is instantiated by mapping all its
+  variables of a given sort to a single fresh constant of that sort,
+  equational atoms are abstracted to propositional variables, and
+  the resulting propositional clauses are added to a CDCL
+  solver. If the abstraction is unsatisfiable, so is the original
+  clause set.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 01:17:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CPR_SATCHECK
+
+#define CPR_SATCHECK
+
+#include <cpr_cdcl.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* If use_selectors is set, every encoded clause C gets a fresh
+   selector atom s, its instance is added as (~s | C), and the check
+   assumes s for the clauses that are still alive. The failed
+   assumptions then identify the clauses used in a refutation. */
+
+typedef struct satcheckcell
+{
+   TB_p         terms;         /* Private bank for ground instances */
+   CDCLState_p  solver;
+   NumTree_p    atoms;         /* Entry numbers of the sides of an
+                                  atom -> propositional atom */
+   NumTree_p    selectors;     /* Clause ident -> selector atom */
+   bool         use_selectors;
+   long         atom_count;
+   long         base;          /* Controlling process: Progress
+                                  counter at the last check */
+   /* Statistics */
+   long         clauses;       /* Encoded first-order clauses */
+   long         instances;     /* ...that were not tautologies */
+   long         checks;
+   long         unknown;       /* Checks hitting the conflict limit */
+}SatCheckCell, *SatCheck_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define SatCheckCellAlloc() (SatCheckCell*)SizeMalloc(sizeof(SatCheckCell))
+#define SatCheckCellFree(junk)            SizeFree(junk, sizeof(SatCheckCell))
+
+SatCheck_p SatCheckAlloc(Sig_p sig, bool use_selectors);
+void       SatCheckFree(SatCheck_p junk);
+
+bool       SatCheckAddClause(SatCheck_p check, Clause_p clause);
+CDCLResult SatCheckSolve(SatCheck_p check, PStack_p live,
+                         long conflict_limit, PStack_p core);
+
+void       SatCheckPrintStatistics(FILE* out, SatCheck_p check);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
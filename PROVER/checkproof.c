@@ -27,6 +27,7 @@ Changes
 #include <cio_tempfile.h>
 #include <cio_signals.h>
 #include <pcl_proofcheck.h>
+#include <pcl_protindex.h>
 #include <e_version.h>
 
 
@@ -47,7 +48,9 @@ typedef enum
    OPT_OUTPUTLEVEL,
    OPT_PROVERTYPE,
    OPT_EXECUTABLE,
-   OPT_TIME_LIMIT
+   OPT_TIME_LIMIT,
+   OPT_JOBS,
+   OPT_PROOF_ONLY
 }OptionCodes;
 
 
@@ -117,6 +120,19 @@ OptCell opts[] =
     "Limit the CPU time prover may spend on a single step. Default is"
     " 10 seconds."},
 
+   {OPT_JOBS,
+    'j', "jobs",
+    ReqArg, NULL,
+    "Run up to this many prover processes in parallel. Results are "
+    "still printed in the order of the steps. Default is 1."},
+
+   {OPT_PROOF_ONLY,
+    '\0', "proof-steps-only",
+    NoArg, NULL,
+    "Check only the steps needed for the \"proof\", \"final\" and "
+    "\"extract\" steps of the protocol. The input is first only "
+    "indexed, and only these steps are parsed."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -127,6 +143,8 @@ char       *outname    = NULL;
 long       time_limit  = 10;
 char       *executable = NULL;
 ProverType prover      = EProver;
+bool       proof_only  = false;
+int        jobs        = 1;
 
 
 /*---------------------------------------------------------------------*/
@@ -146,6 +164,7 @@ int main(int argc, char* argv[])
    CLState_p   state;
    Scanner_p   in;
    PCLProt_p   prot;
+   PCLProtIndex_p index;
    long        steps,res,unchecked;
    int         i;
 
@@ -172,17 +191,31 @@ int main(int argc, char* argv[])
       CLStateInsertArg(state, "-");
    }
    steps = 0;
-   for(i=0; state->argv[i]; i++)
+   if(proof_only)
    {
-      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
-      ScannerSetFormat(in, TPTPFormat);
-      steps+=PCLProtParse(in, prot);
-      CheckInpTok(in, NoToken);
-      DestroyScanner(in);
+      index = PCLProtIndexAlloc();
+      for(i=0; state->argv[i]; i++)
+      {
+         PCLProtIndexAddFile(index, state->argv[i]);
+      }
+      steps = PCLProtIndexParseReachable(index, prot);
+      PCLProtIndexFree(index);
+   }
+   else
+   {
+      for(i=0; state->argv[i]; i++)
+      {
+         in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+         ScannerSetFormat(in, TPTPFormat);
+         steps+=PCLProtParse(in, prot);
+         CheckInpTok(in, NoToken);
+         DestroyScanner(in);
+      }
    }
    VERBOUT2("PCL input read\n");
 
-   res = PCLProtCheck(prot,prover,executable,time_limit, &unchecked);
+   res = PCLProtCheck(prot,prover,executable,time_limit, jobs,
+                      &unchecked);
 
    fprintf(GlobalOut,
          "# Successfully checked %ld of %ld steps (%ld unchecked): ",
@@ -297,6 +330,17 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_TIME_LIMIT:
        time_limit = CLStateGetIntArg(handle, arg);
        break;
+      case OPT_JOBS:
+       jobs = CLStateGetIntArg(handle, arg);
+       if(jobs < 1)
+       {
+          Error("Option -j (--jobs) requires a positive argument",
+                USAGE_ERROR);
+       }
+       break;
+      case OPT_PROOF_ONLY:
+       proof_only = true;
+       break;
       default:
     assert(false);
     break;
@@ -0,0 +1,262 @@
+/*-----------------------------------------------------------------------
+
+File  : e_axcache.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Create precompiled axiom caches (see CLAUSES/ccl_axiomcache.h) for
+  TPTP/TSTP axiom files.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 14:02:37 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <clb_defines.h>
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <ccl_axiomcache.h>
+#include <e_version.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME         "e_axcache"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_TPTP_PARSE,
+   OPT_TSTP_PARSE,
+   OPT_FREE_NUMBERS,
+   OPT_FREE_OBJECTS,
+   OPT_DUMMY
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    'V', "version",
+    NoArg, NULL,
+    "Print the version number of the program. Please include this"
+    " with all bug reports (if any)."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp-in",
+    NoArg, NULL,
+    "Parse TPTP-2 format instead of TPTP-3. The cache is only used "
+    "if the file is included from a TPTP-2 file."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tstp-in",
+    NoArg, NULL,
+    "Parse TPTP-3 format (the default)."},
+
+   {OPT_FREE_NUMBERS,
+    '\0', "free-numbers",
+    NoArg, NULL,
+    "Treat numbers as normal free function symbols. The cache is "
+    "only used by a prover run with the same setting (note that "
+    "e_ltb_runner always treats numbers as free)."},
+
+   {OPT_FREE_OBJECTS,
+    '\0', "free-objects",
+    NoArg, NULL,
+    "Treat object identifiers as normal free function symbols. The "
+    "cache is only used by a prover run with the same setting."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+IOFormat           parse_format = TSTPFormat;
+FunctionProperties free_symb_prop = FPIgnoreProps;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   DStr_p    cache_name = DStrAlloc();
+   long      count;
+   int       i;
+
+   assert(argv[0]);
+
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+
+   if(state->argc < 1)
+   {
+      print_help(stdout);
+      exit(NO_ERROR);
+   }
+   for(i=0; state->argv[i]; i++)
+   {
+      DStrSet(cache_name, state->argv[i]);
+      DStrAppendStr(cache_name, AXIOM_CACHE_SUFFIX);
+      count = AxiomCacheCreate(state->argv[i], parse_format,
+                               FPDistinctProp&~free_symb_prop,
+                               DStrView(cache_name));
+      fprintf(stdout, "# %s: %ld formulas and clauses cached in %s\n",
+              state->argv[i], count, DStrView(cache_name));
+   }
+   DStrFree(cache_name);
+   CLStateFree(state);
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+   return NO_ERROR;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, parse_format, free_symb_prop
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            fprintf(stdout, NAME " " VERSION " " E_NICKNAME "\n");
+            exit(NO_ERROR);
+      case OPT_TPTP_PARSE:
+            parse_format = TPTPFormat;
+            break;
+      case OPT_TSTP_PARSE:
+            parse_format = TSTPFormat;
+            break;
+      case OPT_FREE_NUMBERS:
+            free_symb_prop = free_symb_prop|FPIsInteger|FPIsRational|FPIsFloat;
+            break;
+      case OPT_FREE_OBJECTS:
+            free_symb_prop = free_symb_prop|FPIsObject;
+            break;
+      default:
+            assert(false && "Unknown option");
+            break;
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n"
+NAME " " VERSION " \"" E_NICKNAME "\"\n\
+\n\
+Usage: " NAME " [options] files\n\
+\n\
+Create a precompiled cache <file>.ecache for each of the given\n\
+(untyped) TPTP axiom files. Whenever E includes a file with an\n\
+up-to-date cache (the cache stores the size and a hash of the file\n\
+content), the cache is loaded instead of parsing the file. The\n\
+result is the same as parsing the file. Stale or incompatible caches\n\
+are ignored.\n\
+\n");
+   PrintOptions(stdout, opts, "Options:\n\n");
+   fprintf(out, "\n\
+"STS_COPYRIGHT", " STS_MAIL "\n\
+\n\
+You can find the latest version of E and additional information at\n"
+E_URL
+"\n\n"
+"This program is free software; you can redistribute it and/or modify\n\
+it under the terms of the GNU General Public License as published by\n\
+the Free Software Foundation; either version 2 of the License, or\n\
+(at your option) any later version.\n\
+\n\
+This program is distributed in the hope that it will be useful,\n\
+but WITHOUT ANY WARRANTY; without even the implied warranty of\n\
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n\
+GNU General Public License for more details.\n\
+\n\
+You should have received a copy of the GNU General Public License\n\
+along with this program (it should be contained in the top level\n\
+directory of the distribution in the file COPYING); if not, write to\n\
+the Free Software Foundation, Inc., 59 Temple Place, Suite 330,\n\
+Boston, MA  02111-1307 USA\n"
+"\n\
+The original copyright holder can be contacted as\n\
+\n"
+STS_SNAIL
+"\n");
+
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -51,6 +51,7 @@ typedef enum
    OPT_SEED_SUBSAMPLE,
    OPT_SEED_METHODS,
    OPT_DUMP_FILTER,
+   OPT_DIFF_OUTPUT,
    OPT_PRINT_STATISTICS,
    OPT_SILENT,
    OPT_OUTPUTLEVEL,
@@ -160,6 +161,15 @@ OptCell opts[] =
     NoArg, NULL,
      "Print the filter definition in force."},
 
+   {OPT_DIFF_OUTPUT,
+    '\0', "diff-output",
+    NoArg, NULL,
+    "For filters whose selection extends the selection of a filter "
+    "already applied (i.e. SinE filters that only differ in the "
+    "recursion depth or size limits), write only the additional "
+    "axioms. The name of the extended filter is recorded in the "
+    "header of the output file."},
+
    {OPT_LOP_PARSE,
     '\0', "lop-in",
     NoArg, NULL,
@@ -228,6 +238,7 @@ IOFormat parse_format = AutoFormat;
 char     *outname     = NULL;
 char     *filtername  = NULL;
 bool     dumpfilter   = false;
+bool     diff_output  = false;
 bool     seed_preds   = false,
          seed_funs    = false,
          seed_consts  = false,
@@ -258,7 +269,9 @@ void print_help(FILE* out);
 //   Given a structured problem data structure, an axfilter, and the
 //   core name of the output, apply the filter to the problem and
 //   write the result into a properly named file (which is determined
-//   from the core name and the filter name).
+//   from the core name and the filter name). If base is given, only
+//   write the axioms not selected by base (filter has to extend
+//   base).
 //
 // Global Variables: -
 //
@@ -268,6 +281,7 @@ void print_help(FILE* out);
 
 void filter_problem(StructFOFSpec_p ctrl,
                     AxFilter_p filter,
+                    AxFilter_p base,
                     char* corename, char* desc)
 {
    DStr_p   filename = DStrAlloc();
@@ -282,10 +296,21 @@ void filter_problem(StructFOFSpec_p ctrl,
    formulas = PStackAlloc();
    clauses  = PStackAlloc();
 
-   StructFOFSpecGetProblem(ctrl,
-                           filter,
-                           clauses,
-                           formulas);
+   if(base)
+   {
+      StructFOFSpecGetProblemDiff(ctrl,
+                                  filter,
+                                  base,
+                                  clauses,
+                                  formulas);
+   }
+   else
+   {
+      StructFOFSpecGetProblem(ctrl,
+                              filter,
+                              clauses,
+                              formulas);
+   }
 
    fprintf(GlobalOut, "# Filter: %s goes into file %s\n",
            filter->name,
@@ -294,6 +319,11 @@ void filter_problem(StructFOFSpec_p ctrl,
    fp = fopen(DStrView(filename), "w");
    fprintf(fp, "%% Filter %s on file %s\n",
            filter->name, corename);
+   if(base)
+   {
+      fprintf(fp, "%% Extends filter %s (only additional axioms)\n",
+              base->name);
+   }
    if(desc)
    {
       fprintf(fp, "%s", desc);
@@ -311,9 +341,10 @@ void filter_problem(StructFOFSpec_p ctrl,
 //
 // Function: all_filters_problem()
 //
-//   Apply all filters to problems.
+//   Apply all filters to problems. SinE filters that only differ in
+//   their limits share a single selection run.
 //
-// Global Variables:
+// Global Variables: diff_output
 //
 // Side Effects    : Writes result files
 //
@@ -325,18 +356,38 @@ void all_filters_problem(StructFOFSpec_p ctrl,
                          bool hypo_filter_only,
                          char *desc)
 {
-   int i;
+   PStack_p   applied = PStackAlloc();
+   AxFilter_p filter, base, handle;
+   int        i, j;
 
    for(i=0; i<AxFilterSetElements(filters); i++)
+   {
+      filter = AxFilterSetGetFilter(filters,i);
+      if(!hypo_filter_only || filter->use_hypotheses)
+      {
+         PStackPushP(applied, filter);
+      }
+   }
+   StructFOFSpecInitRelevance(ctrl, applied);
+
+   for(i=0; i<PStackGetSP(applied); i++)
    {
       /* SigPrint(stdout,ctrl->sig); */
-      if(!hypo_filter_only || AxFilterSetGetFilter(filters,i)->use_hypotheses)
+      filter = PStackElementP(applied, i);
+      base   = NULL;
+      for(j=0; diff_output && j<i; j++)
       {
-         filter_problem(ctrl,
-                        AxFilterSetGetFilter(filters,i),
-                        corename, desc);
+         handle = PStackElementP(applied, j);
+         if(StructFOFSpecFilterExtends(ctrl, filter, handle) &&
+            (!base || StructFOFSpecFilterExtends(ctrl, handle, base)))
+         {
+            base = handle;
+         }
       }
+      filter_problem(ctrl, filter, base, corename, desc);
    }
+   StructFOFSpecResetRelevance(ctrl);
+   PStackFree(applied);
 }
 
 
@@ -940,6 +991,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DUMP_FILTER:
             dumpfilter = true;
             break;
+      case OPT_DIFF_OUTPUT:
+            diff_output = true;
+            break;
       case OPT_LOP_PARSE:
       case OPT_LOP_FORMAT:
             parse_format = LOPFormat;
@@ -40,6 +40,7 @@ typedef enum
    OPT_OUTPUT,
    OPT_PRINT_STATISTICS,
    OPT_EXPENSIVE_DETAILS,
+   OPT_PERF_COUNTERS,
    OPT_PRINT_SATURATED,
    OPT_PRINT_SAT_INFO,
    OPT_FILTER_SATURATED,
@@ -84,6 +85,7 @@ typedef enum
    OPT_SATAUTODEV,
    OPT_AUTO_SCHED,
    OPT_SATAUTO_SCHED,
+   OPT_AUTO_TABLE,
    OPT_NO_PREPROCESSING,
    OPT_EQ_UNFOLD_LIMIT,
    OPT_EQ_UNFOLD_MAXCLAUSES,
@@ -91,6 +93,7 @@ typedef enum
    OPT_SINE,
    OPT_REL_PRUNE_LEVEL,
    OPT_PRESAT_SIMPLIY,
+   OPT_PRESAT_WORKERS,
    OPT_AC_HANDLING,
    OPT_AC_ON_PROC,
    OPT_LITERAL_SELECT,
@@ -110,6 +113,9 @@ typedef enum
    OPT_FILTER_LIMIT,
    OPT_FILTER_COPIES_LIMIT,
    OPT_REWEIGHT_LIMIT,
+   OPT_REWEIGHT_BATCH,
+   OPT_SAT_CHECK_LIMIT,
+   OPT_SAT_CHECK_CONFLICTS,
    OPT_DELETE_BAD_LIMIT,
    OPT_ASSUME_COMPLETENESS,
    OPT_ASSUME_INCOMPLETENESS,
@@ -166,7 +172,9 @@ typedef enum
    OPT_FREE_OBJECTS,
    OPT_DEF_CNF_OLD,
    OPT_DEF_CNF,
+   OPT_DEF_CNF_SHARED,
    OPT_MINISCOPE_LIMIT,
+   OPT_CNF_WORKERS,
    OPT_PRINT_TYPES,
    OPT_DUMMY
 }OptionCodes;
@@ -296,6 +304,18 @@ OptCell opts[] =
     "to collect. Includes number of term cells and number of "
     "rewrite steps."},
 
+   {OPT_PERF_COUNTERS,
+    '\0', "perf-counters",
+    OptArg, "-",
+    "Enable the built-in performance counters (timers for the phases "
+    "of the proof procedure and for some expensive operations, with "
+    "nested timers attributed to the enclosing phase). The counters "
+    "are written to the file given as argument at exit and whenever "
+    "the prover receives SIGUSR1, as JSON or, if the file name ends "
+    "in '.csv', as CSV. '-' (the default) stands for stderr. Processes "
+    "forked for strategy scheduling write to <file>.<pid>. The "
+    "counters are also printed with the statistics."},
+
    {OPT_PRINT_SATURATED,
     'S', "print-saturated",
     OptArg, DEFAULT_OUTPUT_DESCRIPTOR,
@@ -594,6 +614,16 @@ OptCell opts[] =
     "Use the (experimental) strategy scheduling without SInE, thus "
     "maintaining completeness."},
 
+   {OPT_AUTO_TABLE,
+    '\0', "auto-table",
+    ReqArg, NULL,
+    "Automatically determine heuristic and term ordering using the "
+    "auto mode table in the given file instead of the compiled-in "
+    "auto mode. This is equivalent to -xAutoTable -tAutoTable "
+    "--sine=Auto. The "
+    "tool development_tools/auto_to_table.py converts the generated "
+    "che_X_*.c auto modes into this format."},
+
    {OPT_NO_PREPROCESSING,
     '\0', "no-preprocessing",
     NoArg, NULL,
@@ -641,6 +671,16 @@ OptCell opts[] =
     "Before proper saturation do a complete interreduction of "
     "the proof state."},
 
+   {OPT_PRESAT_WORKERS,
+    '\0', "presat-workers",
+    ReqArg, NULL,
+    "Use the given number of processes to remove subsumed clauses "
+    "from the initial clause set before presaturation interreduction "
+    "(see --presat-simplify). Clauses are partitioned by their "
+    "dominant predicate symbol, and each partition is checked by a "
+    "separate forked worker against the short (at most 6 literals) "
+    "initial clauses. The default of 1 disables this pass."},
+
    {OPT_AC_HANDLING,
     '\0', "ac-handling",
     OptArg, "KeepUnits",
@@ -910,7 +950,36 @@ OptCell opts[] =
     '\0', "reweight-limit",
     OptArg, "30000",
     "Set the number of new unprocessed clauses after which the set of"
-    " unprocessed clauses will be reevaluated."},
+    " unprocessed clauses will be reevaluated. Only evaluations that "
+    "can change over time (e.g. because of the priority function "
+    "used) are recomputed."},
+
+   {OPT_REWEIGHT_BATCH,
+    '\0', "reweight-batch",
+    ReqArg, NULL,
+    "Set the maximal number of unprocessed clauses that are "
+    "reevaluated in one main loop iteration when reweighting (see "
+    "--reweight-limit). The default is 1000. 0 reevaluates all "
+    "clauses at once."},
+
+   {OPT_SAT_CHECK_LIMIT,
+    '\0', "satcheck-proc-interval",
+    OptArg, "5000",
+    "Periodically check the ground abstraction of the processed "
+    "clauses (all variables of a sort replaced by the same fresh "
+    "constant) for propositional unsatisfiability, whenever the "
+    "given number of clauses has been processed since the last "
+    "check. Instances are added to the SAT solver incrementally. If "
+    "the abstraction is unsatisfiable, so is the proof problem. "
+    "Without this option, no checks are performed."},
+
+   {OPT_SAT_CHECK_CONFLICTS,
+    '\0', "satcheck-conflict-limit",
+    ReqArg, NULL,
+    "Set the maximal number of conflicts the SAT solver may "
+    "encounter in a single check of the ground abstraction (see "
+    "--satcheck-proc-interval). The default is 10000, 0 means "
+    "no limit."},
 
    {OPT_ORDERING,
     't', "term-ordering",
@@ -1253,6 +1322,16 @@ OptCell opts[] =
     "some exotic formulae. The two may produce slightly different "
     "(but equisatisfiable) clause normal forms."},
 
+   {OPT_DEF_CNF_SHARED,
+    '\0', "definitional-cnf-shared",
+    OptArg, TFORM_SHARE_LIMIT_STR,
+    "Also introduce definitions for subformulae that would be "
+    "replicated by clausification at least as often as the argument "
+    "across the whole problem, even if they are too small to be "
+    "renamed within any single formula. This helps for large problems "
+    "where the same subformulae occur in many axioms. Without this "
+    "option, no such definitions are introduced."},
+
    {OPT_MINISCOPE_LIMIT,
     '\0', "miniscope-limit",
     OptArg, TFORM_MINISCOPE_LIMIT_STR,
@@ -1260,6 +1339,16 @@ OptCell opts[] =
     "default is 1000. Only applies to the new (default) clausification "
     "algorithm"},
 
+   {OPT_CNF_WORKERS,
+    '\0', "cnf-workers",
+    ReqArg, NULL,
+    "Use the given number of processes to clausify the input formulas. "
+    "The formulas are split into chunks in input order, each chunk is "
+    "clausified by a separate forked worker, and the results are "
+    "combined in order, so that the clause set is the same as with a "
+    "single process. Only used without proof output and for inputs of "
+    "at least 200 formulas. The default of 1 disables this."},
+
    {OPT_PRINT_TYPES,
     '\0', "print-types",
     NoArg, NULL,
@@ -6,7 +6,8 @@ Author: Stephan Schulz
 
 Contents
 
-  Read a ground problem and try to refute (or satisfy) it.
+  Read a ground problem and try to refute (or satisfy) it with the
+  CDCL solver.
 
   Copyright 2003 by the author.
   This code is released under the GNU General Public Licence and
@@ -18,13 +19,15 @@ Changes
 
 <1> Thu May  1 20:40:24 CEST 2003
     New
+<2> Mon Oct 19 23:58:02 CEST 2026
+    Actually solve the problem (with cpr_cdcl.c)
 
 -----------------------------------------------------------------------*/
 
 #include <cio_commandline.h>
 #include <cio_output.h>
 #include <cio_signals.h>
-#include <cpr_dpll.h>
+#include <cpr_cdcl.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -44,6 +47,8 @@ typedef enum
    OPT_OUTPUTLEVEL,
    OPT_TPTP_PARSE,
    OPT_DIMACS_PRINT,
+   OPT_PRINT_STATISTICS,
+   OPT_CONFLICT_LIMIT,
    OPT_MEM_LIMIT,
    OPT_CPU_LIMIT,
    OPT_SOFTCPU_LIMIT,
@@ -100,8 +105,21 @@ OptCell opts[] =
    {OPT_DIMACS_PRINT,
     'd', "dimacs",
     NoArg, NULL,
-    "Print output in the DIMACS format suitable for many propositional "
-    "provers."},
+    "Print the result in the format of the SAT competitions (a status "
+    "line and, for satisfiable problems, the model) instead of as an "
+    "SZS status."},
+
+   {OPT_PRINT_STATISTICS,
+    '\0', "print-statistics",
+    NoArg, NULL,
+    "Print statistics about the search."},
+
+   {OPT_CONFLICT_LIMIT,
+    'C', "conflict-limit",
+    ReqArg, NULL,
+    "Give up after the given number of conflicts. The default (0) is "
+    "to search until the problem is decided or the soft CPU time limit "
+    "is reached."},
 
    {OPT_MEM_LIMIT,
     'm', "memory-limit",
@@ -127,8 +145,8 @@ OptCell opts[] =
    {OPT_SOFTCPU_LIMIT,
     '\0', "soft-cpu-limit",
     OptArg, "310",
-    "Limit the cpu time spend in grounding. After the time expires,"
-    " the prover will print an partial system."},
+    "Limit the cpu time spend in search. After the time expires,"
+    " the prover will give up (with a proper status)."},
 
     {OPT_NOOPT,
     '\0', NULL,
@@ -139,6 +157,8 @@ OptCell opts[] =
 char   *outname = NULL;
 IOFormat parse_format = LOPFormat;
 bool   dimacs_format = false;
+bool   print_statistics = false;
+long   conflict_limit = 0;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -159,7 +179,8 @@ int main(int argc, char* argv[])
    int             i;
    CLState_p       state;
    DPLLFormula_p   form;
-   DPLLState_p     dpllstate;
+   CDCLState_p     solver;
+   CDCLResult      res;
 
    assert(argv[0]);
 #ifdef STACK_SIZE
@@ -188,12 +209,39 @@ int main(int argc, char* argv[])
       DPLLFormulaParseLOP(in, sig, form);
       DestroyScanner(in);
    }
-   dpllstate = DPLLStateAlloc(form);
-
    CLStateFree(state);
-   UNUSED(dpllstate); /* Stiffle warning for now */
+
+   solver = CDCLStateAlloc();
+   CDCLStateAddFormula(solver, form);
+   res = CDCLSolve(solver, conflict_limit);
+
+   if(dimacs_format)
+   {
+      switch(res)
+      {
+      case CDCLSatisfiable:
+            fprintf(GlobalOut, "s SATISFIABLE\n");
+            CDCLPrintModel(GlobalOut, solver);
+            break;
+      case CDCLUnsatisfiable:
+            fprintf(GlobalOut, "s UNSATISFIABLE\n");
+            break;
+      default:
+            fprintf(GlobalOut, "s UNKNOWN\n");
+            break;
+      }
+   }
+   else
+   {
+      fprintf(GlobalOut, "# SZS status %s\n", CDCLResultSZSStatus(res));
+   }
+   if(print_statistics)
+   {
+      CDCLPrintStatistics(GlobalOut, solver);
+   }
 #ifndef FAST_EXIT
-   DPLLStateFree(dpllstate);
+   CDCLStateFree(solver);
+   DPLLFormulaFree(form);
    SigFree(sig);
    SortTableFree(sort_table);
 #endif
@@ -261,6 +309,12 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DIMACS_PRINT:
        dimacs_format = true;
        break;
+      case OPT_PRINT_STATISTICS:
+       print_statistics = true;
+       break;
+      case OPT_CONFLICT_LIMIT:
+       conflict_limit = CLStateGetIntArg(handle, arg);
+       break;
       case OPT_MEM_LIMIT:
             if(strcmp(arg, "Auto")==0)
             {
@@ -359,8 +413,8 @@ void print_help(FILE* out)
 \n\
 Usage: " NAME " [options] [files]\n\
 \n\
-Read a set of ground clauses and try to refute (or satisfy) it.\n\
-Not completed yet!\n\
+Read a set of propositional clauses and try to refute (or satisfy)\n\
+it with a CDCL SAT solver.\n\
 \n");
    PrintOptions(stdout, opts, "Options\n\n");
    fprintf(out, "\n\
@@ -20,6 +20,12 @@ Changes
 
 <1> Sun May 27 23:35:28 CEST 2001
     New
+<2> Mon Oct 19 23:58:02 CEST 2026
+    Optionally decide the ground set with the built-in CDCL solver
+<3> Tue Oct 20 02:31:05 CEST 2026
+    Optionally ground in several worker processes
+<4> Wed Oct 21 10:05:18 CEST 2026
+    Unit-simplify the final ground set
 
 -----------------------------------------------------------------------*/
 
@@ -29,6 +35,7 @@ Changes
 #include <ccl_splitting.h>
 #include <ccl_grounding.h>
 #include <che_clausesetfeatures.h>
+#include <cpr_cdcl.h>
 #include <ccl_formulafunc.h>
 #include <e_version.h>
 
@@ -74,7 +81,9 @@ typedef enum
    OPT_GIVE_UP,
    OPT_CONSTRAINTS,
    OPT_LOCAL_CONSTRAINTS,
-   OPT_FIX_MINISAT
+   OPT_FIX_MINISAT,
+   OPT_SOLVE,
+   OPT_GROUND_WORKERS
 }OptionCodes;
 
 
@@ -338,6 +347,26 @@ OptCell opts[] =
     "to compensate for MiniSAT's problematic interpretation of "
     "the DIMAC syntax."},
 
+   {OPT_SOLVE,
+    'S', "solve",
+    NoArg, NULL,
+    "Decide the generated ground clause set with the built-in CDCL "
+    "SAT solver and print the SZS status of the problem. A satisfiable "
+    "ground set only implies satisfiability of the problem if the "
+    "proof state is complete."},
+
+   {OPT_GROUND_WORKERS,
+    'j', "ground-workers",
+    ReqArg, NULL,
+    "Use the given number of forked worker processes to create the "
+    "ground instances of non-unit clauses. Instances are partitioned "
+    "by clause and by the values of the first variable of each clause. "
+    "Workers simplify against the unit clauses known before they start "
+    "and stream their results back as propositional clauses, which are "
+    "merged in clause order. As the final ground set is simplified with "
+    "all unit clauses, it does not depend on the number of workers. "
+    "The default of 1 grounds sequentially."},
+
     {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -347,7 +376,8 @@ OptCell opts[] =
 char   *outname = NULL;
 IOFormat parse_format = AutoFormat;
 bool   dimacs_format = false;
-int    split_tries = 0;
+int    split_tries = 0,
+       ground_workers = 1;
 bool   new_cnf          = true,
        unit_sub = true,
        unit_res = true,
@@ -358,7 +388,8 @@ bool   new_cnf          = true,
        print_statistics = false,
        print_rusage = false,
        print_result = true,
-       fix_minisat = false;
+       fix_minisat = false,
+       solve = false;
 long   give_up = 0,
        miniscope_limit  = 1000,
        initial_literals = 0,
@@ -370,6 +401,7 @@ long   give_up = 0,
 
 CLState_p process_options(int argc, char* argv[]);
 void print_help(FILE* out);
+void solve_ground_set(GroundSet_p groundset);
 
 /*---------------------------------------------------------------------*/
 /*                         Internal Functions                          */
@@ -516,7 +548,18 @@ int main(int argc, char* argv[])
 
    groundset = GroundSetAlloc(terms);
 
-   if(constraints)
+   if(ground_workers > 1)
+   {
+      ClauseSetCreateGroundInstancesParallel(terms, clauses,
+                                             groundset,
+                                             unit_sub,
+                                             unit_res,
+                                             taut_check,
+                                             constraints,
+                                             give_up,
+                                             ground_workers);
+   }
+   else if(constraints)
    {
       ClauseSetCreateConstrGroundInstances(terms, clauses,
                   groundset,
@@ -550,6 +593,9 @@ int main(int argc, char* argv[])
                   selected_symbol);
       groundset->complete = gss_cache;
    }
+   /* Makes the result independent of the order in which instances
+      were created (and of the number of workers) */
+   GroundSetUnitSimplify(groundset, unit_sub, unit_res);
    if(OutputLevel == 1)
    {
       fputc('\n', GlobalOut);
@@ -595,6 +641,10 @@ int main(int argc, char* argv[])
    {
       fprintf(GlobalOut, "# Success!\n");
    }
+   if(solve)
+   {
+      solve_ground_set(groundset);
+   }
    if(print_statistics)
    {
       fprintf(GlobalOut,
@@ -637,6 +687,44 @@ int main(int argc, char* argv[])
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: solve_ground_set()
+//
+//   Decide the ground set with the CDCL solver and print the
+//   resulting SZS status. If the ground set is satisfiable but
+//   incomplete, nothing is known about the original problem.
+//
+// Global Variables: print_statistics
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void solve_ground_set(GroundSet_p groundset)
+{
+   DPLLFormula_p form = DPLLFormulaAlloc();
+   CDCLState_p   solver = CDCLStateAlloc();
+   CDCLResult    res;
+
+   DPLLFormulaAddGroundSet(form, groundset);
+   CDCLStateAddFormula(solver, form);
+   DPLLFormulaFree(form);
+
+   res = CDCLSolve(solver, 0);
+   if((res == CDCLSatisfiable) && (groundset->complete != cpl_complete))
+   {
+      res = CDCLUnknown;
+   }
+   fprintf(GlobalOut, "# SZS status %s\n", CDCLResultSZSStatus(res));
+   if(print_statistics)
+   {
+      CDCLPrintStatistics(GlobalOut, solver);
+   }
+   CDCLStateFree(solver);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: process_options()
@@ -814,6 +902,17 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_FIX_MINISAT:
             fix_minisat = true;
             break;
+      case OPT_SOLVE:
+            solve = true;
+            break;
+      case OPT_GROUND_WORKERS:
+            ground_workers = CLStateGetIntArg(handle, arg);
+            if(ground_workers < 1)
+            {
+               Error("Option -j (--ground-workers) requires an "
+                     "argument >= 1", USAGE_ERROR);
+            }
+            break;
       default:
             assert(false);
             break;
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Jul 23 17:46:15 MET DST 1999
     New
+<2> Tue Oct 20 04:10:32 CEST 2026
+    Option to create binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
@@ -25,7 +27,7 @@ Changes
 #include <sys/stat.h>
 #include <cio_commandline.h>
 #include <cio_output.h>
-#include <cle_kbdesc.h>
+#include <cle_kbimage.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -42,7 +44,8 @@ typedef enum
    OPT_VERBOSE,
    OPT_NEG_NO,
    OPT_NEG_PROP,
-   OPT_SELECT_EVAL
+   OPT_SELECT_EVAL,
+   OPT_BINARY
 }OptionCodes;
 
 
@@ -81,6 +84,13 @@ OptCell opts[] =
     "proportion of the positive examples) to pick if the proof "
     "listing does describe a successful proof"},
 
+   {OPT_BINARY,
+    'b', "binary",
+    NoArg, NULL,
+    "Create a binary knowledge base. Examples and clause patterns are "
+    "stored in a single image file that is mapped into memory for "
+    "loading, and inserting examples only appends to it."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -89,6 +99,7 @@ OptCell opts[] =
 
 double neg_proportion = 1.0;
 long   neg_examples   =   0;
+bool   binary         = false;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -160,15 +171,23 @@ int main(int argc, char* argv[])
       "# You need to hand-hack this at the moment.\n");
    OutClose(out);
 
-   out = OutOpen(KBFileName(name, basename, "problems"));
-   fprintf(out,
-      "# Example names and features. \n");
-   OutClose(out);
-
-   out = OutOpen(KBFileName(name, basename, "clausepatterns"));
-   fprintf(out,
-      "# Individual annotated patterns. \n");
-   OutClose(out);
+   if(binary)
+   {
+      out = OutOpen(KBFileName(name, basename, KB_IMAGE_NAME));
+      OutClose(out);
+   }
+   else
+   {
+      out = OutOpen(KBFileName(name, basename, "problems"));
+      fprintf(out,
+         "# Example names and features. \n");
+      OutClose(out);
+
+      out = OutOpen(KBFileName(name, basename, "clausepatterns"));
+      fprintf(out,
+         "# Individual annotated patterns. \n");
+      OutClose(out);
+   }
 
    VERBOUT("...done.\nCreating subdirectory FILES...\n");
 
@@ -244,6 +263,9 @@ CLState_p process_options(int argc, char* argv[])
            "requires positive argument.}", USAGE_ERROR);
        }
        break;
+      case OPT_BINARY:
+       binary = true;
+       break;
      default:
     assert(false);
     break;
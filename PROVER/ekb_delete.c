@@ -18,12 +18,15 @@ Changes
 
 <1> Wed Jul 28 16:21:33 MET DST 1999
     New
+<2> Tue Oct 20 04:10:32 CEST 2026
+    Support binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
 #include <cio_commandline.h>
 #include <cio_output.h>
 #include <cle_kbinsert.h>
+#include <cle_kbimage.h>
 
 /*---------------------------------------------------------------------*/
 /*                  Data types                                         */
@@ -100,7 +103,6 @@ int main(int argc, char* argv[])
    ExampleRep_p    to_delete;
    AnnoSet_p       clause_examples;
    TB_p            annoterms;
-   Scanner_p       in;
    SortTable_p     sort_table;
    Sig_p           sig;
 
@@ -120,23 +122,15 @@ int main(int argc, char* argv[])
 
    name = DStrAlloc();
 
-   /* Step 1: Read existing files: problems, clausepatterns, signature
+   /* Step 1: Read existing files: problems, clausepatterns (or the
+      image)
     */
    proof_examples = ExampleSetAlloc();
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "problems"),
-            true, NULL);
-   ExampleSetParse(in, proof_examples);
-   DestroyScanner(in);
-
    sort_table = DefaultSortTableAlloc();
    sig = SigAlloc(sort_table);
    annoterms = TBAlloc(sig);
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "clausepatterns"),
-            true, NULL);
-   clause_examples = AnnoSetParse(in, annoterms, KB_ANNOTATION_NO);
-   DestroyScanner(in);
+   clause_examples = AnnoSetAlloc(annoterms);
+   KBExamplesLoad(kb_name, NULL, proof_examples, clause_examples);
 
    VERBOUT("Old knowledge base files parsed successfully\n");
 
@@ -166,15 +160,23 @@ int main(int argc, char* argv[])
    FileRemove(DStrView(store_file));
    DStrFree(store_file);
 
-   /* Step 4: Write everything back: problems, clausepatterns */
+   /* Step 4: Write everything back: problems, clausepatterns, or a
+      new image */
 
-   out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
-   AnnoSetPrint(out, clause_examples);
-   OutClose(out);
+   if(KBIsBinary(kb_name))
+   {
+      KBImageWrite(kb_name, proof_examples, clause_examples);
+   }
+   else
+   {
+      out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
+      AnnoSetPrint(out, clause_examples);
+      OutClose(out);
 
-   out = OutOpen(KBFileName(name, kb_name, "problems"));
-   ExampleSetPrint(out, proof_examples);
-   OutClose(out);
+      out = OutOpen(KBFileName(name, kb_name, "problems"));
+      ExampleSetPrint(out, proof_examples);
+      OutClose(out);
+   }
 
    /* Finally clean up */
 
@@ -19,6 +19,8 @@ Changes
 
 <1> Wed Jul 28 16:21:33 MET DST 1999
     New
+<2> Tue Oct 20 04:10:32 CEST 2026
+    Support binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
@@ -26,6 +28,7 @@ Changes
 #include <cio_fileops.h>
 #include <cio_tempfile.h>
 #include <cle_kbinsert.h>
+#include <cle_kbimage.h>
 #include <pcl_analysis.h>
 #include <cio_signals.h>
 #include <e_version.h>
@@ -117,7 +120,8 @@ int main(int argc, char* argv[])
    char            defaultname[30];
    int             i;
    PCLProt_p       prot;
-   long            proof_steps, neg_steps;
+   long            proof_steps, neg_steps, first_ident;
+   KBImage_p       image = NULL;
 
    assert(argv[0]);
 #ifdef STACK_SIZE
@@ -150,11 +154,7 @@ int main(int argc, char* argv[])
       out name ane parameters. */
 
    proof_examples = ExampleSetAlloc();
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "problems"),
-            true, NULL);
-   ExampleSetParse(in, proof_examples);
-   DestroyScanner(in);
+   KBExamplesLoad(kb_name, NULL, proof_examples, NULL);
 
    in = CreateScanner(StreamTypeFile,
             KBFileName(name, kb_name, "description"),
@@ -232,7 +232,8 @@ int main(int argc, char* argv[])
    PCLProtFree(prot);
    OutClose(out);
 
-   /* Step 4: Now read the remaining files (signature, clausepatterns)
+   /* Step 4: Now read the remaining files (signature, clausepatterns
+      or the image)
     */
 
    VERBOUT("Parsing data files\n");
@@ -245,13 +246,14 @@ int main(int argc, char* argv[])
    SigParse(in, reserved_symbols, true);
    DestroyScanner(in);
 
-   in = CreateScanner(StreamTypeFile,
-                      KBFileName(name, kb_name, "clausepatterns"),
-                      true, NULL);
-
    annoterms = TBAlloc(reserved_symbols);
-   clause_examples = AnnoSetParse(in, annoterms, KB_ANNOTATION_NO);
-   DestroyScanner(in);
+   clause_examples = AnnoSetAlloc(annoterms);
+   if(KBIsBinary(kb_name))
+   {
+      image = KBImageAlloc();
+   }
+   KBExamplesLoad(kb_name, image, NULL, clause_examples);
+   first_ident = proof_examples->count+1;
 
 
    /* Step 5: Integrate new examples into existing structures */
@@ -265,22 +267,22 @@ int main(int argc, char* argv[])
    DestroyScanner(in);
    DStrFree(store_file);
 
-   /* Step 6: Write everything back: problems, clausepatterns */
+   /* Step 6: Write everything back: problems, clausepatterns, or
+      append the new example to the image */
 
    VERBOUT("Writing example files\n");
 
-   out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
-   AnnoSetPrint(out, clause_examples);
-   OutClose(out);
-
-   out = OutOpen(KBFileName(name, kb_name, "problems"));
-   ExampleSetPrint(out, proof_examples);
-   OutClose(out);
+   KBExamplesStore(kb_name, image, proof_examples, clause_examples,
+                   first_ident);
 
    /* Finally clean up */
 
    DStrFree(name);
    KBDescFree(kb_desc);
+   if(image)
+   {
+      KBImageFree(image);
+   }
    AnnoSetFree(clause_examples);
    annoterms->sig = NULL;
    TBFree(annoterms);
@@ -21,6 +21,8 @@ Changes
 <2> Sun May  7 20:48:22 CEST 2006
     Changed semantics for more efficiency (suggested and prototyped by
     Josef Urban, <urban@ktilinux.ms.mff.cuni.cz>
+<3> Tue Oct 20 04:10:32 CEST 2026
+    Support binary knowledge bases.
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ Changes
 #include <cio_output.h>
 #include <cio_fileops.h>
 #include <cle_kbinsert.h>
+#include <cle_kbimage.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -43,7 +46,8 @@ typedef enum
    OPT_VERSION,
    OPT_VERBOSE,
    OPT_KB,
-   OPT_NAME
+   OPT_NAME,
+   OPT_BINARY
 }OptionCodes;
 
 
@@ -82,6 +86,13 @@ OptCell opts[] =
     ReqArg, NULL,
     "Select the knowledge base. If not given, select E_KNOWLEDGE."},
 
+   {OPT_BINARY,
+    'b', "binary",
+    NoArg, NULL,
+    "Convert a text knowledge base into a binary one (see ekb_create) "
+    "before inserting. Without input files, only convert the "
+    "knowledge base."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -90,6 +101,7 @@ OptCell opts[] =
 
 char* ex_name = NULL;
 char* kb_name = "E_KNOWLEDGE";
+bool  binary  = false;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -107,15 +119,17 @@ int main(int argc, char* argv[])
 {
    CLState_p       state;
    DStr_p          name, store_file;
-   FILE            *out;
    ExampleSet_p    proof_examples;
    AnnoSet_p       clause_examples;
    TB_p            annoterms;
    SortTable_p     sort_table;
    Sig_p           reserved_symbols;
    Scanner_p       in;
+   KBImage_p       image;
    char            defaultname[30];
    int             i;
+   long            first_ident;
+   bool            convert;
 
    assert(argv[0]);
 #ifdef STACK_SIZE
@@ -127,15 +141,9 @@ int main(int argc, char* argv[])
 
    name = DStrAlloc();
 
-   /* Step 1: Read existing files: problems, clausepatterns, signature
+   /* Step 1: Read existing files: signature, problems, clausepatterns
+      (or the image)
     */
-   proof_examples = ExampleSetAlloc();
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "problems"),
-            true, NULL);
-   ExampleSetParse(in, proof_examples);
-   DestroyScanner(in);
-
    sort_table = DefaultSortTableAlloc();
    reserved_symbols = SigAlloc(sort_table);
 
@@ -145,16 +153,17 @@ int main(int argc, char* argv[])
    SigParse(in, reserved_symbols, true);
    DestroyScanner(in);
 
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "clausepatterns"),
-            true, NULL);
+   proof_examples = ExampleSetAlloc();
    annoterms = TBAlloc(reserved_symbols);
-   clause_examples = AnnoSetParse(in, annoterms, KB_ANNOTATION_NO);
-   DestroyScanner(in);
+   clause_examples = AnnoSetAlloc(annoterms);
+   image = KBImageAlloc();
+   KBExamplesLoad(kb_name, image, proof_examples, clause_examples);
+   first_ident = proof_examples->count+1;
+   convert = binary && !KBIsBinary(kb_name);
 
    VERBOUT("Old knowledge base files parsed successfully\n");
 
-   if(state->argc ==  0)
+   if((state->argc ==  0) && !convert)
    {
       CLStateInsertArg(state, "-");
    }
@@ -211,19 +220,26 @@ int main(int argc, char* argv[])
       ex_name = NULL;
    }
 
-   /* Step 5: Write everything back: problems, clausepatterns */
+   /* Step 5: Write everything back: problems, clausepatterns, or
+      append the new examples to the image */
 
-   out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
-   AnnoSetPrint(out, clause_examples);
-   OutClose(out);
-
-   out = OutOpen(KBFileName(name, kb_name, "problems"));
-   ExampleSetPrint(out, proof_examples);
-   OutClose(out);
+   if(convert)
+   {
+      KBImageWrite(kb_name, proof_examples, clause_examples);
+      FileRemove(KBFileName(name, kb_name, "clausepatterns"));
+      FileRemove(KBFileName(name, kb_name, "problems"));
+      VERBOUT("Knowledge base converted to binary format\n");
+   }
+   else
+   {
+      KBExamplesStore(kb_name, image, proof_examples, clause_examples,
+                      first_ident);
+   }
 
    /* Finally clean up */
 
    DStrFree(name);
+   KBImageFree(image);
    AnnoSetFree(clause_examples);
    annoterms->sig = NULL;
    TBFree(annoterms);
@@ -283,6 +299,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_NAME:
        ex_name = arg;
        break;
+      case OPT_BINARY:
+       binary = true;
+       break;
      default:
     assert(false);
     break;
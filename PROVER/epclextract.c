@@ -29,6 +29,7 @@ Changes
 #include <cio_signals.h>
 #include <pcl_protocol.h>
 #include <pcl_miniprotocol.h>
+#include <pcl_protindex.h>
 #include <e_version.h>
 
 
@@ -49,6 +50,7 @@ typedef enum
    OPT_TSTP_PRINT,
    OPT_COMPETITION,
    OPT_NO_EXTRACT,
+   OPT_NO_INDEX,
    OPT_OUTPUT,
    OPT_SILENT,
    OPT_OUTPUTLEVEL
@@ -103,6 +105,14 @@ OptCell opts[] =
     "steps as proof steps). Useful as a syntax checker, or if you want"
     " to convert PCL to TSTP with the next option."},
 
+   {OPT_NO_INDEX,
+    '\0', "full-parse",
+    NoArg, NULL,
+    "Parse all steps of the protocol. By default, the input is first "
+    "only indexed, and only the steps needed for the \"proof\", "
+    "\"final\" and \"extract\" steps are parsed. This option is "
+    "implied by --no-extract, --forward-comments and --fast-extract."},
+
    {OPT_TSTP_PRINT,
     '\0', "tstp-out",
     NoArg, NULL,
@@ -135,7 +145,8 @@ char       *executable = NULL;
 bool       fast_extract = false,
            comp_frame = false,
            no_extract = false,
-           pass_comments = false;
+           pass_comments = false,
+           use_index = true;
 OutputFormatType output_format = pcl_format;
 
 /*---------------------------------------------------------------------*/
@@ -159,6 +170,7 @@ int main(int argc, char* argv[])
    bool            empty_clause = false;
    PCLMiniProt_p   mprot = NULL;
    PCLProt_p       prot = NULL;
+   PCLProtIndex_p  index;
 
    assert(argv[0]);
 
@@ -194,20 +206,41 @@ int main(int argc, char* argv[])
    {
       prot = PCLProtAlloc();
    }
-   for(i=0; state->argv[i]; i++)
+   if(use_index && !fast_extract && !no_extract && !pass_comments)
    {
-      in = CreateScanner(StreamTypeFile, state->argv[i], !pass_comments, NULL);
-      ScannerSetFormat(in, TPTPFormat);
-      if(fast_extract)
+      index = PCLProtIndexAlloc();
+      for(i=0; state->argv[i]; i++)
       {
-    steps+=PCLMiniProtParse(in, mprot);
+         steps+=PCLProtIndexAddFile(index, state->argv[i]);
       }
-      else
+      VERBOSE(fprintf(stderr, "%s: Indexed %ld steps, %ld parent "
+                      "references, %ld roots\n", ProgName, steps,
+                      PCLProtIndexEdgeNo(index),
+                      PCLProtIndexRootNo(index)););
+      PCLProtIndexParseReachable(index, prot);
+      VERBOSE(fprintf(stderr, "%s: Parsed %ld reachable steps (%ld "
+                      "unresolved references)\n", ProgName,
+                      PCLProtStepNo(prot), index->unresolved););
+      empty_clause = index->empty_clause;
+      PCLProtIndexFree(index);
+   }
+   else
+   {
+      for(i=0; state->argv[i]; i++)
       {
-    steps+=PCLProtParse(in, prot);
+         in = CreateScanner(StreamTypeFile, state->argv[i], !pass_comments, NULL);
+         ScannerSetFormat(in, TPTPFormat);
+         if(fast_extract)
+         {
+            steps+=PCLMiniProtParse(in, mprot);
+         }
+         else
+         {
+            steps+=PCLProtParse(in, prot);
+         }
+         CheckInpTok(in, NoToken);
+         DestroyScanner(in);
       }
-      CheckInpTok(in, NoToken);
-      DestroyScanner(in);
    }
    VERBOUT2("PCL input read\n");
    fflush(GlobalOut);
@@ -231,7 +264,7 @@ int main(int argc, char* argv[])
       }
       else
       {
-    empty_clause = PCLProtMarkProofClauses(prot);
+    empty_clause = PCLProtMarkProofClauses(prot) || empty_clause;
       }
    }
    if(comp_frame)
@@ -346,6 +379,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_NO_EXTRACT:
        no_extract = true;
        break;
+      case OPT_NO_INDEX:
+       use_index = false;
+       break;
       case OPT_TSTP_PRINT:
        output_format = tstp_format;
             OutputFormat = TSTPFormat;
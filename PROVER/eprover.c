@@ -37,6 +37,7 @@ Changes
 #include <ccl_formulafunc.h>
 #include <cte_simplesorts.h>
 #include <cco_scheduling.h>
+#include <cco_presat.h>
 #include <e_version.h>
 
 
@@ -92,7 +93,8 @@ long              step_limit = LONG_MAX,
                   eqdef_maxclauses = DEFAULT_EQDEF_MAXCLAUSES,
                   relevance_prune_level = 0,
                   miniscope_limit = 1000;
-int               eqdef_incrlimit = DEFAULT_EQDEF_INCRLIMIT;
+int               eqdef_incrlimit = DEFAULT_EQDEF_INCRLIMIT,
+                  presat_workers = 1;
 char              *outdesc = DEFAULT_OUTPUT_DESCRIPTOR,
                   *filterdesc = DEFAULT_FILTER_DESCRIPTOR;
 PStack_p          wfcb_definitions, hcb_definitions;
@@ -251,6 +253,7 @@ static void print_info(void)
 /----------------------------------------------------------------------*/
 
 static void print_proof_stats(ProofState_p proofstate,
+                              ProofControl_p proofcontrol,
                               long parsed_ax_no,
                               long relevancy_pruned,
                               long raw_clause_no,
@@ -268,6 +271,10 @@ static void print_proof_stats(ProofState_p proofstate,
       fprintf(GlobalOut, "# Removed in clause preprocessing      : %ld\n",
          preproc_removed);
       ProofStateStatisticsPrint(GlobalOut, proofstate);
+      if(proofcontrol->satcheck)
+      {
+         SatCheckPrintStatistics(GlobalOut, proofcontrol->satcheck);
+      }
       fprintf(GlobalOut, "# Clause-clause subsumption calls (NU) : %ld\n",
          ClauseClauseSubsumptionCalls);
       fprintf(GlobalOut, "# Rec. Clause-clause subsumption calls : %ld\n",
@@ -297,19 +304,7 @@ static void print_proof_stats(ProofState_p proofstate,
       fprintf(GlobalOut, "# PDT nodes visited                    : %ld\n",
               PDTNodeCounter);
 #endif
-      PERF_CTR_PRINT(GlobalOut, MguTimer);
-      PERF_CTR_PRINT(GlobalOut, SatTimer);
-      PERF_CTR_PRINT(GlobalOut, ParamodTimer);
-      PERF_CTR_PRINT(GlobalOut, PMIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, IndexUnifTimer);
-      PERF_CTR_PRINT(GlobalOut, BWRWTimer);
-      PERF_CTR_PRINT(GlobalOut, BWRWIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, IndexMatchTimer);
-      PERF_CTR_PRINT(GlobalOut, FreqVecTimer);
-      PERF_CTR_PRINT(GlobalOut, FVIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, SubsumeTimer);
-      PERF_CTR_PRINT(GlobalOut, SetSubsumeTimer);
-      PERF_CTR_PRINT(GlobalOut, ClauseEvalTimer);
+      PerfCtrsPrint(GlobalOut);
 
 #ifdef PRINT_INDEX_STATS
       fprintf(GlobalOut, "# Backwards rewriting index : ");
@@ -508,6 +503,14 @@ int main(int argc, char* argv[])
       LiteralSelectionFun sel_strat =
          proofcontrol->heuristic_parms.selection_strategy;
 
+      if(presat_workers > 1)
+      {
+         long removed = ProofStateParallelSubsume(proofstate, presat_workers);
+
+         fprintf(GlobalOut,
+                 "# Parallel presaturation subsumption removed %ld clauses\n",
+                 removed);
+      }
       proofcontrol->heuristic_parms.selection_strategy = SelectNoGeneration;
       success = Saturate(proofstate, proofcontrol, LONG_MAX,
                          LONG_MAX, LONG_MAX, LONG_MAX, LONG_MAX);
@@ -697,6 +700,7 @@ int main(int argc, char* argv[])
    fflush(GlobalOut);
 
    print_proof_stats(proofstate,
+                     proofcontrol,
                      parsed_ax_no,
                      relevancy_pruned,
                      raw_clause_no,
@@ -881,6 +885,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_EXPENSIVE_DETAILS:
             TBPrintDetails = true;
             break;
+      case OPT_PERF_COUNTERS:
+            PerfCtrsEnable(arg);
+            break;
       case OPT_PRINT_SATURATED:
             outdesc = arg;
             CheckOptionLetterString(outdesc, "eigEIGaA", "-S (--print-saturated)");
@@ -1049,6 +1056,12 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SATAUTO_SCHED:
             strategy_scheduling = true;
             break;
+      case OPT_AUTO_TABLE:
+            h_parms->heuristic_name = "AutoTable";
+            h_parms->ordertype = AUTOTABLE;
+            h_parms->auto_table = arg;
+            sine = "Auto";
+            break;
       case OPT_NO_PREPROCESSING:
             no_preproc = true;
             break;
@@ -1070,6 +1083,14 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_PRESAT_SIMPLIY:
             h_parms->presat_interreduction = true;
             break;
+      case OPT_PRESAT_WORKERS:
+            presat_workers = CLStateGetIntArg(handle, arg);
+            if(presat_workers < 1 || presat_workers > PRESAT_MAX_WORKERS)
+            {
+               Error("Option --presat-workers requires an argument "
+                     "between 1 and %d", USAGE_ERROR, PRESAT_MAX_WORKERS);
+            }
+            break;
       case OPT_AC_HANDLING:
             if(strcmp(arg, "None")==0)
             {
@@ -1218,6 +1239,20 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_REWEIGHT_LIMIT:
             h_parms->reweight_limit = CLStateGetIntArg(handle, arg);
             break;
+      case OPT_REWEIGHT_BATCH:
+            h_parms->reweight_batch = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_SAT_CHECK_LIMIT:
+            h_parms->sat_check_limit = CLStateGetIntArg(handle, arg);
+            if(h_parms->sat_check_limit < 1)
+            {
+               Error("Option --satcheck-proc-interval requires a positive "
+                     "argument", USAGE_ERROR);
+            }
+            break;
+      case OPT_SAT_CHECK_CONFLICTS:
+            h_parms->sat_check_conflicts = CLStateGetIntArg(handle, arg);
+            break;
       case OPT_ORDERING:
             if(strcmp(arg, "Auto")==0)
             {
@@ -1263,6 +1298,10 @@ CLState_p process_options(int argc, char* argv[])
             {
                h_parms->ordertype = AUTOSCHED7;
             }
+            else if(strcmp(arg, "AutoTable")==0)
+            {
+               h_parms->ordertype = AUTOTABLE;
+            }
             else if(strcmp(arg, "Optimize")==0)
             {
                h_parms->ordertype = OPTIMIZE_AX;
@@ -1548,9 +1587,20 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DEF_CNF:
             FormulaDefLimit     = CLStateGetIntArg(handle, arg);
             break;
+      case OPT_DEF_CNF_SHARED:
+            FormulaDefShareLimit = CLStateGetIntArg(handle, arg);
+            break;
       case OPT_MINISCOPE_LIMIT:
             miniscope_limit =  CLStateGetIntArg(handle, arg);
             break;
+      case OPT_CNF_WORKERS:
+            FormulaCNFWorkers = CLStateGetIntArg(handle, arg);
+            if(FormulaCNFWorkers < 1 || FormulaCNFWorkers > CNF_MAX_WORKERS)
+            {
+               Error("Option --cnf-workers requires an argument "
+                     "between 1 and %d", USAGE_ERROR, CNF_MAX_WORKERS);
+            }
+            break;
       case OPT_PRINT_TYPES:
             TermPrintTypes = true;
             break;
@@ -0,0 +1,280 @@
+/*-----------------------------------------------------------------------
+
+File  : parse_bench.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Benchmark for the input layer: Tokenize (or parse) the given files
+  and report the throughput in MB/s.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 02:10:44 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <ccl_formulafunc.h>
+
+#define VERSION "0.1 - Mon Oct 19 02:10:44 CEST 2026"
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERBOSE,
+   OPT_PARSE,
+   OPT_REPEAT
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+   {OPT_PARSE,
+    'p', "parse",
+    NoArg, NULL,
+    "Parse the input as TPTP/TSTP clauses and formulas into a term "
+    "bank instead of only tokenizing it."},
+   {OPT_REPEAT,
+    'r', "repeat",
+    ReqArg, NULL,
+    "Process each file the given number of times and report the "
+    "best run."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+bool parse_input = false;
+long repeat      = 1;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: tokenize_file()
+//
+//   Read all tokens from file, return their number.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input
+//
+/----------------------------------------------------------------------*/
+
+long tokenize_file(char* file)
+{
+   Scanner_p in = CreateScanner(StreamTypeFile, file, true, NULL);
+   long      res = 0;
+
+   ScannerSetFormat(in, TSTPFormat);
+   while(!TestInpTok(in, NoToken))
+   {
+      NextToken(in);
+      res++;
+   }
+   DestroyScanner(in);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_file()
+//
+//   Parse file into a fresh term bank, return the number of clauses
+//   and formulas read.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long parse_file(char* file)
+{
+   Scanner_p    in = CreateScanner(StreamTypeFile, file, true, NULL);
+   TB_p         bank = TBAlloc(SigAlloc(DefaultSortTableAlloc()));
+   ClauseSet_p  cset = ClauseSetAlloc();
+   FormulaSet_p fset = FormulaSetAlloc();
+   StrTree_p    skip_includes = NULL;
+   long         res;
+
+   ScannerSetFormat(in, TSTPFormat);
+   res = FormulaAndClauseSetParse(in, cset, fset, bank,
+                                  NULL, &skip_includes);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+
+   ClauseSetFree(cset);
+   FormulaSetFree(fset);
+   StrTreeFree(skip_includes);
+   SortTableFree(bank->sig->sort_table);
+   SigFree(bank->sig);
+   bank->sig = NULL;
+   TBFree(bank);
+
+   return res;
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p   state;
+   struct stat stat_buf;
+   long long   start, usecs, best;
+   long        count = 0, i, j;
+   double      mbytes;
+
+   assert(argv[0]);
+   InitIO(argv[0]);
+
+   state = process_options(argc, argv);
+
+   if(state->argc ==  0)
+   {
+      print_help(stdout);
+      exit(NO_ERROR);
+   }
+
+   for(i=0; state->argv[i]; i++)
+   {
+      if(stat(state->argv[i], &stat_buf) != 0)
+      {
+         TmpErrno = errno;
+         SysError("Cannot stat %s", FILE_ERROR, state->argv[i]);
+      }
+      mbytes = stat_buf.st_size/(1024.0*1024.0);
+      best   = LLONG_MAX;
+      for(j=0; j<repeat; j++)
+      {
+         start = GetUSecTime();
+         count = parse_input?parse_file(state->argv[i]):
+            tokenize_file(state->argv[i]);
+         usecs = GetUSecTime()-start;
+         best  = MIN(best, usecs);
+      }
+      printf("%s: %.2f MB, %ld %s, %.3f s, %.2f MB/s\n",
+             state->argv[i], mbytes, count,
+             parse_input?"clauses/formulas":"tokens",
+             best/1000000.0,
+             best?mbytes/(best/1000000.0):0.0);
+   }
+   CLStateFree(state);
+   #ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+   #endif
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, parse_input, repeat
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+    Verbose = CLStateGetIntArg(handle, arg);
+    break;
+      case OPT_HELP:
+    print_help(stdout);
+    exit(NO_ERROR);
+      case OPT_PARSE:
+    parse_input = true;
+    break;
+      case OPT_REPEAT:
+    repeat = CLStateGetIntArg(handle, arg);
+    if(repeat < 1)
+    {
+       Error("Option -r (--repeat) requires a positive argument",
+             USAGE_ERROR);
+    }
+    break;
+      default:
+    assert(false);
+    break;
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+parse_bench "VERSION"\n\
+\n\
+Usage: parse_bench [options] files\n\
+\n\
+Tokenize (or, with --parse, parse) the given TPTP/TSTP files and\n\
+print the input throughput in MB/s for each of them.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
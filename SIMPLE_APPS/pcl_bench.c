@@ -0,0 +1,522 @@
+/*-----------------------------------------------------------------------
+
+File  : pcl_bench.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Benchmark for lemma selection on PCL protocols: Generate a
+  synthetic clausal protocol (unit equations derived by random
+  pm/rw/sr/er/ef inferences), or read the given protocols, and
+  report the time for parsing and for the lemma search.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Wed Oct 21 11:48:20 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <pcl_lemmas.h>
+
+#define VERSION "0.1 - Wed Oct 21 11:48:20 CEST 2026"
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_GENERATE,
+   OPT_STEPS,
+   OPT_INITIAL,
+   OPT_WINDOW,
+   OPT_SEED,
+   OPT_ITERATIVE,
+   OPT_RECURSIVE,
+   OPT_FLAT,
+   OPT_MAX_LEMMAS,
+   OPT_MIN_QUALITY
+}OptionCodes;
+
+typedef enum
+{
+   LIterative,
+   LRecursive,
+   LFlat
+}LemmaAlgorithm;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+    "Redirect output into the named file."},
+   {OPT_GENERATE,
+    'g', "generate",
+    NoArg, NULL,
+    "Only print the synthetic protocol instead of benchmarking the "
+    "lemma search on it."},
+   {OPT_STEPS,
+    'n', "steps",
+    ReqArg, NULL,
+    "Number of steps of the synthetic protocol (default 1000000)."},
+   {OPT_INITIAL,
+    'I', "initial-steps",
+    ReqArg, NULL,
+    "Number of initial steps of the synthetic protocol (default "
+    "100)."},
+   {OPT_WINDOW,
+    'w', "window",
+    ReqArg, NULL,
+    "Draw the premises of a synthetic step from the given number of "
+    "directly preceding steps. With the default 0 they are drawn "
+    "from all preceding steps, and proof tree sizes only grow "
+    "polynomially. With a window, they grow exponentially and soon "
+    "exceed the range of a long."},
+   {OPT_SEED,
+    'S', "seed",
+    ReqArg, NULL,
+    "Seed for the random number generator (default 1)."},
+   {OPT_ITERATIVE,
+    'i', "iterative-lemmas",
+    NoArg, NULL,
+    "Use the iterative lemma search of epcllemma (default)."},
+   {OPT_RECURSIVE,
+    'r', "recursive-lemmas",
+    NoArg, NULL,
+    "Use the recursive lemma search of epcllemma."},
+   {OPT_FLAT,
+    'f', "flat-lemmas",
+    NoArg, NULL,
+    "Use the flat lemma search of epcllemma."},
+   {OPT_MAX_LEMMAS,
+    'A', "max-lemmas",
+    ReqArg, NULL,
+    "Select at most the given number of lemmas (default 1000)."},
+   {OPT_MIN_QUALITY,
+    'q', "min-lemma-quality",
+    ReqArg, NULL,
+    "Minimum quality of a lemma (default 100)."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char           *outname      = NULL;
+bool           generate_only = false;
+long           step_no       = 1000000;
+long           initial_no    = 100;
+long           window        = 0;
+long           seed          = 1;
+LemmaAlgorithm algo          = LIterative;
+long           max_lemmas    = 1000;
+float          min_quality   = 100;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: rand_range()
+//
+//   Return a pseudo-random number in 0..limit-1.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the state of the random number generator
+//
+/----------------------------------------------------------------------*/
+
+static long rand_range(long limit)
+{
+   return JKISSRand()%limit;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_term()
+//
+//   Append a random term over f/2, g/1, a, b, c and X1..X4 with at
+//   most the given depth to out.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the state of the random number generator
+//
+/----------------------------------------------------------------------*/
+
+static void gen_term(DStr_p out, int depth)
+{
+   static char *atoms[] = {"X1", "X2", "X3", "X4", "a", "b", "c"};
+
+   switch(depth?rand_range(4):3)
+   {
+   case 0:
+      DStrAppendStr(out, "g(");
+      gen_term(out, depth-1);
+      DStrAppendChar(out, ')');
+      break;
+   case 1:
+   case 2:
+      DStrAppendStr(out, "f(");
+      gen_term(out, depth-1);
+      DStrAppendChar(out, ',');
+      gen_term(out, depth-1);
+      DStrAppendChar(out, ')');
+      break;
+   default:
+      DStrAppendStr(out, atoms[rand_range(7)]);
+      break;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_premise()
+//
+//   Append the id of a random premise for step i to out.
+//
+// Global Variables: window
+//
+// Side Effects    : Changes the state of the random number generator
+//
+/----------------------------------------------------------------------*/
+
+static void gen_premise(DStr_p out, long i)
+{
+   long first = (window && i-window > 1)?i-window:1;
+
+   DStrAppendInt(out, first+rand_range(i-first));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_protocol()
+//
+//   Append a synthetic protocol with step_no steps (the first
+//   initial_no of them initial) to out. Each step is a unit equation
+//   in the style of eprover's PCL output. Derived steps use one of
+//   pm, rw (sometimes nested), sr, er and ef.
+//
+// Global Variables: step_no, initial_no, window
+//
+// Side Effects    : Changes the state of the random number generator
+//
+/----------------------------------------------------------------------*/
+
+static void gen_protocol(DStr_p out)
+{
+   static char *binary[] = {"pm(", "rw(", "sr("};
+   static char *unary[]  = {"er(", "ef("};
+   long i;
+
+   for(i=1; i<=step_no; i++)
+   {
+      DStrAppendInt(out, i);
+      DStrAppendStr(out, rand_range(10)?" : :[++equal(":" : :[--equal(");
+      gen_term(out, 3);
+      DStrAppendStr(out, ", ");
+      gen_term(out, 2);
+      DStrAppendStr(out, ")] : ");
+      if(i <= initial_no || i == 1)
+      {
+         DStrAppendStr(out, "initial");
+      }
+      else if(rand_range(5))
+      {
+         if(!rand_range(5))
+         {
+            DStrAppendStr(out, "rw(rw(");
+            gen_premise(out, i);
+            DStrAppendChar(out, ',');
+            gen_premise(out, i);
+            DStrAppendStr(out, "),");
+         }
+         else
+         {
+            DStrAppendStr(out, binary[rand_range(3)]);
+            gen_premise(out, i);
+            DStrAppendChar(out, ',');
+         }
+         gen_premise(out, i);
+         DStrAppendChar(out, ')');
+      }
+      else
+      {
+         DStrAppendStr(out, unary[rand_range(2)]);
+         gen_premise(out, i);
+         DStrAppendChar(out, ')');
+      }
+      DStrAppendChar(out, '\n');
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_protocol()
+//
+//   Parse a protocol from the given source, run the selected lemma
+//   search on it and print the times, and whether proof tree sizes
+//   exceed the range of a long (which disables the lazy rating
+//   updates of the recursive search).
+//
+// Global Variables: algo, max_lemmas, min_quality
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_protocol(StreamType type, char* source, char* name)
+{
+   Scanner_p         in;
+   PCLProt_p         prot = PCLProtAlloc();
+   InferenceWeight_p iw = InferenceWeightsAlloc();
+   LemmaParam_p      lp = LemmaParamAlloc();
+   long long         start, parse_usecs, lemma_usecs;
+   long              lemmas = 0;
+   PCLLemmaDAG_p     dag;
+   bool              overflow;
+
+   start = GetUSecTime();
+   in = CreateScanner(type, source, true, NULL);
+   ScannerSetFormat(in, TPTPFormat);
+   PCLProtParse(in, prot);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+   parse_usecs = GetUSecTime()-start;
+
+   PCLProtResetTreeData(prot, false);
+   PCLProtUpdateRefs(prot);
+   dag = PCLLemmaDAGAlloc(prot, iw);
+   PCLLemmaDAGComputeProofSize(dag);
+   overflow = dag->overflow;
+   PCLLemmaDAGFree(dag);
+
+   start = GetUSecTime();
+   switch(algo)
+   {
+   case LRecursive:
+      lemmas = PCLProtRecFindLemmas(prot, lp, iw, max_lemmas, min_quality);
+      break;
+   case LIterative:
+      lemmas = PCLProtSeqFindLemmas(prot, lp, iw, max_lemmas, min_quality);
+      break;
+   case LFlat:
+      lemmas = PCLProtFlatFindLemmas(prot, lp, iw, max_lemmas, min_quality);
+      break;
+   default:
+      assert(false && "Unknown algorithm type ???");
+      break;
+   }
+   lemma_usecs = GetUSecTime()-start;
+
+   fprintf(GlobalOut,
+           "%s: %ld steps%s, parse %.3f s, %ld lemmas in %.3f s "
+           "(%.3f ms/lemma)\n",
+           name, PCLProtStepNo(prot),
+           overflow?" (proof sizes overflow)":"",
+           parse_usecs/1000000.0,
+           lemmas, lemma_usecs/1000000.0,
+           lemmas?lemma_usecs/(1000.0*lemmas):0.0);
+
+   LemmaParamFree(lp);
+   InferenceWeightsFree(iw);
+   PCLProtFree(prot);
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   DStr_p    protocol;
+   int       i;
+
+   assert(argv[0]);
+   InitIO(argv[0]);
+   /* As in epcllemma */
+   ClausesHaveLocalVariables = false;
+
+   state = process_options(argc, argv);
+   OpenGlobalOut(outname);
+
+   if(state->argc == 0 || generate_only)
+   {
+      JKISSSeed(seed, 2*seed+1, 3*seed+7);
+      protocol = DStrAlloc();
+      gen_protocol(protocol);
+      VERBOUT("Protocol generated\n");
+      if(generate_only)
+      {
+         fputs(DStrView(protocol), GlobalOut);
+      }
+      else
+      {
+         bench_protocol(StreamTypeInternalString, DStrView(protocol),
+                        "synthetic");
+      }
+      DStrFree(protocol);
+   }
+   else
+   {
+      for(i=0; state->argv[i]; i++)
+      {
+         bench_protocol(StreamTypeFile, state->argv[i], state->argv[i]);
+      }
+   }
+
+   CLStateFree(state);
+   fflush(GlobalOut);
+   OutClose(GlobalOut);
+   ExitIO();
+   #ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+   #endif
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, and the option variables above
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+    Verbose = CLStateGetIntArg(handle, arg);
+    break;
+      case OPT_HELP:
+    print_help(stdout);
+    exit(NO_ERROR);
+      case OPT_OUTPUT:
+    outname = arg;
+    break;
+      case OPT_GENERATE:
+    generate_only = true;
+    break;
+      case OPT_STEPS:
+    step_no = CLStateGetIntArg(handle, arg);
+    if(step_no < 1)
+    {
+       Error("Option -n (--steps) requires a positive argument",
+             USAGE_ERROR);
+    }
+    break;
+      case OPT_INITIAL:
+    initial_no = CLStateGetIntArg(handle, arg);
+    break;
+      case OPT_WINDOW:
+    window = CLStateGetIntArg(handle, arg);
+    if(window < 0)
+    {
+       Error("Option -w (--window) requires a non-negative argument",
+             USAGE_ERROR);
+    }
+    break;
+      case OPT_SEED:
+    seed = CLStateGetIntArg(handle, arg);
+    break;
+      case OPT_ITERATIVE:
+    algo = LIterative;
+    break;
+      case OPT_RECURSIVE:
+    algo = LRecursive;
+    break;
+      case OPT_FLAT:
+    algo = LFlat;
+    break;
+      case OPT_MAX_LEMMAS:
+    max_lemmas = CLStateGetIntArg(handle, arg);
+    break;
+      case OPT_MIN_QUALITY:
+    min_quality = CLStateGetFloatArg(handle, arg);
+    break;
+      default:
+    assert(false);
+    break;
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+pcl_bench "VERSION"\n\
+\n\
+Usage: pcl_bench [options] [files]\n\
+\n\
+Run the lemma search of epcllemma on the given PCL protocols, or on\n\
+a synthetic protocol if no file is given, and print the time for\n\
+parsing and for the lemma search. With --generate, print the\n\
+synthetic protocol instead.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
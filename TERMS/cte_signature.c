@@ -69,6 +69,27 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: func_name_compare()
+//
+//   Compare two Func_p's (passed by reference) by name, for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int func_name_compare(const void* f1, const void* f2)
+{
+   const Func_p *s1 = (const Func_p*)f1;
+   const Func_p *s2 = (const Func_p*)f2;
+
+   return strcmp((*s1)->name, (*s2)->name);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: sig_compute_alpha_ranks()
@@ -83,17 +104,20 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
 
 static void sig_compute_alpha_ranks(Sig_p sig)
 {
-   PStack_p stack;
-   long count = 0;
-   StrTree_p handle;
-
-   stack = StrTreeTraverseInit(sig->f_index);
+   Func_p *symbols;
+   long   i;
 
-   while((handle = StrTreeTraverseNext(stack)))
+   symbols = SizeMalloc(sig->f_count*sizeof(Func_p));
+   for(i=0; i<sig->f_count; i++)
    {
-      sig->f_info[handle->val1.i_val].alpha_rank = count++;
+      symbols[i] = &(sig->f_info[i+1]);
    }
-   StrTreeTraverseExit(stack);
+   qsort(symbols, sig->f_count, sizeof(Func_p), func_name_compare);
+   for(i=0; i<sig->f_count; i++)
+   {
+      symbols[i]->alpha_rank = i;
+   }
+   SizeFree(symbols, sig->f_count*sizeof(Func_p));
 
    sig->alpha_ranks_valid = true;
 }
@@ -126,7 +150,7 @@ Sig_p SigAlloc(SortTable_p sort_table)
    handle->f_count        = 0;
    handle->f_info         =
       SecureMalloc(sizeof(FuncCell)*DEFAULT_SIGNATURE_SIZE);
-   handle->f_index = NULL;
+   handle->f_index = StrHashAlloc();
    handle->ac_axioms = PStackAlloc();
 
    handle->sort_table = sort_table;
@@ -251,13 +275,18 @@ void SigInsertInternalCodes(Sig_p sig)
 
 void SigFree(Sig_p junk)
 {
+   FunCode i;
+
    assert(junk);
    assert(junk->f_info);
 
-   /* names are shared with junk->f_index and are free()ed by the
-      StrTreeFree() call below! */
+   /* names are shared with junk->f_index, which does not own them */
+   for(i=1; i<=junk->f_count; i++)
+   {
+      FREE(junk->f_info[i].name);
+   }
    FREE(junk->f_info);
-   StrTreeFree(junk->f_index);
+   StrHashFree(junk->f_index);
    PStackFree(junk->ac_axioms);
    if(junk->orn_codes)
    {
@@ -284,13 +313,13 @@ void SigFree(Sig_p junk)
 
 FunCode SigFindFCode(Sig_p sig, const char* name)
 {
-   StrTree_p entry;
+   StrHashEntry_p entry;
 
-   entry = StrTreeFind(&(sig->f_index), name);
+   entry = StrHashFind(sig->f_index, name);
 
    if(entry)
    {
-      return entry->val1.i_val;
+      return entry->val.i_val;
    }
    return 0;
 }
@@ -568,8 +597,9 @@ void SigSetAllSpecial(Sig_p sig, bool value)
 
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 {
-   long      pos;
-   StrTree_p new, test;
+   long           pos;
+   IntOrP         val;
+   StrHashEntry_p test;
 
    pos = SigFindFCode(sig, name);
 
@@ -602,11 +632,9 @@ FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
    sig->f_info[sig->f_count].arity = arity;
    sig->f_info[sig->f_count].properties = FPIgnoreProps;
    sig->f_info[sig->f_count].type = NULL;
-   new = StrTreeCellAllocEmpty();
-   new->key = sig->f_info[sig->f_count].name;
-   new->val1.i_val = sig->f_count;
+   val.i_val = sig->f_count;
 
-   test = StrTreeInsert(&(sig->f_index), new);
+   test = StrHashInsert(sig->f_index, sig->f_info[sig->f_count].name, val);
    UNUSED(test); assert(test == NULL);
    SigSetSpecial(sig,sig->f_count,special_id);
    sig->alpha_ranks_valid = false;
@@ -27,6 +27,7 @@ Changes
 #define CTE_SIGNATURE
 
 #include <clb_stringtrees.h>
+#include <clb_strhash.h>
 #include <clb_pdarrays.h>
 #include <clb_properties.h>
 #include <cte_functypes.h>
@@ -83,7 +84,8 @@ typedef struct funccell
 /* A signature contains information about function symbols with
    direct access by internal code (f_info is organized as a array,
    with f_info[f_code] being the information associated with f_code)
-   and efficient access by external name (via the f_index array).
+   and efficient access by external name (via the f_index hash
+   table).
 
    Function codes are integers starting at 1, while variables are
    encoded by negative integers. 0 is unused and can thus express
@@ -100,7 +102,7 @@ typedef struct sigcell
    FunCode   f_count;  /* Largest used f_code */
    FunCode   internal_symbols; /* Largest auto-inserted internal symbol */
    Func_p    f_info;   /* The array */
-   StrTree_p f_index;  /* Back-assoc: Given a symbol, get the index */
+   StrHash_p f_index;  /* Back-assoc: Given a symbol, get the index */
    PStack_p  ac_axioms; /* All recognized AC axioms */
    /* The following are special symbols needed for pattern
       manipulation. We want very efficient access to them! Also
@@ -202,7 +202,8 @@ void VarPrint(FILE* out, FunCode var)
    {
       id = 'Y';
    }
-   fprintf(out, "%c%ld", id, -((var-1)/2));
+   putc(id, out);
+   OutLong(out, -((var-1)/2));
 }
 
 
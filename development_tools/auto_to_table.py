@@ -0,0 +1,307 @@
+#!/usr/bin/env python
+
+"""
+auto_to_table.py [-l <limits>] [-s <E source dir>] <che_X_file.c>
+
+Convert a generated auto mode case distinction (one of the
+HEURISTICS/che_X_*.c files) into an auto mode table that can be
+loaded with eprover --auto-table=<file>. The table is written to
+stdout.
+
+-l <limits>: Comma-separated list of SpecLimits settings written into
+             the limits() section of the table, e.g. for the CASC mode
+             (see HCBCASCAutoModeCreate()):
+             -l ax_some_limit=46,ax_many_limit=205,...
+-s <dir>   : Root of the E source tree (used to translate C
+             identifiers into the external names understood by
+             eprover). Default is the parent of the directory of this
+             script.
+"""
+
+from __future__ import print_function
+
+import sys
+import os
+import re
+import getopt
+
+
+white_space   = re.compile(r"\s+")
+c_comment     = re.compile(r"/\*.*?\*/", re.S)
+c_string      = re.compile(r'"((?:[^"\\]|\\.)*)"')
+spec_pred     = re.compile(r"Spec([A-Za-z0-9]+)\(spec\)")
+res_setting   = re.compile(r'res\s*=\s*"([^"]*)"\s*;')
+parm_setting  = re.compile(
+    r"control->heuristic_parms\.([a-z_]+)\s*=\s*([A-Za-z0-9_]+)\s*;")
+order_setting = re.compile(r"oparms\.([a-z_]+)\s*=\s*([A-Za-z0-9_]+)\s*;")
+
+
+def read_file(name):
+    fp = open(name, "r")
+    res = fp.read()
+    fp.close()
+    return res
+
+
+def section(src, start):
+    """
+    Return the text from the line start to the matching #endif (not
+    counting nested preprocessor conditionals).
+    """
+    begin = src.index(start)
+    depth = 0
+    pos   = begin
+    for line in src[begin:].splitlines(True):
+        stripped = line.strip()
+        if stripped.startswith("#if"):
+            depth += 1
+        elif stripped.startswith("#endif"):
+            depth -= 1
+            if depth == 0:
+                return src[begin+len(start):pos]
+        pos += len(line)
+    raise RuntimeError("Unterminated section " + start)
+
+
+def parse_enum(text, enum_name):
+    """
+    Return the list of identifiers of a C enum in order, skipping
+    entries with explicit non-zero values (aliases and invalid
+    entries).
+    """
+    mr = re.search(r"typedef\s+enum\s*\{(.*?)\}\s*" + enum_name, text, re.S)
+    if not mr:
+        raise RuntimeError("Cannot find enum " + enum_name)
+    body = c_comment.sub("", mr.group(1))
+    res = []
+    for entry in body.split(","):
+        entry = entry.strip()
+        if not entry:
+            continue
+        if "=" in entry:
+            name, value = [x.strip() for x in entry.split("=")]
+            if value != "0":
+                continue
+            entry = name
+        res.append(entry)
+    return res
+
+
+def parse_name_array(text, array_name):
+    """
+    Return the strings in a NULL-terminated C array of names.
+    """
+    mr = re.search(array_name + r"\s*\[\]\s*=\s*\{(.*?)NULL", text, re.S)
+    if not mr:
+        raise RuntimeError("Cannot find name array " + array_name)
+    return c_string.findall(c_comment.sub("", mr.group(1)))
+
+
+def enum_name_map(src_dir, header, source, enum_name, array_name):
+    enum  = parse_enum(read_file(os.path.join(src_dir, header)), enum_name)
+    names = parse_name_array(read_file(os.path.join(src_dir, source)),
+                             array_name)
+    return dict(zip(enum, names))
+
+
+def litsel_name_map(src_dir):
+    """
+    Map C function names of literal selection functions to the first
+    external name for them.
+    """
+    text = read_file(os.path.join(src_dir, "HEURISTICS",
+                                  "che_litselection.c"))
+    res = {}
+    for name, fun in re.findall(r'\{\s*"([^"]+)"\s*,\s*([A-Za-z0-9_]+)\s*\}',
+                                text):
+        if fun not in res:
+            res[fun] = name
+    return res
+
+
+class Translator(object):
+    def __init__(self, src_dir):
+        self.weight_gen = enum_name_map(src_dir,
+                                        "HEURISTICS/che_to_weightgen.h",
+                                        "HEURISTICS/che_to_weightgen.c",
+                                        "TOWeightGenMethod",
+                                        "TOWeightGenNames")
+        self.prec_gen = enum_name_map(src_dir,
+                                      "HEURISTICS/che_to_precgen.h",
+                                      "HEURISTICS/che_to_precgen.c",
+                                      "TOPrecGenMethod",
+                                      "TOPrecGenNames")
+        self.litsel = litsel_name_map(src_dir)
+
+    def value(self, setting, value):
+        if setting == "selection_strategy":
+            return self.litsel[value]
+        if setting == "to_weight_gen":
+            return self.weight_gen[value]
+        if setting == "to_prec_gen":
+            return self.prec_gen[value]
+        return value
+
+
+def parse_heuristics(src):
+    """
+    Return the list of heuristic definitions (as single-line strings)
+    from the CHE_PROOFCONTROL_INTERNAL section.
+    """
+    text = c_comment.sub("", section(src, "#ifdef CHE_PROOFCONTROL_INTERNAL"))
+    text = "".join(c_string.findall(text)).replace("\\n", "\n")
+    res   = []
+    start = 0
+    depth = 0
+    for i, c in enumerate(text):
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+            if depth == 0:
+                res.append(white_space.sub(" ", text[start:i+1]).strip())
+                start = i+1
+    return res
+
+
+def split_top(text, sep):
+    """
+    Split text at occurences of sep outside of parentheses.
+    """
+    res   = []
+    depth = 0
+    start = 0
+    i     = 0
+    while i < len(text):
+        c = text[i]
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+        elif depth == 0 and text.startswith(sep, i):
+            res.append(text[start:i])
+            i += len(sep)
+            start = i
+            continue
+        i += 1
+    res.append(text[start:])
+    return res
+
+
+def strip_parens(text):
+    text = text.strip()
+    while text.startswith("(") and text.endswith(")") and \
+          len(split_top(text[1:-1], ")")) == 1:
+        text = text[1:-1].strip()
+    return text
+
+
+def parse_body(body, trans):
+    for line in body.splitlines():
+        if "=" in line and not (res_setting.search(line) or
+                                parm_setting.search(line) or
+                                order_setting.search(line)):
+            raise RuntimeError("Cannot translate: " + line.strip())
+    mr = res_setting.search(body)
+    if not mr:
+        raise RuntimeError("Case without heuristic: " + body)
+    heuristic = mr.group(1)
+    settings  = [(s, trans.value(s, v))
+                 for s, v in parm_setting.findall(body)]
+    order     = [(s, trans.value(s, v))
+                 for s, v in order_setting.findall(body)]
+    return heuristic, settings, order
+
+
+def parse_cases(src, trans):
+    """
+    Return a list of (conditions, heuristic, settings, order) tuples
+    for the case distinction, the default case (with conditions None)
+    last.
+    """
+    text = section(src, "#if defined(CHE_HEURISTICS_INTERNAL) || "
+                   "defined(TO_ORDERING_INTERNAL)")
+    text = c_comment.sub("", text)
+    res  = []
+    pos  = 0
+    while True:
+        mr = re.compile(r"else\s*(if\s*\()?").search(text, pos)
+        if not mr:
+            break
+        if mr.group(1):
+            # Find the matching parenthesis of the condition
+            depth = 1
+            i = mr.end()
+            while depth:
+                if text[i] == "(":
+                    depth += 1
+                elif text[i] == ")":
+                    depth -= 1
+                i += 1
+            cond_text = text[mr.end():i-1]
+            conditions = []
+            for disj in split_top(cond_text, "||"):
+                conj = [spec_pred.search(strip_parens(lit)).group(1)
+                        for lit in split_top(strip_parens(disj), "&&")]
+                conditions.append(conj)
+        else:
+            conditions = None
+            i = mr.end()
+        start = text.index("{", i)
+        end   = text.index("\n   }", start)
+        res.append((conditions,) + parse_body(text[start:end], trans))
+        pos = end
+    if not res or res[-1][0] is not None:
+        raise RuntimeError("No default case found")
+    return res
+
+
+def print_settings(keyword, settings):
+    if settings:
+        print("   %s %s" % (keyword,
+                            ",\n      ".join(["%s=%s" % s
+                                              for s in settings])))
+
+
+def print_table(name, limits, heuristics, cases):
+    print("# Auto mode table converted from %s by auto_to_table.py" % name)
+    print()
+    if limits:
+        print("limits(%s)" % ",\n       ".join(limits))
+        print()
+    for h in heuristics:
+        print('heuristic "%s"' % h)
+    print()
+    for conditions, heuristic, settings, order in cases:
+        if conditions is None:
+            print("default %s" % heuristic)
+        else:
+            print("case %s" % heuristic)
+            for conj in conditions:
+                print("   if %s" % " & ".join(conj))
+        print_settings("set", settings)
+        print_settings("order", order)
+        print()
+
+
+if __name__ == '__main__':
+    opts, args = getopt.gnu_getopt(sys.argv[1:], "hl:s:")
+    limits  = []
+    src_dir = os.path.join(os.path.dirname(os.path.abspath(sys.argv[0])),
+                           "..")
+    for option, optarg in opts:
+        if option == "-h":
+            print(__doc__)
+            sys.exit()
+        elif option == "-l":
+            limits = [l.strip() for l in optarg.split(",")]
+        elif option == "-s":
+            src_dir = optarg
+    if len(args) != 1:
+        print(__doc__)
+        sys.exit(1)
+
+    src   = read_file(args[0])
+    trans = Translator(src_dir)
+    print_table(os.path.basename(args[0]), limits, parse_heuristics(src),
+                parse_cases(src, trans))